@@ -0,0 +1,29 @@
+'use strict';
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  op: ['encode', 'decode'],
+  size: [64, 1024, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024],
+  n: [256 * 1024 * 1024]  // Total number of bytes to process.
+});
+
+function main({ op, size, n }) {
+  const iterations = Math.max(1, Math.floor(n / size));
+  const b = Buffer.allocUnsafe(size);
+  for (var i = 0; i < size; i += 1) b[i] = (i * 7) & 0xff;
+  // Strings returned by toString() are external, concatenate to get a regular
+  // heap string like the ones that arrive from JS land.
+  const s = ('.' + b.toString('hex')).slice(1);
+  // eslint-disable-next-line node-core/no-unescaped-regexp-dot
+  s.match(/./);  // Flatten string.
+
+  if (op === 'encode') {
+    bench.start();
+    for (i = 0; i < iterations; i += 1) b.toString('hex');
+    bench.end(iterations);
+  } else {
+    bench.start();
+    for (i = 0; i < iterations; i += 1) b.hexWrite(s, 0, size);
+    bench.end(iterations);
+  }
+}
@@ -0,0 +1,66 @@
+// Encrypts `concurrency` streams of `n` chunks each, either on the main thread
+// with update() and updateInto(), or on the threadpool with updateInto().
+'use strict';
+const common = require('../common.js');
+const crypto = require('crypto');
+const keylen = { 'aes-128-gcm': 16, 'aes-192-gcm': 24, 'aes-256-gcm': 32 };
+const bench = common.createBenchmark(main, {
+  n: [64],
+  cipher: ['aes-128-gcm', 'aes-256-gcm'],
+  len: [16 * 1024, 64 * 1024, 256 * 1024, 1024 * 1024, 4 * 1024 * 1024],
+  mode: ['update', 'sync', 'async'],
+  concurrency: [1, 4]
+});
+
+function main({ n, len, cipher, mode, concurrency }) {
+  // Default cipher for tests.
+  if (cipher === '')
+    cipher = 'aes-128-gcm';
+  const key = crypto.randomBytes(keylen[cipher]);
+  const iv = crypto.randomBytes(12);
+  const mbits = concurrency * n * len * 8 / (1024 * 1024);
+
+  var remaining = concurrency;
+  function done() {
+    if (--remaining === 0)
+      bench.end(mbits);
+  }
+
+  bench.start();
+  for (var i = 0; i < concurrency; i++) {
+    const alice = crypto.createCipheriv(cipher, key, iv);
+    const message = Buffer.alloc(len, 'b');
+    if (mode === 'update')
+      encryptUpdate(alice, message, n, done);
+    else if (mode === 'sync')
+      encryptSync(alice, message, n, done);
+    else
+      encryptAsync(alice, message, n, done);
+  }
+}
+
+function encryptUpdate(alice, message, n, callback) {
+  for (var i = 0; i < n; i++)
+    alice.update(message);
+  alice.final();
+  callback();
+}
+
+function encryptSync(alice, message, n, callback) {
+  for (var i = 0; i < n; i++)
+    alice.updateInto(message, message);
+  alice.final();
+  callback();
+}
+
+function encryptAsync(alice, message, n, callback) {
+  function next(err) {
+    if (err) throw err;
+    if (n-- === 0) {
+      alice.final();
+      return callback();
+    }
+    alice.updateInto(message, message, next);
+  }
+  next();
+}
@@ -0,0 +1,33 @@
+// Hashes many small inputs asynchronously, either one request per input or
+// all of them in a single batched request.
+'use strict';
+const common = require('../common.js');
+const crypto = require('crypto');
+
+const bench = common.createBenchmark(main, {
+  n: [1e4],
+  batch: [1, 16, 256],
+  algo: ['sha256', 'md5'],
+  len: [64, 1024]
+});
+
+function main({ n, batch, algo, len }) {
+  const inputs = [];
+  for (var i = 0; i < batch; i++)
+    inputs.push(Buffer.alloc(len, i));
+
+  var remaining = n;
+  function next(err) {
+    if (err) throw err;
+    if (remaining <= 0)
+      return bench.end(n);
+    remaining -= batch;
+    if (batch === 1)
+      crypto.hash(algo, inputs[0], next);
+    else
+      crypto.hash(algo, inputs, next);
+  }
+
+  bench.start();
+  next();
+}
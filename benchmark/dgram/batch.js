@@ -0,0 +1,47 @@
+// Test UDP packets/s with and without batched receives (recvmmsg).
+// Sends are queued `num` at a time so that they go out in batches too.
+'use strict';
+
+const common = require('../common.js');
+const dgram = require('dgram');
+const PORT = common.PORT;
+
+const bench = common.createBenchmark(main, {
+  len: [64, 512],
+  num: [100],
+  batch: [1, 20],
+  type: ['send', 'recv'],
+  dur: [5]
+});
+
+function main({ dur, len, num, batch, type }) {
+  const chunk = Buffer.allocUnsafe(len);
+  var sent = 0;
+  var received = 0;
+  const receiver = dgram.createSocket({ type: 'udp4', recvBatchSize: batch });
+  const sender = dgram.createSocket('udp4');
+
+  function onsend() {
+    if (sent++ % num === 0) {
+      for (var i = 0; i < num; i++) {
+        sender.send(chunk, PORT, '127.0.0.1', onsend);
+      }
+    }
+  }
+
+  receiver.on('listening', function() {
+    bench.start();
+    onsend();
+
+    setTimeout(function() {
+      bench.end(type === 'send' ? sent : received);
+      process.exit(0);
+    }, dur * 1000);
+  });
+
+  receiver.on('message', function() {
+    received++;
+  });
+
+  receiver.bind(PORT);
+}
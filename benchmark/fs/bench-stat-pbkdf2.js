@@ -0,0 +1,54 @@
+// Measures fs.stat() tail latency while the threadpool is kept busy with
+// crypto.pbkdf2() jobs. The reported rate is the inverse of the 99th
+// percentile latency, i.e. higher is better.
+'use strict';
+
+const common = require('../common');
+const crypto = require('crypto');
+const fs = require('fs');
+
+const bench = common.createBenchmark(main, {
+  n: [5e3],
+  concurrent: [0, 4, 16],
+  iterations: [1e4]
+});
+
+function main({ n, concurrent, iterations }) {
+  const latencies = new Array(n);
+  var pending = concurrent;
+  var done = false;
+
+  function pbkdf2() {
+    if (done) {
+      if (--pending === 0)
+        report();
+      return;
+    }
+    crypto.pbkdf2('password', 'salt', iterations, 64, 'sha512', pbkdf2);
+  }
+
+  function report() {
+    latencies.sort((a, b) => a - b);
+    const p99 = latencies[Math.floor(n * 0.99)];
+    bench.report(1e9 / p99, process.hrtime(startTime));
+  }
+
+  for (var i = 0; i < concurrent; i++)
+    pbkdf2();
+
+  const startTime = process.hrtime();
+  (function stat(i) {
+    if (i === n) {
+      done = true;
+      if (pending === 0)
+        report();
+      return;
+    }
+    const start = process.hrtime();
+    fs.stat(__filename, function() {
+      const elapsed = process.hrtime(start);
+      latencies[i] = elapsed[0] * 1e9 + elapsed[1];
+      stat(i + 1);
+    });
+  }(0));
+}
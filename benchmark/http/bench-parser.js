@@ -11,25 +11,28 @@ const CRLF = '\r\n';
 
 const bench = common.createBenchmark(main, {
   len: [4, 8, 16, 32],
+  flat: [0, 1],
   n: [1e5],
 });
 
-function main({ len, n }) {
-  var header = `GET /hello HTTP/1.1${CRLF}Content-Type: text/plain${CRLF}`;
+function main({ len, flat, n }) {
+  var header = `GET /hello HTTP/1.1${CRLF}Content-Type: text/plain${CRLF}` +
+               `Host: localhost${CRLF}User-Agent: bench${CRLF}`;
 
   for (var i = 0; i < len; i++) {
     header += `X-Filler${i}: ${Math.random().toString(36).substr(2)}${CRLF}`;
   }
   header += CRLF;
 
-  processHeader(Buffer.from(header), n);
+  processHeader(Buffer.from(header), flat === 1, n);
 }
 
-function processHeader(header, n) {
+function processHeader(header, flat, n) {
   const parser = newParser(REQUEST);
 
   bench.start();
   for (var i = 0; i < n; i++) {
+    parser.setFlatHeaders(flat);
     parser.execute(header, 0, header.length);
     parser.reinitialize(REQUEST);
   }
@@ -0,0 +1,26 @@
+'use strict';
+
+const common = require('../common.js');
+const { OutgoingMessage } = require('http');
+
+const bench = common.createBenchmark(main, {
+  fields: [2, 10, 50],
+  n: [1e6]
+});
+
+function main({ fields, n }) {
+  const headers = {
+    'Content-Type': 'text/plain',
+    'Content-Length': 1024
+  };
+  for (var i = 2; i < fields; i++)
+    headers[`X-Header-${i}`] = `some header value ${i}`;
+
+  const msg = new OutgoingMessage();
+  msg.sendDate = true;
+
+  bench.start();
+  for (i = 0; i < n; i++)
+    msg._storeHeader('HTTP/1.1 200 OK\r\n', headers);
+  bench.end(n);
+}
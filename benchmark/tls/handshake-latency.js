@@ -0,0 +1,73 @@
+// Measures the round trip latency of an established connection while `storm`
+// other clients keep making new connections to the same server. The reported
+// rate is the inverse of the 99th percentile latency, i.e. higher is better.
+'use strict';
+const common = require('../common.js');
+const fs = require('fs');
+const path = require('path');
+const tls = require('tls');
+
+const bench = common.createBenchmark(main, {
+  n: [2e3],
+  storm: [0, 8, 32],
+  async: [0, 1]
+});
+
+function main({ n, storm, async }) {
+  const cert_dir = path.resolve(__dirname, '../../test/fixtures');
+  const options = {
+    key: fs.readFileSync(`${cert_dir}/test_key.pem`),
+    cert: fs.readFileSync(`${cert_dir}/test_cert.pem`),
+    asyncPrivateKey: async === 1
+  };
+  const server = tls.createServer(options, (socket) => {
+    socket.on('error', () => {});
+    socket.pipe(socket);
+  });
+
+  server.listen(common.PORT, () => {
+    const latencies = new Array(n);
+    var running = true;
+
+    function connect() {
+      if (!running)
+        return;
+      const client = tls.connect({
+        port: common.PORT,
+        rejectUnauthorized: false
+      }, () => client.destroy());
+      client.on('error', () => {});
+      client.on('close', connect);
+    }
+
+    const client = tls.connect({
+      port: common.PORT,
+      rejectUnauthorized: false
+    }, () => {
+      for (var i = 0; i < storm; i++)
+        connect();
+
+      const startTime = process.hrtime();
+      var start;
+      var count = 0;
+      client.on('data', () => {
+        const elapsed = process.hrtime(start);
+        latencies[count] = elapsed[0] * 1e9 + elapsed[1];
+        if (++count < n)
+          return ping();
+        running = false;
+        latencies.sort((a, b) => a - b);
+        const p99 = latencies[Math.floor(n * 0.99)];
+        bench.report(1e9 / p99, process.hrtime(startTime));
+        client.destroy();
+        server.close();
+        process.exit(0);
+      });
+      function ping() {
+        start = process.hrtime();
+        client.write('ping');
+      }
+      ping();
+    });
+  });
+}
@@ -0,0 +1,36 @@
+'use strict';
+
+const common = require('../common.js');
+const { TextDecoder } = require('util');
+
+const bench = common.createBenchmark(main, {
+  content: ['ascii', 'latin1', 'cjk'],
+  fatal: [0, 1],
+  size: [64, 1024, 64 * 1024, 1024 * 1024],
+  n: [1e3]
+});
+
+const chunks = {
+  ascii: 'hello world, ',
+  latin1: 'héllo wörld, ',
+  cjk: 'こんにちは世界, '
+};
+
+function main({ content, fatal, size, n }) {
+  const chunk = chunks[content];
+  const buf = Buffer.from(chunk.repeat(Math.ceil(size / chunk.length)))
+    .slice(0, size);
+  // Don't cut a multi-byte character in half at the end.
+  let end = size;
+  while (end > 0 && (buf[end - 1] & 0xc0) === 0x80)
+    end--;
+  if (end > 0 && buf[end - 1] >= 0xc0)
+    end--;
+  const input = buf.slice(0, end);
+  const decoder = new TextDecoder('utf-8', { fatal: fatal === 1 });
+
+  bench.start();
+  for (var i = 0; i < n; i += 1)
+    decoder.decode(input);
+  bench.end(n);
+}
@@ -0,0 +1,62 @@
+'use strict';
+const common = require('../common.js');
+const fs = require('fs');
+const path = require('path');
+const zlib = require('zlib');
+
+// Compares Brotli with gzip on text. For compress and decompress the result
+// is the throughput in uncompressed MB/s, for ratio it is the size of the
+// input divided by the size of the compressed data. `level` is used as the
+// Brotli quality.
+const bench = common.createBenchmark(main, {
+  algorithm: zlib.brotliCompress ? ['gzip', 'brotli'] : ['gzip'],
+  operation: ['compress', 'decompress', 'ratio'],
+  level: [1, 6, 9],
+  inputLen: [1024 * 1024],
+  n: [20]
+});
+
+function main({ algorithm, operation, level, inputLen, n }) {
+  const lib = path.join(__dirname, '../../lib');
+  const text = fs.readdirSync(lib)
+    .filter((file) => file.endsWith('.js'))
+    .map((file) => fs.readFileSync(path.join(lib, file)));
+  const input = Buffer.alloc(inputLen, Buffer.concat(text));
+  const megabytes = n * inputLen / (1024 * 1024);
+
+  var compress, decompress, options;
+  if (algorithm === 'brotli') {
+    compress = zlib.brotliCompress;
+    decompress = zlib.brotliDecompress;
+    options = {
+      params: { [zlib.constants.BROTLI_PARAM_QUALITY]: level }
+    };
+  } else {
+    compress = zlib.gzip;
+    decompress = zlib.gunzip;
+    options = { level };
+  }
+
+  compress(input, options, (err, compressed) => {
+    if (err)
+      throw err;
+
+    if (operation === 'ratio') {
+      bench.report(input.length / compressed.length, [0, 0]);
+      return;
+    }
+
+    var i = 0;
+    bench.start();
+    (function next(err) {
+      if (err)
+        throw err;
+      if (i++ === n)
+        return bench.end(megabytes);
+      if (operation === 'compress')
+        compress(input, options, next);
+      else
+        decompress(compressed, next);
+    })();
+  });
+}
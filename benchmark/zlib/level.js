@@ -0,0 +1,49 @@
+'use strict';
+const common = require('../common.js');
+const fs = require('fs');
+const path = require('path');
+const zlib = require('zlib');
+
+// Measures the throughput of compressing text at different levels, in MB/s.
+const bench = common.createBenchmark(main, {
+  method: ['gzip', 'gzipSync', 'deflate', 'deflateSync'],
+  level: [1, 6, 9],
+  inputLen: [1024 * 1024],
+  n: [50]
+});
+
+function main({ method, level, inputLen, n }) {
+  const lib = path.join(__dirname, '../../lib');
+  const text = fs.readdirSync(lib)
+    .filter((file) => file.endsWith('.js'))
+    .map((file) => fs.readFileSync(path.join(lib, file)));
+  const input = Buffer.alloc(inputLen, Buffer.concat(text));
+  const options = { level };
+  const megabytes = n * inputLen / (1024 * 1024);
+
+  var i = 0;
+  switch (method) {
+    case 'gzip':
+    case 'deflate':
+      var compress = zlib[method];
+      bench.start();
+      (function next(err) {
+        if (err)
+          throw err;
+        if (i++ === n)
+          return bench.end(megabytes);
+        compress(input, options, next);
+      })();
+      break;
+    case 'gzipSync':
+    case 'deflateSync':
+      var compressSync = zlib[method];
+      bench.start();
+      for (; i < n; ++i)
+        compressSync(input, options);
+      bench.end(megabytes);
+      break;
+    default:
+      throw new Error('Unsupported method');
+  }
+}
@@ -0,0 +1,5 @@
+# Do not edit. Generated by the configure script.
+PYTHON=/root/.pyenv/versions/2.7.18/bin/python
+BUILDTYPE=Release
+PREFIX=/usr/local
+NODE_TARGET_TYPE=executable
@@ -234,9 +234,11 @@ typedef struct uv_cpu_info_s uv_cpu_info_t;
 typedef struct uv_interface_address_s uv_interface_address_t;
 typedef struct uv_dirent_s uv_dirent_t;
 typedef struct uv_passwd_s uv_passwd_t;
+typedef struct uv_metrics_s uv_metrics_t;
 
 typedef enum {
-  UV_LOOP_BLOCK_SIGNAL
+  UV_LOOP_BLOCK_SIGNAL,
+  UV_METRICS_IDLE_TIME
 } uv_loop_option;
 
 typedef enum {
@@ -292,6 +294,16 @@ UV_EXTERN uint64_t uv_now(const uv_loop_t*);
 UV_EXTERN int uv_backend_fd(const uv_loop_t*);
 UV_EXTERN int uv_backend_timeout(const uv_loop_t*);
 
+struct uv_metrics_s {
+  uint64_t loop_count;  /* Number of times the poll phase was entered. */
+  uint64_t wakeups;     /* Polls that returned at least one event. */
+  uint64_t events;      /* Events dispatched to watchers. */
+  uint64_t ctl_calls;   /* System calls made to update the watched set. */
+  uint64_t idle_time;   /* Nanoseconds spent blocked in the poll phase. */
+};
+
+UV_EXTERN int uv_metrics_info(const uv_loop_t* loop, uv_metrics_t* metrics);
+
 typedef void (*uv_alloc_cb)(uv_handle_t* handle,
                             size_t suggested_size,
                             uv_buf_t* buf);
@@ -589,7 +601,23 @@ enum uv_udp_flags {
    * (provided they all set the flag) but only the last one to bind will receive
    * any traffic, in effect "stealing" the port from the previous listener.
    */
-  UV_UDP_REUSEADDR = 4
+  UV_UDP_REUSEADDR = 4,
+  /*
+   * Indicates that the message was received by recvmmsg, so the buffer
+   * provided must not be freed by the recv_cb callback.
+   */
+  UV_UDP_MMSG_CHUNK = 8,
+  /*
+   * Indicates that the buffer provided has been fully utilized by recvmmsg
+   * and that it should now be freed by the recv_cb callback. When this flag
+   * is set in uv_udp_recv_cb, nread will always be 0 and addr always NULL.
+   */
+  UV_UDP_MMSG_FREE = 16,
+  /*
+   * Indicates that recvmmsg should be used, if available. Only valid for
+   * uv_udp_init_ex.
+   */
+  UV_UDP_RECVMMSG = 256
 };
 
 typedef void (*uv_udp_send_cb)(uv_udp_send_t* req, int status);
@@ -999,10 +1027,25 @@ struct uv_work_s {
   UV_WORK_PRIVATE_FIELDS
 };
 
+/*
+ * Priority classes for threadpool work.  File system requests are always
+ * UV_WORK_FAST_IO, getaddrinfo and getnameinfo requests UV_WORK_SLOW_IO.
+ */
+typedef enum {
+  UV_WORK_CPU = 0,
+  UV_WORK_FAST_IO,
+  UV_WORK_SLOW_IO
+} uv_work_kind;
+
 UV_EXTERN int uv_queue_work(uv_loop_t* loop,
                             uv_work_t* req,
                             uv_work_cb work_cb,
                             uv_after_work_cb after_work_cb);
+UV_EXTERN int uv_queue_work_ex(uv_loop_t* loop,
+                               uv_work_t* req,
+                               uv_work_kind kind,
+                               uv_work_cb work_cb,
+                               uv_after_work_cb after_work_cb);
 
 UV_EXTERN int uv_cancel(uv_req_t* req);
 
@@ -26,6 +26,16 @@
   uv__io_t inotify_read_watcher;                                              \
   void* inotify_watchers;                                                     \
   int inotify_fd;                                                             \
+  void* io_uring;                                                             \
+  void* poll_events;                                                          \
+  unsigned int poll_nevents;                                                  \
+  struct {                                                                    \
+    uint64_t loop_count;                                                      \
+    uint64_t wakeups;                                                         \
+    uint64_t events;                                                          \
+    uint64_t ctl_calls;                                                       \
+    uint64_t idle_time;                                                       \
+  } metrics;                                                                  \
 
 #define UV_PLATFORM_FS_EVENT_FIELDS                                           \
   void* watchers[2];                                                          \
@@ -29,15 +29,42 @@
 
 #define MAX_THREADPOOL_SIZE 128
 
+/* Number of fast I/O requests a worker runs back to back before it gives a
+ * waiting CPU-bound request a turn.  Keeps a flood of file system requests
+ * from starving crypto and zlib work indefinitely.
+ */
+#define FAST_IO_BURST 8
+
+/* Every worker owns a mutex-protected FIFO queue per priority class.
+ * Submitters hand work directly to an idle worker when there is one,
+ * otherwise to a busy worker picked by hashing the request address.  Workers
+ * that run dry steal from their siblings before going to sleep, so a long
+ * running request doesn't strand the work queued up behind it.
+ *
+ * Slow I/O is kept in a single global queue and at most half of the threads
+ * run it concurrently, so that e.g. a stalled DNS lookup can't tie up the
+ * whole pool and starve fast file system requests.
+ */
+struct worker {
+  uv_thread_t thread;
+  uv_mutex_t mutex;
+  uv_cond_t cond;
+  QUEUE wq[2];  /* Indexed by UV_WORK_CPU and UV_WORK_FAST_IO. */
+  QUEUE idle_node;
+  unsigned int index;
+  unsigned int fast_io_streak;
+  int kicked;
+  int exiting;
+};
+
 static uv_once_t once = UV_ONCE_INIT;
-static uv_cond_t cond;
-static uv_mutex_t mutex;
-static unsigned int idle_threads;
+static uv_mutex_t mutex;  /* Guards idle_workers and the slow I/O state. */
 static unsigned int nthreads;
-static uv_thread_t* threads;
-static uv_thread_t default_threads[4];
-static QUEUE exit_message;
-static QUEUE wq;
+static struct worker* workers;
+static struct worker default_workers[4];
+static QUEUE idle_workers;
+static QUEUE slow_io_wq;
+static unsigned int slow_io_work_running;
 
 
 static void uv__cancelled(struct uv__work* w) {
@@ -45,43 +72,194 @@ static void uv__cancelled(struct uv__work* w) {
 }
 
 
-/* To avoid deadlock with uv_cancel() it's crucial that the worker
- * never holds the global mutex and the loop-local mutex at the same time.
+static unsigned int slow_work_thread_threshold(void) {
+  return (nthreads + 1) / 2;
+}
+
+
+/* Pops the next request off a worker's queues.  Must be called with the
+ * worker's mutex held.
+ */
+static QUEUE* worker_dequeue(struct worker* wk) {
+  QUEUE* fast_io;
+  QUEUE* cpu;
+  QUEUE* q;
+
+  fast_io = &wk->wq[UV_WORK_FAST_IO];
+  cpu = &wk->wq[UV_WORK_CPU];
+
+  if (!QUEUE_EMPTY(fast_io) &&
+      (wk->fast_io_streak < FAST_IO_BURST || QUEUE_EMPTY(cpu))) {
+    wk->fast_io_streak += 1;
+    q = QUEUE_HEAD(fast_io);
+  } else if (!QUEUE_EMPTY(cpu)) {
+    wk->fast_io_streak = 0;
+    q = QUEUE_HEAD(cpu);
+  } else {
+    return NULL;
+  }
+
+  QUEUE_REMOVE(q);
+  QUEUE_INIT(q);  /* Signal uv_cancel() that the work req is executing. */
+  return q;
+}
+
+
+/* Takes a request from a sibling's queues.  Unless `blocking` is set, busy
+ * siblings are skipped.
+ */
+static QUEUE* worker_steal(struct worker* self, int blocking) {
+  struct worker* victim;
+  unsigned int i;
+  QUEUE* q;
+
+  q = NULL;
+  for (i = 1; i < nthreads && q == NULL; i++) {
+    victim = workers + (self->index + i) % nthreads;
+    /* Don't block on a sibling unless asked to, it's cheaper to take another
+     * lap through the loop than to convoy behind a submitter or uv_cancel().
+     */
+    if (blocking)
+      uv_mutex_lock(&victim->mutex);
+    else if (uv_mutex_trylock(&victim->mutex))
+      continue;
+    q = worker_dequeue(victim);
+    uv_mutex_unlock(&victim->mutex);
+  }
+
+  return q;
+}
+
+
+static QUEUE* slow_io_dequeue(void) {
+  QUEUE* q;
+
+  q = NULL;
+  uv_mutex_lock(&mutex);
+  if (!QUEUE_EMPTY(&slow_io_wq) &&
+      slow_io_work_running < slow_work_thread_threshold()) {
+    q = QUEUE_HEAD(&slow_io_wq);
+    QUEUE_REMOVE(q);
+    QUEUE_INIT(q);  /* Signal uv_cancel() that the work req is executing. */
+    slow_io_work_running++;
+  }
+  uv_mutex_unlock(&mutex);
+
+  return q;
+}
+
+
+/* Must be called with the global mutex held.  Returns NULL when all workers
+ * are busy.
+ */
+static struct worker* pop_idle_worker(void) {
+  QUEUE* q;
+
+  if (QUEUE_EMPTY(&idle_workers))
+    return NULL;
+
+  q = QUEUE_HEAD(&idle_workers);
+  QUEUE_REMOVE(q);
+  QUEUE_INIT(q);
+
+  return QUEUE_DATA(q, struct worker, idle_node);
+}
+
+
+static void worker_unregister_idle(struct worker* wk) {
+  uv_mutex_lock(&mutex);
+  if (!QUEUE_EMPTY(&wk->idle_node)) {
+    QUEUE_REMOVE(&wk->idle_node);
+    QUEUE_INIT(&wk->idle_node);
+  }
+  uv_mutex_unlock(&mutex);
+}
+
+
+/* Parks the worker until it is handed work or told to exit.  Returns
+ * non-zero when the thread should terminate.  Sets `*stolen` when a request
+ * was found on a sibling's queues instead.
+ */
+static int worker_wait(struct worker* wk, QUEUE** stolen) {
+  int exiting;
+
+  uv_mutex_lock(&mutex);
+  if (QUEUE_EMPTY(&wk->idle_node))
+    QUEUE_INSERT_TAIL(&idle_workers, &wk->idle_node);
+  uv_mutex_unlock(&mutex);
+
+  /* A submitter that found no idle worker may have queued a request on a
+   * busy sibling since the last steal attempt, or that attempt may have
+   * skipped the sibling.  Anything queued from now on comes with a kick, see
+   * post(), so one more look that doesn't skip anyone is enough.
+   */
+  *stolen = worker_steal(wk, 1);
+  if (*stolen != NULL) {
+    worker_unregister_idle(wk);
+    return 0;
+  }
+
+  uv_mutex_lock(&wk->mutex);
+  while (QUEUE_EMPTY(&wk->wq[UV_WORK_CPU]) &&
+         QUEUE_EMPTY(&wk->wq[UV_WORK_FAST_IO]) &&
+         wk->kicked == 0 &&
+         wk->exiting == 0) {
+    uv_cond_wait(&wk->cond, &wk->mutex);
+  }
+  wk->kicked = 0;
+  exiting = wk->exiting &&
+            QUEUE_EMPTY(&wk->wq[UV_WORK_CPU]) &&
+            QUEUE_EMPTY(&wk->wq[UV_WORK_FAST_IO]);
+  uv_mutex_unlock(&wk->mutex);
+
+  worker_unregister_idle(wk);
+
+  return exiting;
+}
+
+
+/* To avoid deadlock with uv_cancel() it's crucial that the worker never
+ * blocks on more than one of the threadpool mutexes, and never holds one of
+ * them and the loop-local mutex at the same time.
  */
 static void worker(void* arg) {
   struct uv__work* w;
+  struct worker* wk;
+  int slow_io;
   QUEUE* q;
 
-  uv_sem_post((uv_sem_t*) arg);
-  arg = NULL;
+  wk = arg;
 
   for (;;) {
-    uv_mutex_lock(&mutex);
+    uv_mutex_lock(&wk->mutex);
+    q = worker_dequeue(wk);
+    uv_mutex_unlock(&wk->mutex);
 
-    while (QUEUE_EMPTY(&wq)) {
-      idle_threads += 1;
-      uv_cond_wait(&cond, &mutex);
-      idle_threads -= 1;
-    }
-
-    q = QUEUE_HEAD(&wq);
+    if (q == NULL)
+      q = worker_steal(wk, 0);
 
-    if (q == &exit_message)
-      uv_cond_signal(&cond);
-    else {
-      QUEUE_REMOVE(q);
-      QUEUE_INIT(q);  /* Signal uv_cancel() that the work req is
-                             executing. */
+    slow_io = 0;
+    if (q == NULL) {
+      q = slow_io_dequeue();
+      slow_io = (q != NULL);
     }
 
-    uv_mutex_unlock(&mutex);
-
-    if (q == &exit_message)
-      break;
+    if (q == NULL) {
+      if (worker_wait(wk, &q))
+        break;
+      if (q == NULL)
+        continue;
+    }
 
     w = QUEUE_DATA(q, struct uv__work, wq);
     w->work(w);
 
+    if (slow_io) {
+      uv_mutex_lock(&mutex);
+      slow_io_work_running--;
+      uv_mutex_unlock(&mutex);
+    }
+
     uv_mutex_lock(&w->loop->wq_mutex);
     w->work = NULL;  /* Signal uv_cancel() that the work req is done
                         executing. */
@@ -92,46 +270,104 @@ static void worker(void* arg) {
 }
 
 
-static void post(QUEUE* q) {
+static void post(QUEUE* q, uv_work_kind kind) {
+  struct worker* idle;
+  struct worker* wk;
+
+  uv_mutex_lock(&mutex);
+
+  if (kind == UV_WORK_SLOW_IO) {
+    QUEUE_INSERT_TAIL(&slow_io_wq, q);
+    wk = NULL;
+    if (slow_io_work_running < slow_work_thread_threshold())
+      wk = pop_idle_worker();
+    uv_mutex_unlock(&mutex);
+
+    if (wk != NULL) {
+      uv_mutex_lock(&wk->mutex);
+      wk->kicked = 1;
+      uv_cond_signal(&wk->cond);
+      uv_mutex_unlock(&wk->mutex);
+    }
+    return;
+  }
+
+  wk = pop_idle_worker();
+  uv_mutex_unlock(&mutex);
+
+  if (wk != NULL) {
+    uv_mutex_lock(&wk->mutex);
+    QUEUE_INSERT_TAIL(&wk->wq[kind], q);
+    uv_cond_signal(&wk->cond);
+    uv_mutex_unlock(&wk->mutex);
+    return;
+  }
+
+  wk = workers + ((uintptr_t) q >> 4) % nthreads;
+  uv_mutex_lock(&wk->mutex);
+  QUEUE_INSERT_TAIL(&wk->wq[kind], q);
+  uv_cond_signal(&wk->cond);
+  uv_mutex_unlock(&wk->mutex);
+
+  /* `wk` may be stuck on a long running request.  A worker that went idle
+   * since pop_idle_worker() above has either seen the request already or is
+   * woken up here to steal it.
+   */
   uv_mutex_lock(&mutex);
-  QUEUE_INSERT_TAIL(&wq, q);
-  if (idle_threads > 0)
-    uv_cond_signal(&cond);
+  idle = pop_idle_worker();
   uv_mutex_unlock(&mutex);
+
+  if (idle != NULL) {
+    uv_mutex_lock(&idle->mutex);
+    idle->kicked = 1;
+    uv_cond_signal(&idle->cond);
+    uv_mutex_unlock(&idle->mutex);
+  }
 }
 
 
 #ifndef _WIN32
 UV_DESTRUCTOR(static void cleanup(void)) {
+  struct worker* wk;
   unsigned int i;
 
   if (nthreads == 0)
     return;
 
-  post(&exit_message);
+  for (i = 0; i < nthreads; i++) {
+    wk = workers + i;
+    uv_mutex_lock(&wk->mutex);
+    wk->exiting = 1;
+    uv_cond_signal(&wk->cond);
+    uv_mutex_unlock(&wk->mutex);
+  }
 
   for (i = 0; i < nthreads; i++)
-    if (uv_thread_join(threads + i))
+    if (uv_thread_join(&workers[i].thread))
       abort();
 
-  if (threads != default_threads)
-    uv__free(threads);
+  for (i = 0; i < nthreads; i++) {
+    uv_mutex_destroy(&workers[i].mutex);
+    uv_cond_destroy(&workers[i].cond);
+  }
+
+  if (workers != default_workers)
+    uv__free(workers);
 
   uv_mutex_destroy(&mutex);
-  uv_cond_destroy(&cond);
 
-  threads = NULL;
+  workers = NULL;
   nthreads = 0;
 }
 #endif
 
 
 static void init_threads(void) {
+  struct worker* wk;
   unsigned int i;
   const char* val;
-  uv_sem_t sem;
 
-  nthreads = ARRAY_SIZE(default_threads);
+  nthreads = ARRAY_SIZE(default_workers);
   val = getenv("UV_THREADPOOL_SIZE");
   if (val != NULL)
     nthreads = atoi(val);
@@ -140,34 +376,47 @@ static void init_threads(void) {
   if (nthreads > MAX_THREADPOOL_SIZE)
     nthreads = MAX_THREADPOOL_SIZE;
 
-  threads = default_threads;
-  if (nthreads > ARRAY_SIZE(default_threads)) {
-    threads = uv__malloc(nthreads * sizeof(threads[0]));
-    if (threads == NULL) {
-      nthreads = ARRAY_SIZE(default_threads);
-      threads = default_threads;
+  workers = default_workers;
+  if (nthreads > ARRAY_SIZE(default_workers)) {
+    workers = uv__malloc(nthreads * sizeof(workers[0]));
+    if (workers == NULL) {
+      nthreads = ARRAY_SIZE(default_workers);
+      workers = default_workers;
     }
   }
 
-  if (uv_cond_init(&cond))
-    abort();
-
   if (uv_mutex_init(&mutex))
     abort();
 
-  QUEUE_INIT(&wq);
+  QUEUE_INIT(&idle_workers);
+  QUEUE_INIT(&slow_io_wq);
+  slow_io_work_running = 0;
 
-  if (uv_sem_init(&sem, 0))
-    abort();
+  /* All workers start out on the idle list so that the requests submitted
+   * right after initialization are spread over the threads even before
+   * they have been scheduled for the first time.
+   */
+  for (i = 0; i < nthreads; i++) {
+    wk = workers + i;
 
-  for (i = 0; i < nthreads; i++)
-    if (uv_thread_create(threads + i, worker, &sem))
+    if (uv_mutex_init(&wk->mutex))
       abort();
 
-  for (i = 0; i < nthreads; i++)
-    uv_sem_wait(&sem);
+    if (uv_cond_init(&wk->cond))
+      abort();
+
+    QUEUE_INIT(&wk->wq[UV_WORK_CPU]);
+    QUEUE_INIT(&wk->wq[UV_WORK_FAST_IO]);
+    QUEUE_INSERT_TAIL(&idle_workers, &wk->idle_node);
+    wk->index = i;
+    wk->fast_io_streak = 0;
+    wk->kicked = 0;
+    wk->exiting = 0;
+  }
 
-  uv_sem_destroy(&sem);
+  for (i = 0; i < nthreads; i++)
+    if (uv_thread_create(&workers[i].thread, worker, workers + i))
+      abort();
 }
 
 
@@ -182,8 +431,7 @@ static void reset_once(void) {
 static void init_once(void) {
 #ifndef _WIN32
   /* Re-initialize the threadpool after fork.
-   * Note that this discards the global mutex and condition as well
-   * as the work queue.
+   * Note that this discards the global mutex and the worker queues.
    */
   if (pthread_atfork(NULL, NULL, &reset_once))
     abort();
@@ -194,19 +442,26 @@ static void init_once(void) {
 
 void uv__work_submit(uv_loop_t* loop,
                      struct uv__work* w,
+                     uv_work_kind kind,
                      void (*work)(struct uv__work* w),
                      void (*done)(struct uv__work* w, int status)) {
   uv_once(&once, init_once);
   w->loop = loop;
   w->work = work;
   w->done = done;
-  post(&w->wq);
+  post(&w->wq, kind);
 }
 
 
 static int uv__work_cancel(uv_loop_t* loop, uv_req_t* req, struct uv__work* w) {
+  unsigned int i;
   int cancelled;
 
+  /* The request may be sitting in any worker's queue, lock them all.  This
+   * is slow but cancellation is rare.
+   */
+  for (i = 0; i < nthreads; i++)
+    uv_mutex_lock(&workers[i].mutex);
   uv_mutex_lock(&mutex);
   uv_mutex_lock(&w->loop->wq_mutex);
 
@@ -216,6 +471,8 @@ static int uv__work_cancel(uv_loop_t* loop, uv_req_t* req, struct uv__work* w) {
 
   uv_mutex_unlock(&w->loop->wq_mutex);
   uv_mutex_unlock(&mutex);
+  for (i = nthreads; i > 0; i--)
+    uv_mutex_unlock(&workers[i - 1].mutex);
 
   if (!cancelled)
     return UV_EBUSY;
@@ -277,14 +534,29 @@ int uv_queue_work(uv_loop_t* loop,
                   uv_work_t* req,
                   uv_work_cb work_cb,
                   uv_after_work_cb after_work_cb) {
+  return uv_queue_work_ex(loop, req, UV_WORK_CPU, work_cb, after_work_cb);
+}
+
+
+int uv_queue_work_ex(uv_loop_t* loop,
+                     uv_work_t* req,
+                     uv_work_kind kind,
+                     uv_work_cb work_cb,
+                     uv_after_work_cb after_work_cb) {
   if (work_cb == NULL)
     return UV_EINVAL;
 
+  if (kind != UV_WORK_CPU &&
+      kind != UV_WORK_FAST_IO &&
+      kind != UV_WORK_SLOW_IO) {
+    return UV_EINVAL;
+  }
+
   uv__req_init(loop, req, UV_WORK);
   req->loop = loop;
   req->work_cb = work_cb;
   req->after_work_cb = after_work_cb;
-  uv__work_submit(loop, &req->work_req, uv__queue_work, uv__queue_done);
+  uv__work_submit(loop, &req->work_req, kind, uv__queue_work, uv__queue_done);
   return 0;
 }
 
@@ -73,6 +73,13 @@
 # define CLOCK_BOOTTIME 7
 #endif
 
+/* uv__io_poll() starts out with an on-stack array of UV__POLL_EVENTS_MIN
+ * events and switches to a heap allocated array, doubling its size up to
+ * UV__POLL_EVENTS_MAX, whenever epoll_wait() fills it up completely.
+ */
+#define UV__POLL_EVENTS_MIN 1024
+#define UV__POLL_EVENTS_MAX 16384
+
 static int read_models(unsigned int numcpus, uv_cpu_info_t* ci);
 static int read_times(FILE* statfile_fp,
                       unsigned int numcpus,
@@ -99,6 +106,9 @@ int uv__platform_loop_init(uv_loop_t* loop) {
   loop->backend_fd = fd;
   loop->inotify_fd = -1;
   loop->inotify_watchers = NULL;
+  loop->io_uring = NULL;
+  loop->poll_events = NULL;
+  loop->poll_nevents = 0;
 
   if (fd == -1)
     return UV__ERR(errno);
@@ -126,6 +136,10 @@ int uv__io_fork(uv_loop_t* loop) {
 
 
 void uv__platform_loop_delete(uv_loop_t* loop) {
+  uv__iou_delete(loop);
+  uv__free(loop->poll_events);
+  loop->poll_events = NULL;
+  loop->poll_nevents = 0;
   if (loop->inotify_fd == -1) return;
   uv__io_stop(loop, &loop->inotify_read_watcher, POLLIN);
   uv__close(loop->inotify_fd);
@@ -185,6 +199,33 @@ int uv__io_check_fd(uv_loop_t* loop, int fd) {
 }
 
 
+static void uv__grow_poll_events(uv_loop_t* loop, unsigned int nevents) {
+  struct uv__epoll_event* events;
+
+  if (nevents >= UV__POLL_EVENTS_MAX)
+    return;
+
+  nevents *= 2;
+  events = uv__malloc(nevents * sizeof(*events));
+  if (events == NULL)
+    return;  /* Not fatal, keep using the old array. */
+
+  uv__free(loop->poll_events);
+  loop->poll_events = events;
+  loop->poll_nevents = nevents;
+}
+
+
+int uv_metrics_info(const uv_loop_t* loop, uv_metrics_t* metrics) {
+  metrics->loop_count = loop->metrics.loop_count;
+  metrics->wakeups = loop->metrics.wakeups;
+  metrics->events = loop->metrics.events;
+  metrics->ctl_calls = loop->metrics.ctl_calls;
+  metrics->idle_time = loop->metrics.idle_time;
+  return 0;
+}
+
+
 void uv__io_poll(uv_loop_t* loop, int timeout) {
   /* A bug in kernels < 2.6.37 makes timeouts larger than ~30 minutes
    * effectively infinite on 32 bits architectures.  To avoid blocking
@@ -197,7 +238,8 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
   static const int max_safe_timeout = 1789569;
   static int no_epoll_pwait;
   static int no_epoll_wait;
-  struct uv__epoll_event events[1024];
+  struct uv__epoll_event stack_events[UV__POLL_EVENTS_MIN];
+  struct uv__epoll_event* events;
   struct uv__epoll_event* pe;
   struct uv__epoll_event e;
   int real_timeout;
@@ -206,6 +248,8 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
   sigset_t sigset;
   uint64_t sigmask;
   uint64_t base;
+  uint64_t poll_start;
+  unsigned int max_events;
   int have_signals;
   int nevents;
   int count;
@@ -214,6 +258,15 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
   int op;
   int i;
 
+  /* Submit the file system requests queued up since the last iteration.
+   * Poll instead of blocking if some of them could not be submitted yet, so
+   * the next iteration retries.
+   */
+  if (uv__iou_flush(loop))
+    timeout = 0;
+
+  loop->metrics.loop_count++;
+
   if (loop->nfds == 0) {
     assert(QUEUE_EMPTY(&loop->watcher_queue));
     return;
@@ -229,6 +282,14 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
     assert(w->fd >= 0);
     assert(w->fd < (int) loop->nwatchers);
 
+    /* The watcher only stopped watching some events.  Skip the system call
+     * and leave the wider mask armed; the extra events are squelched after
+     * epoll_wait() and the mask is narrowed there if they actually fire.
+     * Restarting the events later on is then free, see uv__io_start().
+     */
+    if (w->events != 0 && (w->pevents & ~w->events) == 0)
+      continue;
+
     e.events = w->pevents;
     e.data = w->fd;
 
@@ -237,9 +298,7 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
     else
       op = UV__EPOLL_CTL_MOD;
 
-    /* XXX Future optimization: do EPOLL_CTL_MOD lazily if we stop watching
-     * events, skip the syscall and squelch the events after epoll_wait().
-     */
+    loop->metrics.ctl_calls++;
     if (uv__epoll_ctl(loop->backend_fd, op, w->fd, &e)) {
       if (errno != EEXIST)
         abort();
@@ -247,6 +306,7 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
       assert(op == UV__EPOLL_CTL_ADD);
 
       /* We've reactivated a file descriptor that's been watched before. */
+      loop->metrics.ctl_calls++;
       if (uv__epoll_ctl(loop->backend_fd, UV__EPOLL_CTL_MOD, w->fd, &e))
         abort();
     }
@@ -267,6 +327,14 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
   real_timeout = timeout;
 
   for (;;) {
+    if (loop->poll_events != NULL) {
+      events = loop->poll_events;
+      max_events = loop->poll_nevents;
+    } else {
+      events = stack_events;
+      max_events = ARRAY_SIZE(stack_events);
+    }
+
     /* See the comment for max_safe_timeout for an explanation of why
      * this is necessary.  Executive summary: kernel bug workaround.
      */
@@ -277,10 +345,14 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
       if (pthread_sigmask(SIG_BLOCK, &sigset, NULL))
         abort();
 
+    poll_start = 0;
+    if (timeout != 0 && (loop->flags & UV_LOOP_METRICS_IDLE_TIME))
+      poll_start = uv__hrtime(UV_CLOCK_PRECISE);
+
     if (no_epoll_wait != 0 || (sigmask != 0 && no_epoll_pwait == 0)) {
       nfds = uv__epoll_pwait(loop->backend_fd,
                              events,
-                             ARRAY_SIZE(events),
+                             max_events,
                              timeout,
                              sigmask);
       if (nfds == -1 && errno == ENOSYS)
@@ -288,12 +360,15 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
     } else {
       nfds = uv__epoll_wait(loop->backend_fd,
                             events,
-                            ARRAY_SIZE(events),
+                            max_events,
                             timeout);
       if (nfds == -1 && errno == ENOSYS)
         no_epoll_wait = 1;
     }
 
+    if (poll_start != 0)
+      loop->metrics.idle_time += uv__hrtime(UV_CLOCK_PRECISE) - poll_start;
+
     if (sigmask != 0 && no_epoll_pwait != 0)
       if (pthread_sigmask(SIG_UNBLOCK, &sigset, NULL))
         abort();
@@ -338,6 +413,7 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
 
     have_signals = 0;
     nevents = 0;
+    loop->metrics.wakeups++;
 
     assert(loop->watchers != NULL);
     loop->watchers[loop->nwatchers] = (void*) events;
@@ -361,10 +437,26 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
          * Ignore all errors because we may be racing with another thread
          * when the file descriptor is closed.
          */
+        loop->metrics.ctl_calls++;
         uv__epoll_ctl(loop->backend_fd, UV__EPOLL_CTL_DEL, fd, pe);
         continue;
       }
 
+      /* An event that was left armed by the lazy update in the watcher queue
+       * loop above fired.  Narrow the mask now so it doesn't keep waking us.
+       */
+      if (pe->events & ~(w->pevents | POLLERR | POLLHUP) &
+          (POLLIN | POLLOUT | UV__POLLRDHUP | UV__POLLPRI)) {
+        if (w->events != w->pevents) {
+          e.events = w->pevents;
+          e.data = w->fd;
+          loop->metrics.ctl_calls++;
+          if (uv__epoll_ctl(loop->backend_fd, UV__EPOLL_CTL_MOD, w->fd, &e))
+            abort();
+          w->events = w->pevents;
+        }
+      }
+
       /* Give users only events they're interested in. Prevents spurious
        * callbacks when previous callback invocation in this loop has stopped
        * the current watcher. Also, filters out events that users has not
@@ -409,12 +501,16 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
 
     loop->watchers[loop->nwatchers] = NULL;
     loop->watchers[loop->nwatchers + 1] = NULL;
+    loop->metrics.events += nevents;
+
+    if ((unsigned int) nfds == max_events)
+      uv__grow_poll_events(loop, max_events);
 
     if (have_signals != 0)
       return;  /* Event loop should cycle now so don't poll again. */
 
     if (nevents != 0) {
-      if (nfds == ARRAY_SIZE(events) && --count != 0) {
+      if ((unsigned int) nfds == max_events && --count != 0) {
         /* Poll for more events but don't block this time. */
         timeout = 0;
         continue;
@@ -0,0 +1,538 @@
+/* Copyright libuv project contributors. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/* io_uring backed file system requests.
+ *
+ * Eligible uv_fs_t requests are turned into submission queue entries on the
+ * loop thread instead of being handed to the threadpool.  Entries are batched
+ * and submitted with a single io_uring_enter() call right before the loop
+ * blocks for I/O, and completions are reaped from the ring file descriptor,
+ * which is watched like any other file descriptor.
+ *
+ * The uv__iou_fs_*() functions return 1 when the request was queued and 0
+ * when the caller should fall back to the threadpool, e.g. because the
+ * kernel doesn't support io_uring or the rings are full.
+ *
+ * Set the UV_USE_IO_URING environment variable to 0 to disable io_uring.
+ */
+
+#include "uv.h"
+#include "internal.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include <sys/mman.h>
+#include <sys/sysmacros.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#define UV__IOU_SQ_ENTRIES 64
+
+struct uv__iou {
+  uv__io_t io_watcher;
+  uint32_t* sqhead;
+  uint32_t* sqtail;
+  uint32_t* cqhead;
+  uint32_t* cqtail;
+  uint32_t sqmask;
+  uint32_t cqmask;
+  uint32_t sqlocal;  /* Tail including filled but unsubmitted entries. */
+  uint32_t cq_entries;
+  uint32_t in_flight;
+  struct uv__io_uring_sqe* sqe;
+  struct uv__io_uring_cqe* cqe;
+  void* ring;
+  size_t ringlen;
+  size_t sqelen;
+};
+
+static uv_once_t once = UV_ONCE_INIT;
+static int uv__iou_disabled;
+
+/* Stored in loop->io_uring when the ring could not be created so we don't
+ * retry on every request.
+ */
+static struct uv__iou uv__iou_unavailable;
+
+
+static void uv__iou_detect(void) {
+  static const uint8_t required_ops[] = {
+    UV__IORING_OP_READV,
+    UV__IORING_OP_WRITEV,
+    UV__IORING_OP_FSYNC,
+    UV__IORING_OP_OPENAT,
+    UV__IORING_OP_CLOSE,
+    UV__IORING_OP_STATX
+  };
+  struct uv__io_uring_params params;
+  struct uv__io_uring_probe* probe;
+  uint32_t required_features;
+  const char* val;
+  unsigned int i;
+  uint8_t op;
+  int fd;
+
+  uv__iou_disabled = 1;
+
+  val = getenv("UV_USE_IO_URING");
+  if (val != NULL && atoi(val) == 0)
+    return;
+
+  memset(&params, 0, sizeof(params));
+  fd = uv__io_uring_setup(1, &params);
+  if (fd == -1)
+    return;
+
+  /* NODROP also implies SINGLE_MMAP, RW_CUR_POS implies that OPENAT, CLOSE
+   * and STATX exist, but the probe below is the authoritative check.
+   */
+  required_features = UV__IORING_FEAT_SINGLE_MMAP |
+                      UV__IORING_FEAT_NODROP |
+                      UV__IORING_FEAT_RW_CUR_POS;
+
+  probe = NULL;
+  if ((params.features & required_features) != required_features)
+    goto out;
+
+  probe = uv__calloc(1, sizeof(*probe));
+  if (probe == NULL)
+    goto out;
+
+  if (uv__io_uring_register(fd,
+                            UV__IORING_REGISTER_PROBE,
+                            probe,
+                            ARRAY_SIZE(probe->ops))) {
+    goto out;
+  }
+
+  for (i = 0; i < ARRAY_SIZE(required_ops); i++) {
+    op = required_ops[i];
+    if (op > probe->last_op)
+      goto out;
+    if ((probe->ops[op].flags & UV__IO_URING_OP_SUPPORTED) == 0)
+      goto out;
+  }
+
+  uv__iou_disabled = 0;
+
+out:
+  uv__free(probe);
+  uv__close(fd);
+}
+
+
+static void uv__iou_io(uv_loop_t* loop, uv__io_t* w, unsigned int events);
+
+
+static struct uv__iou* uv__iou_create(uv_loop_t* loop) {
+  struct uv__io_uring_params params;
+  struct uv__iou* iou;
+  size_t ringlen;
+  size_t sqelen;
+  size_t sqlen;
+  size_t cqlen;
+  uint32_t* sqarray;
+  uint32_t i;
+  char* ring;
+  void* sqe;
+  int ringfd;
+
+  uv_once(&once, uv__iou_detect);
+  if (uv__iou_disabled)
+    return NULL;
+
+  memset(&params, 0, sizeof(params));
+  ringfd = uv__io_uring_setup(UV__IOU_SQ_ENTRIES, &params);
+  if (ringfd == -1)
+    return NULL;
+
+  /* The submission and completion rings share a single mapping. */
+  sqlen = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+  cqlen = params.cq_off.cqes +
+          params.cq_entries * sizeof(struct uv__io_uring_cqe);
+  ringlen = sqlen > cqlen ? sqlen : cqlen;
+  sqelen = params.sq_entries * sizeof(struct uv__io_uring_sqe);
+
+  ring = mmap(NULL,
+              ringlen,
+              PROT_READ | PROT_WRITE,
+              MAP_SHARED | MAP_POPULATE,
+              ringfd,
+              UV__IORING_OFF_SQ_RING);
+
+  sqe = mmap(NULL,
+             sqelen,
+             PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE,
+             ringfd,
+             UV__IORING_OFF_SQES);
+
+  iou = NULL;
+  if (ring != MAP_FAILED && sqe != MAP_FAILED)
+    iou = uv__malloc(sizeof(*iou));
+
+  if (iou == NULL) {
+    if (ring != MAP_FAILED)
+      munmap(ring, ringlen);
+    if (sqe != MAP_FAILED)
+      munmap(sqe, sqelen);
+    uv__close(ringfd);
+    return NULL;
+  }
+
+  iou->sqhead = (uint32_t*) (ring + params.sq_off.head);
+  iou->sqtail = (uint32_t*) (ring + params.sq_off.tail);
+  iou->sqmask = *(uint32_t*) (ring + params.sq_off.ring_mask);
+  iou->cqhead = (uint32_t*) (ring + params.cq_off.head);
+  iou->cqtail = (uint32_t*) (ring + params.cq_off.tail);
+  iou->cqmask = *(uint32_t*) (ring + params.cq_off.ring_mask);
+  iou->cqe = (struct uv__io_uring_cqe*) (ring + params.cq_off.cqes);
+  iou->sqe = sqe;
+  iou->sqlocal = *iou->sqtail;
+  iou->cq_entries = params.cq_entries;
+  iou->in_flight = 0;
+  iou->ring = ring;
+  iou->ringlen = ringlen;
+  iou->sqelen = sqelen;
+
+  /* Slot i of the submission ring always refers to entry i of the sqe array,
+   * set up that identity mapping once.
+   */
+  sqarray = (uint32_t*) (ring + params.sq_off.array);
+  for (i = 0; i <= iou->sqmask; i++)
+    sqarray[i] = i;
+
+  uv__io_init(&iou->io_watcher, uv__iou_io, ringfd);
+  uv__io_start(loop, &iou->io_watcher, POLLIN);
+
+  return iou;
+}
+
+
+void uv__iou_delete(uv_loop_t* loop) {
+  struct uv__iou* iou;
+
+  iou = loop->io_uring;
+  loop->io_uring = NULL;
+
+  if (iou == NULL || iou == &uv__iou_unavailable)
+    return;
+
+  uv__io_stop(loop, &iou->io_watcher, POLLIN);
+  munmap(iou->sqe, iou->sqelen);
+  munmap(iou->ring, iou->ringlen);
+  uv__close(iou->io_watcher.fd);
+  uv__free(iou);
+}
+
+
+/* Submits all filled but unsubmitted entries.  Called from uv__io_poll()
+ * right before the loop blocks, so requests started from callbacks within
+ * the same loop iteration are batched into a single system call.  Returns
+ * non-zero when the kernel did not take all of them; the caller must not
+ * block then, nothing else would make it flush again.
+ */
+int uv__iou_flush(uv_loop_t* loop) {
+  struct uv__iou* iou;
+  uint32_t pending;
+  int rc;
+
+  iou = loop->io_uring;
+  if (iou == NULL || iou == &uv__iou_unavailable)
+    return 0;
+
+  /* Compare against the kernel's head, not the published tail, so entries
+   * that a previous io_uring_enter() failed to consume are retried.
+   */
+  pending = iou->sqlocal - __atomic_load_n(iou->sqhead, __ATOMIC_ACQUIRE);
+  if (pending == 0)
+    return 0;
+
+  __atomic_store_n(iou->sqtail, iou->sqlocal, __ATOMIC_RELEASE);
+
+  do
+    rc = uv__io_uring_enter(iou->io_watcher.fd, pending, 0, 0);
+  while (rc == -1 && errno == EINTR);
+
+  /* EAGAIN, EBUSY and ENOMEM are transient, the entries stay in the ring
+   * and are picked up by the next flush.  The kernel may also take only some
+   * of them.
+   */
+  if (rc == -1 && errno != EAGAIN && errno != EBUSY && errno != ENOMEM)
+    abort();
+
+  return iou->sqlocal != __atomic_load_n(iou->sqhead, __ATOMIC_ACQUIRE);
+}
+
+
+static struct uv__io_uring_sqe* uv__iou_get_sqe(uv_loop_t* loop,
+                                                uv_fs_t* req) {
+  struct uv__io_uring_sqe* sqe;
+  struct uv__iou* iou;
+  uint32_t head;
+
+  iou = loop->io_uring;
+  if (iou == NULL) {
+    iou = uv__iou_create(loop);
+    if (iou == NULL)
+      iou = &uv__iou_unavailable;
+    loop->io_uring = iou;
+  }
+
+  if (iou == &uv__iou_unavailable)
+    return NULL;
+
+  /* Leave it to the threadpool when all completion slots are spoken for,
+   * the kernel would have to queue the overflow otherwise.
+   */
+  if (iou->in_flight >= iou->cq_entries)
+    return NULL;
+
+  head = __atomic_load_n(iou->sqhead, __ATOMIC_ACQUIRE);
+  if (iou->sqlocal - head > iou->sqmask) {
+    uv__iou_flush(loop);
+    head = __atomic_load_n(iou->sqhead, __ATOMIC_ACQUIRE);
+    if (iou->sqlocal - head > iou->sqmask)
+      return NULL;
+  }
+
+  sqe = iou->sqe + (iou->sqlocal & iou->sqmask);
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->user_data = (uintptr_t) req;
+  iou->sqlocal++;
+  iou->in_flight++;
+
+  /* Pacify uv_cancel(), an empty work queue node makes it report that the
+   * request is already executing.
+   */
+  req->work_req.loop = loop;
+  req->work_req.work = NULL;
+  req->work_req.done = NULL;
+  QUEUE_INIT(&req->work_req.wq);
+
+  uv__req_register(loop, req);
+
+  return sqe;
+}
+
+
+int uv__iou_fs_close(uv_loop_t* loop, uv_fs_t* req) {
+  struct uv__io_uring_sqe* sqe;
+
+  sqe = uv__iou_get_sqe(loop, req);
+  if (sqe == NULL)
+    return 0;
+
+  sqe->fd = req->file;
+  sqe->opcode = UV__IORING_OP_CLOSE;
+
+  return 1;
+}
+
+
+int uv__iou_fs_fsync_or_fdatasync(uv_loop_t* loop,
+                                  uv_fs_t* req,
+                                  uint32_t fsync_flags) {
+  struct uv__io_uring_sqe* sqe;
+
+  sqe = uv__iou_get_sqe(loop, req);
+  if (sqe == NULL)
+    return 0;
+
+  sqe->fd = req->file;
+  sqe->fsync_flags = fsync_flags;
+  sqe->opcode = UV__IORING_OP_FSYNC;
+
+  return 1;
+}
+
+
+int uv__iou_fs_open(uv_loop_t* loop, uv_fs_t* req) {
+  struct uv__io_uring_sqe* sqe;
+
+  sqe = uv__iou_get_sqe(loop, req);
+  if (sqe == NULL)
+    return 0;
+
+  sqe->addr = (uintptr_t) req->path;
+  sqe->fd = UV__AT_FDCWD;
+  sqe->len = req->mode;
+  sqe->open_flags = req->flags | UV__O_CLOEXEC;
+  sqe->opcode = UV__IORING_OP_OPENAT;
+
+  return 1;
+}
+
+
+int uv__iou_fs_read_or_write(uv_loop_t* loop, uv_fs_t* req, int is_read) {
+  struct uv__io_uring_sqe* sqe;
+
+  /* The threadpool splits oversized requests into IOV_MAX sized chunks. */
+  if (req->nbufs > (unsigned int) uv__getiovmax())
+    return 0;
+
+  sqe = uv__iou_get_sqe(loop, req);
+  if (sqe == NULL)
+    return 0;
+
+  /* uv_buf_t is layout compatible with struct iovec. An offset of -1 makes
+   * the kernel use and update the file position like read(2) and write(2).
+   */
+  sqe->addr = (uintptr_t) req->bufs;
+  sqe->fd = req->file;
+  sqe->len = req->nbufs;
+  sqe->off = req->off < 0 ? (uint64_t) -1 : (uint64_t) req->off;
+  sqe->opcode = is_read ? UV__IORING_OP_READV : UV__IORING_OP_WRITEV;
+
+  return 1;
+}
+
+
+int uv__iou_fs_statx(uv_loop_t* loop,
+                     uv_fs_t* req,
+                     int is_fstat,
+                     int is_lstat) {
+  struct uv__io_uring_sqe* sqe;
+  struct uv__statx* statxbuf;
+
+  statxbuf = uv__malloc(sizeof(*statxbuf));
+  if (statxbuf == NULL)
+    return 0;
+
+  sqe = uv__iou_get_sqe(loop, req);
+  if (sqe == NULL) {
+    uv__free(statxbuf);
+    return 0;
+  }
+
+  sqe->addr = is_fstat ? (uintptr_t) "" : (uintptr_t) req->path;
+  sqe->addr2 = (uintptr_t) statxbuf;
+  sqe->fd = is_fstat ? req->file : UV__AT_FDCWD;
+  sqe->len = UV__STATX_BASIC_STATS;
+  sqe->opcode = UV__IORING_OP_STATX;
+
+  if (is_fstat)
+    sqe->statx_flags = UV__AT_EMPTY_PATH;
+  else if (is_lstat)
+    sqe->statx_flags = UV__AT_SYMLINK_NOFOLLOW;
+
+  req->ptr = statxbuf;
+
+  return 1;
+}
+
+
+/* Mirrors what uv__to_stat() produces for struct stat on Linux. */
+static void uv__statx_to_stat(const struct uv__statx* src, uv_stat_t* dst) {
+  dst->st_dev = makedev(src->stx_dev_major, src->stx_dev_minor);
+  dst->st_mode = src->stx_mode;
+  dst->st_nlink = src->stx_nlink;
+  dst->st_uid = src->stx_uid;
+  dst->st_gid = src->stx_gid;
+  dst->st_rdev = makedev(src->stx_rdev_major, src->stx_rdev_minor);
+  dst->st_ino = src->stx_ino;
+  dst->st_size = src->stx_size;
+  dst->st_blksize = src->stx_blksize;
+  dst->st_blocks = src->stx_blocks;
+  dst->st_atim.tv_sec = src->stx_atime.tv_sec;
+  dst->st_atim.tv_nsec = src->stx_atime.tv_nsec;
+  dst->st_mtim.tv_sec = src->stx_mtime.tv_sec;
+  dst->st_mtim.tv_nsec = src->stx_mtime.tv_nsec;
+  dst->st_ctim.tv_sec = src->stx_ctime.tv_sec;
+  dst->st_ctim.tv_nsec = src->stx_ctime.tv_nsec;
+  dst->st_birthtim.tv_sec = src->stx_ctime.tv_sec;
+  dst->st_birthtim.tv_nsec = src->stx_ctime.tv_nsec;
+  dst->st_flags = 0;
+  dst->st_gen = 0;
+}
+
+
+static void uv__iou_fs_done(uv_loop_t* loop, uv_fs_t* req, int32_t res) {
+  struct uv__statx* statxbuf;
+
+  uv__req_unregister(loop, req);
+
+  /* io_uring reports errors as negated errno values, same as libuv. */
+  req->result = res;
+
+  switch (req->fs_type) {
+  case UV_FS_READ:
+  case UV_FS_WRITE:
+    if (req->bufs != req->bufsml)
+      uv__free(req->bufs);
+    req->bufs = NULL;
+    req->nbufs = 0;
+    break;
+
+  case UV_FS_FSTAT:
+  case UV_FS_LSTAT:
+  case UV_FS_STAT:
+    statxbuf = req->ptr;
+    req->ptr = NULL;
+    if (res == 0) {
+      uv__statx_to_stat(statxbuf, &req->statbuf);
+      req->ptr = &req->statbuf;
+    }
+    uv__free(statxbuf);
+    break;
+
+  default:
+    break;
+  }
+
+  req->cb(req);
+}
+
+
+static void uv__iou_io(uv_loop_t* loop, uv__io_t* w, unsigned int events) {
+  struct uv__io_uring_cqe* cqe;
+  struct uv__iou* iou;
+  uv_fs_t* req;
+  uint32_t head;
+  uint32_t tail;
+  int32_t res;
+
+  iou = container_of(w, struct uv__iou, io_watcher);
+
+  head = *iou->cqhead;
+  tail = __atomic_load_n(iou->cqtail, __ATOMIC_ACQUIRE);
+
+  while (head != tail) {
+    cqe = iou->cqe + (head & iou->cqmask);
+    req = (uv_fs_t*) (uintptr_t) cqe->user_data;
+    res = cqe->res;
+
+    /* Hand the slot back before running the callback, it may start new
+     * requests of its own.
+     */
+    head++;
+    __atomic_store_n(iou->cqhead, head, __ATOMIC_RELEASE);
+    iou->in_flight--;
+
+    uv__iou_fs_done(loop, req, res);
+
+    if (head == tail)
+      tail = __atomic_load_n(iou->cqtail, __ATOMIC_ACQUIRE);
+  }
+}
@@ -183,6 +183,13 @@ void uv__loop_close(uv_loop_t* loop) {
 
 
 int uv__loop_configure(uv_loop_t* loop, uv_loop_option option, va_list ap) {
+#if defined(__linux__)
+  if (option == UV_METRICS_IDLE_TIME) {
+    loop->flags |= UV_LOOP_METRICS_IDLE_TIME;
+    return 0;
+  }
+#endif
+
   if (option != UV_LOOP_BLOCK_SIGNAL)
     return UV_ENOSYS;
 
@@ -192,3 +199,11 @@ int uv__loop_configure(uv_loop_t* loop, uv_loop_option option, va_list ap) {
   loop->flags |= UV_LOOP_BLOCK_SIGPROF;
   return 0;
 }
+
+
+#if !defined(__linux__)
+int uv_metrics_info(const uv_loop_t* loop, uv_metrics_t* metrics) {
+  memset(metrics, 0, sizeof(*metrics));
+  return UV_ENOSYS;
+}
+#endif
@@ -354,6 +354,12 @@ int uv_backend_fd(const uv_loop_t* loop) {
 }
 
 
+int uv_metrics_info(const uv_loop_t* loop, uv_metrics_t* metrics) {
+  memset(metrics, 0, sizeof(*metrics));
+  return UV_ENOSYS;
+}
+
+
 int uv_loop_fork(uv_loop_t* loop) {
   return UV_ENOSYS;
 }
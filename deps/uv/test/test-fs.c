@@ -2396,6 +2396,39 @@ TEST_IMPL(fs_stat_missing_path) {
 }
 
 
+static int stat_batch_cb_count;
+
+
+static void stat_batch_cb(uv_fs_t* req) {
+  ASSERT(req->fs_type == UV_FS_STAT);
+  ASSERT(req->result == 0);
+  ASSERT(req->ptr == &req->statbuf);
+  ASSERT(req->statbuf.st_size > 0);
+  uv_fs_req_cleanup(req);
+  stat_batch_cb_count++;
+}
+
+
+TEST_IMPL(fs_stat_batch_multiple) {
+  const char* path;
+  uv_fs_t req[300];
+  int i;
+
+  /* More requests than fit into a single submission batch. */
+  path = "test/fixtures/load_error.node";
+  loop = uv_default_loop();
+
+  for (i = 0; i < (int) ARRAY_SIZE(req); i++)
+    ASSERT(0 == uv_fs_stat(loop, req + i, path, stat_batch_cb));
+
+  ASSERT(0 == uv_run(loop, UV_RUN_DEFAULT));
+  ASSERT(stat_batch_cb_count == ARRAY_SIZE(req));
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
 TEST_IMPL(fs_scandir_empty_dir) {
   const char* path;
   uv_fs_t req;
@@ -0,0 +1,93 @@
+/* Copyright libuv project contributors. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "uv.h"
+#include "task.h"
+
+static int async_cb_called;
+
+
+static void timer_cb(uv_timer_t* handle) {
+  uv_close((uv_handle_t*) handle, NULL);
+}
+
+
+static void async_cb(uv_async_t* handle) {
+  async_cb_called++;
+  uv_close((uv_handle_t*) handle, NULL);
+}
+
+
+TEST_IMPL(metrics_idle_time) {
+#ifndef __linux__
+  RETURN_SKIP("Loop metrics are only implemented on Linux");
+#else
+  uv_timer_t timer_handle;
+  uv_metrics_t metrics;
+  uv_loop_t loop;
+
+  ASSERT(0 == uv_loop_init(&loop));
+  ASSERT(0 == uv_loop_configure(&loop, UV_METRICS_IDLE_TIME));
+  ASSERT(0 == uv_metrics_info(&loop, &metrics));
+  ASSERT(0 == metrics.loop_count);
+  ASSERT(0 == metrics.idle_time);
+
+  ASSERT(0 == uv_timer_init(&loop, &timer_handle));
+  ASSERT(0 == uv_timer_start(&timer_handle, timer_cb, 100, 0));
+  ASSERT(0 == uv_run(&loop, UV_RUN_DEFAULT));
+
+  ASSERT(0 == uv_metrics_info(&loop, &metrics));
+  ASSERT(metrics.loop_count > 0);
+  /* Allow for coarse timer granularity. */
+  ASSERT(metrics.idle_time >= 50 * 1000 * 1000);
+
+  ASSERT(0 == uv_loop_close(&loop));
+  return 0;
+#endif
+}
+
+
+TEST_IMPL(metrics_events) {
+#ifndef __linux__
+  RETURN_SKIP("Loop metrics are only implemented on Linux");
+#else
+  uv_async_t async_handle;
+  uv_metrics_t metrics;
+  uv_loop_t loop;
+
+  ASSERT(0 == uv_loop_init(&loop));
+  ASSERT(0 == uv_async_init(&loop, &async_handle, async_cb));
+  ASSERT(0 == uv_async_send(&async_handle));
+  ASSERT(0 == uv_run(&loop, UV_RUN_DEFAULT));
+  ASSERT(1 == async_cb_called);
+
+  /* Idle time is not tracked unless UV_METRICS_IDLE_TIME is set. */
+  ASSERT(0 == uv_metrics_info(&loop, &metrics));
+  ASSERT(metrics.loop_count > 0);
+  ASSERT(metrics.wakeups > 0);
+  ASSERT(metrics.events >= metrics.wakeups);
+  ASSERT(metrics.ctl_calls > 0);
+  ASSERT(0 == metrics.idle_time);
+
+  ASSERT(0 == uv_loop_close(&loop));
+  return 0;
+#endif
+}
@@ -74,3 +74,147 @@ TEST_IMPL(threadpool_queue_work_einval) {
   MAKE_VALGRIND_HAPPY();
   return 0;
 }
+
+
+static uv_work_t slow_io_reqs[4];
+static uv_work_t fast_io_req;
+static uv_sem_t slow_io_sem;
+static int slow_io_done_count;
+static int fast_io_done_count;
+
+
+static void slow_io_work_cb(uv_work_t* req) {
+  uv_sem_wait(&slow_io_sem);
+}
+
+
+static void slow_io_after_work_cb(uv_work_t* req, int status) {
+  ASSERT(status == 0);
+  ASSERT(fast_io_done_count == 1);
+  slow_io_done_count++;
+}
+
+
+static void fast_io_work_cb(uv_work_t* req) {
+  ASSERT(req == &fast_io_req);
+}
+
+
+static void fast_io_after_work_cb(uv_work_t* req, int status) {
+  size_t i;
+
+  ASSERT(status == 0);
+  ASSERT(slow_io_done_count == 0);
+  fast_io_done_count++;
+
+  for (i = 0; i < ARRAY_SIZE(slow_io_reqs); i++)
+    uv_sem_post(&slow_io_sem);
+}
+
+
+TEST_IMPL(threadpool_queue_work_ex) {
+  uv_loop_t* loop;
+  size_t i;
+
+  /* Slow I/O may only occupy half of the threads, so the fast request has to
+   * complete even though there is enough blocked slow work to exhaust the
+   * whole pool.
+   */
+  putenv("UV_THREADPOOL_SIZE=4");
+  ASSERT(0 == uv_sem_init(&slow_io_sem, 0));
+
+  loop = uv_default_loop();
+  for (i = 0; i < ARRAY_SIZE(slow_io_reqs); i++) {
+    ASSERT(0 == uv_queue_work_ex(loop,
+                                 slow_io_reqs + i,
+                                 UV_WORK_SLOW_IO,
+                                 slow_io_work_cb,
+                                 slow_io_after_work_cb));
+  }
+
+  ASSERT(0 == uv_queue_work_ex(loop,
+                               &fast_io_req,
+                               UV_WORK_FAST_IO,
+                               fast_io_work_cb,
+                               fast_io_after_work_cb));
+
+  ASSERT(0 == uv_run(loop, UV_RUN_DEFAULT));
+  ASSERT(fast_io_done_count == 1);
+  ASSERT(slow_io_done_count == ARRAY_SIZE(slow_io_reqs));
+
+  ASSERT(UV_EINVAL == uv_queue_work_ex(loop,
+                                       &fast_io_req,
+                                       (uv_work_kind) 42,
+                                       fast_io_work_cb,
+                                       fast_io_after_work_cb));
+  ASSERT(UV_EINVAL == uv_queue_work_ex(loop,
+                                       &fast_io_req,
+                                       UV_WORK_CPU,
+                                       NULL,
+                                       fast_io_after_work_cb));
+
+  uv_sem_destroy(&slow_io_sem);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
+static uv_work_t blocking_req;
+static uv_work_t short_reqs[256];
+static uv_sem_t blocking_sem;
+static int short_done_count;
+
+
+static void blocking_work_cb(uv_work_t* req) {
+  uv_sem_wait(&blocking_sem);
+}
+
+
+static void blocking_after_work_cb(uv_work_t* req, int status) {
+  ASSERT(status == 0);
+  ASSERT(short_done_count == ARRAY_SIZE(short_reqs));
+}
+
+
+static void short_work_cb(uv_work_t* req) {
+}
+
+
+static void short_after_work_cb(uv_work_t* req, int status) {
+  ASSERT(status == 0);
+  if (++short_done_count == ARRAY_SIZE(short_reqs))
+    uv_sem_post(&blocking_sem);
+}
+
+
+TEST_IMPL(threadpool_queue_work_busy_worker) {
+  uv_loop_t* loop;
+  size_t i;
+
+  /* Some of the short requests end up queued on the worker that is stuck on
+   * the blocking one, the others have to take them over.
+   */
+  putenv("UV_THREADPOOL_SIZE=4");
+  ASSERT(0 == uv_sem_init(&blocking_sem, 0));
+
+  loop = uv_default_loop();
+  ASSERT(0 == uv_queue_work(loop,
+                            &blocking_req,
+                            blocking_work_cb,
+                            blocking_after_work_cb));
+  for (i = 0; i < ARRAY_SIZE(short_reqs); i++) {
+    ASSERT(0 == uv_queue_work(loop,
+                              short_reqs + i,
+                              short_work_cb,
+                              short_after_work_cb));
+  }
+
+  ASSERT(0 == uv_run(loop, UV_RUN_DEFAULT));
+  ASSERT(short_done_count == ARRAY_SIZE(short_reqs));
+
+  uv_sem_destroy(&blocking_sem);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
@@ -0,0 +1,155 @@
+/* Copyright Joyent, Inc. and other Node contributors. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "uv.h"
+#include "task.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CHECK_HANDLE(handle) \
+  ASSERT((uv_udp_t*)(handle) == &recver || (uv_udp_t*)(handle) == &sender)
+
+#define NUM_SENDS 100
+#define BUFFER_MULTIPLIER 4
+#define MAX_DGRAM_SIZE (64 * 1024)
+
+static uv_udp_t recver;
+static uv_udp_t sender;
+static uv_udp_send_t send_reqs[NUM_SENDS];
+static int send_cb_called;
+static int recv_cb_called;
+static int chunk_cb_called;
+static int free_cb_called;
+static int close_cb_called;
+static int alloc_cb_called;
+
+
+static void alloc_cb(uv_handle_t* handle,
+                     size_t suggested_size,
+                     uv_buf_t* buf) {
+  static char slab[BUFFER_MULTIPLIER * MAX_DGRAM_SIZE];
+  CHECK_HANDLE(handle);
+  ASSERT(suggested_size <= MAX_DGRAM_SIZE);
+  alloc_cb_called++;
+  buf->base = slab;
+  buf->len = sizeof(slab);
+}
+
+
+static void close_cb(uv_handle_t* handle) {
+  CHECK_HANDLE(handle);
+  close_cb_called++;
+}
+
+
+static void send_cb(uv_udp_send_t* req, int status) {
+  ASSERT(req != NULL);
+  ASSERT(status == 0);
+  CHECK_HANDLE(req->handle);
+  send_cb_called++;
+}
+
+
+static void recv_cb(uv_udp_t* handle,
+                    ssize_t nread,
+                    const uv_buf_t* rcvbuf,
+                    const struct sockaddr* addr,
+                    unsigned flags) {
+  CHECK_HANDLE(handle);
+  ASSERT(nread >= 0);
+
+  if (flags & UV_UDP_MMSG_FREE) {
+    ASSERT(nread == 0);
+    ASSERT(addr == NULL);
+    free_cb_called++;
+    return;
+  }
+
+  /* Nothing was read. */
+  if (nread == 0) {
+    ASSERT(addr == NULL);
+    return;
+  }
+
+  if (flags & UV_UDP_MMSG_CHUNK)
+    chunk_cb_called++;
+
+  ASSERT(addr != NULL);
+  ASSERT(nread == 4);
+  ASSERT(!memcmp("PING", rcvbuf->base, nread));
+
+  if (++recv_cb_called == NUM_SENDS) {
+    uv_close((uv_handle_t*) handle, close_cb);
+    uv_close((uv_handle_t*) &sender, close_cb);
+  }
+}
+
+
+TEST_IMPL(udp_mmsg) {
+  struct sockaddr_in addr;
+  uv_buf_t buf;
+  int i;
+
+  ASSERT(0 == uv_ip4_addr("127.0.0.1", TEST_PORT, &addr));
+
+  ASSERT(0 == uv_udp_init_ex(uv_default_loop(),
+                             &recver,
+                             AF_UNSPEC | UV_UDP_RECVMMSG));
+  ASSERT(0 == uv_udp_bind(&recver, (const struct sockaddr*) &addr, 0));
+  ASSERT(0 == uv_udp_recv_start(&recver, alloc_cb, recv_cb));
+
+  ASSERT(0 == uv_udp_init(uv_default_loop(), &sender));
+
+  /* All but the first datagram are queued and go out in batches. */
+  buf = uv_buf_init("PING", 4);
+  for (i = 0; i < NUM_SENDS; i++)
+    ASSERT(0 == uv_udp_send(send_reqs + i,
+                            &sender,
+                            &buf,
+                            1,
+                            (const struct sockaddr*) &addr,
+                            send_cb));
+
+  ASSERT(0 == uv_run(uv_default_loop(), UV_RUN_DEFAULT));
+
+  ASSERT(2 == close_cb_called);
+  ASSERT(NUM_SENDS == send_cb_called);
+  ASSERT(NUM_SENDS == recv_cb_called);
+
+#if defined(__linux__)
+  /* Every datagram came in through recvmmsg() and every batch freed its
+   * buffer, unless the kernel is too old to support it.
+   */
+  if (chunk_cb_called != 0) {
+    ASSERT(NUM_SENDS == chunk_cb_called);
+    ASSERT(free_cb_called > 0);
+    ASSERT(free_cb_called <= alloc_cb_called);
+  }
+#else
+  ASSERT(0 == chunk_cb_called);
+  ASSERT(0 == free_cb_called);
+#endif
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
@@ -57,6 +57,7 @@
         'test-loop-stop.c',
         'test-loop-time.c',
         'test-loop-configure.c',
+        'test-metrics.c',
         'test-walk-handles.c',
         'test-watcher-cross-stop.c',
         'test-multiple-listen.c',
@@ -142,6 +143,7 @@
         'test-udp-send-hang-loop.c',
         'test-udp-send-immediate.c',
         'test-udp-send-unreachable.c',
+        'test-udp-mmsg.c',
         'test-udp-multicast-join.c',
         'test-udp-multicast-join6.c',
         'test-dlerror.c',
@@ -6,6 +6,8 @@
 /* @(#) $Id$ */
 
 #include "zutil.h"
+#include "adler32_simd.h"
+#include "cpu_features.h"
 
 local uLong adler32_combine_ OF((uLong adler1, uLong adler2, z_off64_t len2));
 
@@ -87,6 +89,14 @@ uLong ZEXPORT adler32_z(adler, buf, len)
     if (buf == Z_NULL)
         return 1L;
 
+#ifdef ADLER32_SIMD_SSSE3
+    if (len >= Z_ADLER32_SIMD_MINIMUM_LENGTH) {
+        cpu_check_features();
+        if (x86_cpu_enable_ssse3)
+            return adler32_simd_((uint32_t)(adler | (sum2 << 16)), buf, len);
+    }
+#endif
+
     /* in case short lengths are provided, keep it somewhat fast */
     if (len < 16) {
         while (len--) {
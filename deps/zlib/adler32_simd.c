@@ -0,0 +1,105 @@
+/* adler32_simd.c -- Adler-32 checksum using SSSE3.
+ *
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * The data is processed in blocks of 32 bytes. For each block, s1 grows by
+ * the sum of its bytes, and s2 by 32 times the s1 before the block plus the
+ * sum of the bytes weighted by [32, 31, ..., 1]. The vector code computes
+ * these sums for up to NMAX bytes before reducing s1 and s2 modulo BASE.
+ */
+
+#include "adler32_simd.h"
+
+#if defined(ADLER32_SIMD_SSSE3)
+
+#include <tmmintrin.h>
+
+#if defined(_MSC_VER)
+#  define Z_TARGET_SSSE3
+#else
+#  define Z_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+
+#define BASE 65521U     /* largest prime smaller than 65536 */
+#define NMAX 5552
+/* NMAX is the largest n such that 255n(n+1)/2 + (n+1)(BASE-1) <= 2^32-1 */
+
+Z_TARGET_SSSE3
+uint32_t ZLIB_INTERNAL adler32_simd_(uint32_t adler,
+                                     const unsigned char *buf,
+                                     z_size_t len)
+{
+    uint32_t s1 = adler & 0xffff;
+    uint32_t s2 = adler >> 16;
+
+    const unsigned block_size = 1 << 5;
+    z_size_t blocks = len / block_size;
+    len -= blocks * block_size;
+
+    while (blocks) {
+        const __m128i tap1 = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25,
+                                           24, 23, 22, 21, 20, 19, 18, 17);
+        const __m128i tap2 = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9,
+                                           8, 7, 6, 5, 4, 3, 2, 1);
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i ones = _mm_set1_epi16(1);
+        __m128i v_ps, v_s1, v_s2;
+
+        /* At most NMAX bytes can be processed before s2 has to be reduced. */
+        unsigned n = NMAX / block_size;
+        if (n > blocks)
+            n = (unsigned)blocks;
+        blocks -= n;
+
+        /* v_ps accumulates the s1 values before each block. */
+        v_ps = _mm_set_epi32(0, 0, 0, (int)(s1 * n));
+        v_s2 = _mm_set_epi32(0, 0, 0, (int)s2);
+        v_s1 = _mm_setzero_si128();
+
+        do {
+            const __m128i bytes1 = _mm_loadu_si128((const __m128i *)buf);
+            const __m128i bytes2 = _mm_loadu_si128((const __m128i *)(buf + 16));
+            __m128i mad1, mad2;
+
+            v_ps = _mm_add_epi32(v_ps, v_s1);
+
+            /* Sum the bytes horizontally for s1, and multiply them by the
+             * taps and sum them for s2. */
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(bytes1, zero));
+            mad1 = _mm_maddubs_epi16(bytes1, tap1);
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(mad1, ones));
+
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(bytes2, zero));
+            mad2 = _mm_maddubs_epi16(bytes2, tap2);
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(mad2, ones));
+
+            buf += block_size;
+        } while (--n);
+
+        v_s2 = _mm_add_epi32(v_s2, _mm_slli_epi32(v_ps, 5));
+
+        /* Add up the lanes of v_s1 and v_s2. */
+        v_s1 = _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, _MM_SHUFFLE(1, 0, 3, 2)));
+        s1 += (uint32_t)_mm_cvtsi128_si32(v_s1);
+
+        v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(2, 3, 0, 1)));
+        v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(1, 0, 3, 2)));
+        s2 = (uint32_t)_mm_cvtsi128_si32(v_s2);
+
+        s1 %= BASE;
+        s2 %= BASE;
+    }
+
+    /* Fewer than 32 bytes are left. */
+    while (len--) {
+        s1 += *buf++;
+        s2 += s1;
+    }
+    if (s1 >= BASE)
+        s1 -= BASE;
+    s2 %= BASE;
+
+    return s1 | (s2 << 16);
+}
+
+#endif /* ADLER32_SIMD_SSSE3 */
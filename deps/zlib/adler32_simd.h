@@ -0,0 +1,21 @@
+/* adler32_simd.h
+ *
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifndef ADLER32_SIMD_H
+#define ADLER32_SIMD_H
+
+#include <stdint.h>
+
+#include "zconf.h"
+#include "zutil.h"
+
+uint32_t ZLIB_INTERNAL adler32_simd_ OF((uint32_t adler,
+                                         const unsigned char *buf,
+                                         z_size_t len));
+
+/* Shorter inputs are not worth setting up the vector registers for. */
+#define Z_ADLER32_SIMD_MINIMUM_LENGTH 64
+
+#endif /* ADLER32_SIMD_H */
@@ -0,0 +1,84 @@
+/* cpu_features.c -- Processor features detection.
+ *
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "cpu_features.h"
+
+#if defined(X86_CPU_FEATURES)
+#  if defined(_MSC_VER)
+#    include <intrin.h>
+#  else
+#    include <cpuid.h>
+#  endif
+#endif
+
+#if defined(_WIN32)
+#  include <windows.h>
+#else
+#  include <pthread.h>
+#endif
+
+int ZLIB_INTERNAL x86_cpu_enable_ssse3 = 0;
+int ZLIB_INTERNAL x86_cpu_enable_simd = 0;
+
+local void check_features OF((void));
+
+#if defined(_WIN32)
+static INIT_ONCE cpu_check_inited_once = INIT_ONCE_STATIC_INIT;
+
+local BOOL CALLBACK check_features_once(PINIT_ONCE once, PVOID param,
+                                        PVOID *context)
+{
+    (void)once;
+    (void)param;
+    (void)context;
+    check_features();
+    return TRUE;
+}
+
+void ZLIB_INTERNAL cpu_check_features(void)
+{
+    InitOnceExecuteOnce(&cpu_check_inited_once, check_features_once,
+                        NULL, NULL);
+}
+#else
+static pthread_once_t cpu_check_inited_once = PTHREAD_ONCE_INIT;
+
+void ZLIB_INTERNAL cpu_check_features(void)
+{
+    pthread_once(&cpu_check_inited_once, check_features);
+}
+#endif
+
+local void check_features(void)
+{
+#if defined(X86_CPU_FEATURES)
+    unsigned regs[4];
+    int has_sse2, has_ssse3, has_sse42, has_pclmulqdq;
+
+#  if defined(_MSC_VER)
+    __cpuid((int *)regs, 1);
+#  else
+    if (!__get_cpuid(1, &regs[0], &regs[1], &regs[2], &regs[3]))
+        return;
+#  endif
+
+    /* regs[2] is ecx, regs[3] is edx. */
+    has_sse2 = (regs[3] & (1u << 26)) != 0;
+    has_ssse3 = (regs[2] & (1u << 9)) != 0;
+    has_sse42 = (regs[2] & (1u << 20)) != 0;
+    has_pclmulqdq = (regs[2] & (1u << 1)) != 0;
+
+#  if defined(ADLER32_SIMD_SSSE3)
+    x86_cpu_enable_ssse3 = has_sse2 && has_ssse3;
+#  endif
+#  if defined(CRC32_SIMD_SSE42_PCLMUL)
+    x86_cpu_enable_simd = has_sse2 && has_sse42 && has_pclmulqdq;
+#  endif
+    (void)has_sse2;
+    (void)has_ssse3;
+    (void)has_sse42;
+    (void)has_pclmulqdq;
+#endif
+}
@@ -0,0 +1,28 @@
+/* cpu_features.h -- Processor features detection.
+ *
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifndef CPU_FEATURES_H
+#define CPU_FEATURES_H
+
+#include "zutil.h"
+
+#if defined(__x86_64__) || defined(__i386__) || \
+    defined(_M_X64) || defined(_M_IX86)
+#  define X86_CPU_FEATURES
+#endif
+
+/* Set by cpu_check_features(), which has to be called first. They are only
+ * ever set on x86 processors, and only when the code that uses the feature
+ * has been compiled in.
+ */
+extern int ZLIB_INTERNAL x86_cpu_enable_ssse3;
+extern int ZLIB_INTERNAL x86_cpu_enable_simd;
+
+/* Detects the features of the processor. This is cheap to call repeatedly,
+ * and safe to call from multiple threads.
+ */
+void ZLIB_INTERNAL cpu_check_features OF((void));
+
+#endif /* CPU_FEATURES_H */
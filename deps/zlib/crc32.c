@@ -29,6 +29,8 @@
 #endif /* MAKECRCH */
 
 #include "zutil.h"      /* for STDC and FAR definitions */
+#include "cpu_features.h"
+#include "crc32_simd.h"
 
 /* Definitions for doing the crc four data bytes at a time. */
 #if !defined(NOBYFOUR) && defined(Z_U4)
@@ -211,6 +213,23 @@ unsigned long ZEXPORT crc32_z(crc, buf, len)
         make_crc_table();
 #endif /* DYNAMIC_CRC_TABLE */
 
+#ifdef CRC32_SIMD_SSE42_PCLMUL
+    if (len >= Z_CRC32_SSE42_MINIMUM_LENGTH) {
+        cpu_check_features();
+        if (x86_cpu_enable_simd) {
+            /* Use the vector code for the multiple of 16 bytes, and the
+             * table driven code for what is left. */
+            z_size_t chunk_size = len & ~(z_size_t)Z_CRC32_SSE42_CHUNKSIZE_MASK;
+            crc = ~crc32_sse42_simd_(buf, chunk_size, ~(uint32_t)crc);
+            crc &= 0xffffffffUL;
+            len -= chunk_size;
+            if (len == 0)
+                return crc;
+            buf += chunk_size;
+        }
+    }
+#endif /* CRC32_SIMD_SSE42_PCLMUL */
+
 #ifdef BYFOUR
     if (sizeof(void *) == sizeof(ptrdiff_t)) {
         z_crc_t endian;
@@ -0,0 +1,25 @@
+/* crc32_simd.h
+ *
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifndef CRC32_SIMD_H
+#define CRC32_SIMD_H
+
+#include <stdint.h>
+
+#include "zconf.h"
+#include "zutil.h"
+
+/* crc32_sse42_simd_() takes the crc without the pre- and post-conditioning
+ * that crc32() applies, and requires len >= Z_CRC32_SSE42_MINIMUM_LENGTH
+ * and len a multiple of Z_CRC32_SSE42_CHUNKSIZE_MASK + 1.
+ */
+uint32_t ZLIB_INTERNAL crc32_sse42_simd_ OF((const unsigned char *buf,
+                                             z_size_t len,
+                                             uint32_t crc));
+
+#define Z_CRC32_SSE42_MINIMUM_LENGTH 64
+#define Z_CRC32_SSE42_CHUNKSIZE_MASK 15
+
+#endif /* CRC32_SIMD_H */
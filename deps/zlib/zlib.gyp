@@ -15,6 +15,8 @@
           'sources': [
             'adler32.c',
             'compress.c',
+            'cpu_features.c',
+            'cpu_features.h',
             'crc32.c',
             'crc32.h',
             'deflate.c',
@@ -49,6 +51,20 @@
             ],
           },
           'conditions': [
+            ['target_arch=="ia32" or target_arch=="x64"', {
+              # The vectorized checksums are only used when cpu_features.c
+              # detects support for the instructions at runtime.
+              'defines': [
+                'ADLER32_SIMD_SSSE3',
+                'CRC32_SIMD_SSE42_PCLMUL',
+              ],
+              'sources': [
+                'adler32_simd.c',
+                'adler32_simd.h',
+                'crc32_simd.c',
+                'crc32_simd.h',
+              ],
+            }],
             ['OS!="win"', {
               'cflags!': [ '-ansi' ],
               'defines': [ 'Z_HAVE_UNISTD_H', 'HAVE_HIDDEN' ],
@@ -25,6 +25,8 @@ const { methods, HTTPParser } = process.binding('http_parser');
 
 const FreeList = require('internal/freelist');
 const { ondrain } = require('internal/http');
+const { validateInteger } = require('internal/validators');
+const { ERR_OUT_OF_RANGE } = require('internal/errors').codes;
 const incoming = require('_http_incoming');
 const {
   IncomingMessage,
@@ -173,6 +175,25 @@ const parsers = new FreeList('parsers', 1000, function() {
 
 function closeParserInstance(parser) { parser.close(); }
 
+function setParserPoolSize(max) {
+  validateInteger(max, 'max');
+  if (max < 0)
+    throw new ERR_OUT_OF_RANGE('max', '>= 0', max);
+  // Pooled parsers have run their destroy() hooks in freeParser() already,
+  // close() does not run them again.
+  parsers.setMax(max).forEach(closeParserInstance);
+}
+
+function getParserPoolStats() {
+  return {
+    max: parsers.max,
+    size: parsers.list.length,
+    created: parsers.created,
+    reused: parsers.reused,
+    discarded: parsers.discarded
+  };
+}
+
 // Free the parser and also break any links that it
 // might have to any other things.
 // TODO: All parser data should be attached to a
@@ -246,8 +267,10 @@ module.exports = {
   CRLF: '\r\n',
   debug,
   freeParser,
+  getParserPoolStats,
   httpSocketSetup,
   methods,
   parsers,
+  setParserPoolSize,
   kIncomingMessage
 };
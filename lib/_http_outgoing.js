@@ -30,6 +30,7 @@ const { Buffer } = require('buffer');
 const common = require('_http_common');
 const checkIsHttpToken = common._checkIsHttpToken;
 const checkInvalidHeaderChar = common._checkInvalidHeaderChar;
+const { serializeHead } = process.binding('http_parser');
 const {
   defaultTriggerAsyncIdScope,
   symbols: { async_id_symbol }
@@ -216,6 +217,10 @@ OutgoingMessage.prototype._send = function _send(data, encoding, callback) {
     if (typeof data === 'string' &&
         (encoding === 'utf8' || encoding === 'latin1' || !encoding)) {
       data = this._header + data;
+    } else if (this.output.length === 0 && isWritable(this)) {
+      // The connection is corked by write() and end(), so the head and the
+      // body still go out in a single writev.
+      this._writeRaw(this._header, 'latin1', null);
     } else {
       var header = this._header;
       if (this.output.length === 0) {
@@ -236,6 +241,14 @@ OutgoingMessage.prototype._send = function _send(data, encoding, callback) {
 };
 
 
+// Whether data passed to _writeRaw() goes straight to the connection.
+function isWritable(msg) {
+  const conn = msg.connection;
+  return conn && conn._httpMessage === msg && conn.writable &&
+         !conn.destroyed;
+}
+
+
 OutgoingMessage.prototype._writeRaw = _writeRaw;
 function _writeRaw(data, encoding, callback) {
   const conn = this.connection;
@@ -250,7 +263,7 @@ function _writeRaw(data, encoding, callback) {
     encoding = null;
   }
 
-  if (conn && conn._httpMessage === this && conn.writable && !conn.destroyed) {
+  if (isWritable(this)) {
     // There might be pending data in the this.output buffer.
     if (this.output.length) {
       this._flushOutput(conn);
@@ -291,7 +304,9 @@ function _storeHeader(firstLine, headers) {
     date: false,
     expect: false,
     trailer: false,
-    header: firstLine
+    // Flat list of [name, value, name, value, ...], turned into the actual
+    // head of the message by serializeHead() once it is complete.
+    fields: []
   };
 
   var key;
@@ -313,11 +328,11 @@ function _storeHeader(firstLine, headers) {
     }
   }
 
-  let { header } = state;
+  const { fields } = state;
 
   // Date header
   if (this.sendDate && !state.date) {
-    header += 'Date: ' + utcDate() + CRLF;
+    fields.push('Date', utcDate());
   }
 
   // Force the connection to close when the response is a 204 No Content or
@@ -347,10 +362,10 @@ function _storeHeader(firstLine, headers) {
     const shouldSendKeepAlive = this.shouldKeepAlive &&
         (state.contLen || this.useChunkedEncodingByDefault || this.agent);
     if (shouldSendKeepAlive) {
-      header += 'Connection: keep-alive\r\n';
+      fields.push('Connection', 'keep-alive');
     } else {
       this._last = true;
-      header += 'Connection: close\r\n';
+      fields.push('Connection', 'close');
     }
   }
 
@@ -363,9 +378,9 @@ function _storeHeader(firstLine, headers) {
     } else if (!state.trailer &&
                !this._removedContLen &&
                typeof this._contentLength === 'number') {
-      header += 'Content-Length: ' + this._contentLength + CRLF;
+      fields.push('Content-Length', '' + this._contentLength);
     } else if (!this._removedTE) {
-      header += 'Transfer-Encoding: chunked\r\n';
+      fields.push('Transfer-Encoding', 'chunked');
       this.chunkedEncoding = true;
     } else {
       // We should only be able to get here if both Content-Length and
@@ -383,7 +398,9 @@ function _storeHeader(firstLine, headers) {
     throw new ERR_HTTP_TRAILER_INVALID();
   }
 
-  this._header = header + CRLF;
+  this._header = serializeHead(firstLine, fields);
+  if (this._header === undefined)
+    this._header = joinHead(firstLine, fields);
   this._headerSent = false;
 
   // wait until the first body chunk, or close(), is sent to flush,
@@ -391,6 +408,15 @@ function _storeHeader(firstLine, headers) {
   if (state.expect) this._send('');
 }
 
+// Slow path for serializeHead(), used when the head contains characters that
+// do not fit into a single byte.
+function joinHead(firstLine, fields) {
+  let header = firstLine;
+  for (var i = 0; i < fields.length; i += 2)
+    header += fields[i] + ': ' + escapeHeaderValue(fields[i + 1]) + CRLF;
+  return header + CRLF;
+}
+
 function processHeader(self, state, key, value, validate) {
   if (validate)
     validateHeaderName(key);
@@ -408,7 +434,7 @@ function processHeader(self, state, key, value, validate) {
 function storeHeader(self, state, key, value, validate) {
   if (validate)
     validateHeaderValue(key, value);
-  state.header += key + ': ' + escapeHeaderValue(value) + CRLF;
+  state.fields.push(key, '' + value);
   matchHeader(self, state, key, value);
 }
 
@@ -23,6 +23,7 @@
 
 const { parseCertString } = require('internal/tls');
 const { isArrayBufferView } = require('internal/util/types');
+const { validateInt32 } = require('internal/validators');
 const tls = require('tls');
 const {
   ERR_CRYPTO_CUSTOM_ENGINE_NOT_SUPPORTED,
@@ -177,6 +178,23 @@ exports.createSecureContext = function createSecureContext(options, context) {
     c.context.setSessionIdContext(options.sessionIdContext);
   }
 
+  if (options.sessionCache) {
+    const {
+      name = 'default',
+      size = 20 * 1024,
+      shards = 16,
+      timeout = 0
+    } = options.sessionCache === true ? {} : options.sessionCache;
+    if (typeof name !== 'string') {
+      throw new ERR_INVALID_ARG_TYPE('options.sessionCache.name', 'string',
+                                     name);
+    }
+    validateInt32(size, 'options.sessionCache.size', 1);
+    validateInt32(shards, 'options.sessionCache.shards', 1, 1024);
+    validateInt32(timeout, 'options.sessionCache.timeout', 0);
+    c.context.enableSessionCache(name, shards, size, timeout);
+  }
+
   if (options.pfx) {
     if (!crypto)
       crypto = require('crypto');
@@ -204,6 +222,9 @@ exports.createSecureContext = function createSecureContext(options, context) {
     }
   }
 
+  if (options.asyncPrivateKey)
+    c.context.enableAsyncPrivateKey();
+
   // Do not keep read/write buffers in free list for OpenSSL < 1.1.0. (For
   // OpenSSL 1.1.0, buffers are malloced and freed without the use of a
   // freelist.)
@@ -878,7 +878,9 @@ function Server(options, listener) {
     secureOptions: this.secureOptions,
     honorCipherOrder: this.honorCipherOrder,
     crl: this.crl,
-    sessionIdContext: this.sessionIdContext
+    sessionIdContext: this.sessionIdContext,
+    sessionCache: this.sessionCache,
+    asyncPrivateKey: this.asyncPrivateKey
   });
 
   this[kHandshakeTimeout] = options.handshakeTimeout || (120 * 1000);
@@ -939,6 +941,22 @@ Server.prototype.setTicketKeys = function setTicketKeys(keys) {
 };
 
 
+Server.prototype.getSessionCacheStats = function getSessionCacheStats() {
+  const stats = this._sharedCreds.context.getSessionCacheStats();
+  if (stats === undefined)
+    return undefined;
+  const [hits, misses, stores, evictions, size] = stats;
+  return { hits, misses, stores, evictions, size };
+};
+
+
+Server.prototype.getBufferMemoryStats = function getBufferMemoryStats() {
+  const [used, peak, buffers, pooled] =
+    this._sharedCreds.context.getBufferMemoryStats();
+  return { used, peak, buffers, pooled };
+};
+
+
 Server.prototype.setOptions = function(options) {
   this.requestCert = options.requestCert === true;
   this.rejectUnauthorized = options.rejectUnauthorized !== false;
@@ -957,6 +975,8 @@ Server.prototype.setOptions = function(options) {
     this.ecdhCurve = options.ecdhCurve;
   if (options.dhparam) this.dhparam = options.dhparam;
   if (options.sessionTimeout) this.sessionTimeout = options.sessionTimeout;
+  if (options.sessionCache) this.sessionCache = options.sessionCache;
+  if (options.asyncPrivateKey) this.asyncPrivateKey = true;
   if (options.ticketKeys) this.ticketKeys = options.ticketKeys;
   var secureOptions = options.secureOptions || 0;
   if (options.honorCipherOrder !== undefined)
@@ -77,7 +77,9 @@ const {
 } = require('internal/crypto/sig');
 const {
   Hash,
-  Hmac
+  Hmac,
+  hash,
+  hashSync
 } = require('internal/crypto/hash');
 const {
   getCiphers,
@@ -155,6 +157,8 @@ module.exports = exports = {
   getCurves,
   getDiffieHellman: createDiffieHellmanGroup,
   getHashes,
+  hash,
+  hashSync,
   pbkdf2,
   pbkdf2Sync,
   privateDecrypt,
@@ -37,6 +37,7 @@ const {
 const { Buffer } = require('buffer');
 const util = require('util');
 const { isUint8Array } = require('internal/util/types');
+const { validateInt32 } = require('internal/validators');
 const EventEmitter = require('events');
 const {
   defaultTriggerAsyncIdScope,
@@ -56,6 +57,9 @@ const BIND_STATE_BOUND = 2;
 const RECV_BUFFER = true;
 const SEND_BUFFER = false;
 
+// libuv reads at most this many datagrams per recvmmsg() call.
+const kMaxRecvBatchSize = 20;
+
 // Lazily loaded
 var cluster = null;
 
@@ -73,7 +77,7 @@ function lookup6(lookup, address, callback) {
 }
 
 
-function newHandle(type, lookup) {
+function newHandle(type, lookup, recvBatchSize) {
   if (lookup === undefined) {
     if (dns === undefined) dns = require('dns');
     lookup = dns.lookup;
@@ -81,13 +85,13 @@ function newHandle(type, lookup) {
     throw new ERR_INVALID_ARG_TYPE('lookup', 'Function', lookup);
 
   if (type === 'udp4') {
-    const handle = new UDP();
+    const handle = new UDP(recvBatchSize);
     handle.lookup = lookup4.bind(handle, lookup);
     return handle;
   }
 
   if (type === 'udp6') {
-    const handle = new UDP();
+    const handle = new UDP(recvBatchSize);
     handle.lookup = lookup6.bind(handle, lookup);
     handle.bind = handle.bind6;
     handle.send = handle.send6;
@@ -120,6 +124,7 @@ const kOptionSymbol = Symbol('options symbol');
 function Socket(type, listener) {
   EventEmitter.call(this);
   var lookup;
+  var recvBatchSize;
 
   this[kOptionSymbol] = {};
   if (type !== null && typeof type === 'object') {
@@ -128,9 +133,14 @@ function Socket(type, listener) {
     lookup = options.lookup;
     this[kOptionSymbol].recvBufferSize = options.recvBufferSize;
     this[kOptionSymbol].sendBufferSize = options.sendBufferSize;
+    recvBatchSize = options.recvBatchSize;
+    if (recvBatchSize !== undefined) {
+      validateInt32(recvBatchSize, 'options.recvBatchSize',
+                    1, kMaxRecvBatchSize);
+    }
   }
 
-  var handle = newHandle(type, lookup);
+  var handle = newHandle(type, lookup, recvBatchSize);
   handle.owner = this;
 
   this._handle = handle;
@@ -156,6 +166,7 @@ function createSocket(type, listener) {
 
 function startListening(socket) {
   socket._handle.onmessage = onMessage;
+  socket._handle.onmessagebatch = onMessageBatch;
   // Todo: handle errors
   socket._handle.recvStart();
   socket._receiving = true;
@@ -674,6 +685,20 @@ function onMessage(nread, handle, buf, rinfo) {
 }
 
 
+// Datagrams received by a single recvmmsg() call, stored back to back in
+// `buf`. Each `rinfo.size` holds the length of the matching datagram.
+function onMessageBatch(count, handle, buf, rinfos) {
+  var self = handle.owner;
+  var offset = 0;
+  for (var i = 0; i < count && self._receiving; i++) {
+    const rinfo = rinfos[i];
+    const end = offset + rinfo.size;
+    self.emit('message', buf.slice(offset, end), rinfo);
+    offset = end;
+  }
+}
+
+
 Socket.prototype.ref = function() {
   if (this._handle)
     this._handle.ref();
@@ -23,7 +23,11 @@
 
 const { Agent, globalAgent } = require('_http_agent');
 const { ClientRequest } = require('_http_client');
-const { methods } = require('_http_common');
+const {
+  getParserPoolStats,
+  methods,
+  setParserPoolSize
+} = require('_http_common');
 const { IncomingMessage } = require('_http_incoming');
 const { OutgoingMessage } = require('_http_outgoing');
 const {
@@ -60,5 +64,7 @@ module.exports = {
   ServerResponse,
   createServer,
   get,
-  request
+  getParserPoolStats,
+  request,
+  setParserPoolSize
 };
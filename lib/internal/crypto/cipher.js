@@ -6,16 +6,21 @@ const {
 } = process.binding('constants').crypto;
 
 const {
+  ERR_BUFFER_OUT_OF_BOUNDS,
   ERR_CRYPTO_INVALID_STATE,
   ERR_INVALID_ARG_TYPE,
+  ERR_INVALID_CALLBACK,
   ERR_INVALID_OPT_VALUE
 } = require('internal/errors').codes;
+const { validateInt32 } = require('internal/validators');
+const { AsyncWrap, Providers } = process.binding('async_wrap');
 
 const {
   getDefaultEncoding,
   toBuf
 } = require('internal/crypto/util');
 
+const { Buffer } = require('buffer');
 const { isArrayBufferView } = require('internal/util/types');
 
 const {
@@ -35,6 +40,16 @@ const { normalizeEncoding } = require('internal/util');
 // Lazy loaded for startup performance.
 let StringDecoder;
 
+const kAsync = Symbol('async');
+const kPending = Symbol('pending');
+
+// Chunks smaller than this are always processed on the main thread, because
+// for them the round trip to the threadpool costs more than the cipher itself.
+const kMinAsyncCipherSize = 16 * 1024;
+// The output of update() is never larger than its input plus one block
+// (EVP_MAX_BLOCK_LENGTH).
+const kMaxBlockLength = 32;
+
 function rsaFunctionFor(method, defaultPadding) {
   return function(options, buffer) {
     const key = options.key || options;
@@ -78,6 +93,8 @@ function createCipherBase(cipher, credential, options, decipher, iv) {
     this._handle.initiv(cipher, credential, iv, authTagLength);
   }
   this._decoder = null;
+  this[kAsync] = options != null && options.async === true;
+  this[kPending] = false;
 
   LazyTransform.call(this, options);
 }
@@ -131,7 +148,37 @@ function Cipher(cipher, password, options) {
 
 inherits(Cipher, LazyTransform);
 
+// Processes `data` on the threadpool and writes the result to `output`,
+// starting at `offset`. The cipher cannot be used until `callback` is called.
+function updateAsync(cipher, data, output, offset, callback) {
+  const wrap = new AsyncWrap(Providers.CIPHERREQUEST);
+  wrap.handle = cipher._handle;  // Retains handle and buffers while in flight.
+  wrap.data = data;
+  wrap.output = output;
+  wrap.ondone = (err, bytesWritten) => {
+    cipher[kPending] = false;
+    callback.call(wrap, err || null, bytesWritten);
+  };
+  if (cipher._handle.updateInto(data, output, offset, wrap) === -1)
+    throw new ERR_BUFFER_OUT_OF_BOUNDS();
+  cipher[kPending] = true;
+}
+
 Cipher.prototype._transform = function _transform(chunk, encoding, callback) {
+  if (this[kAsync] && isArrayBufferView(chunk) &&
+      chunk.byteLength >= kMinAsyncCipherSize) {
+    const output = Buffer.allocUnsafe(chunk.byteLength + kMaxBlockLength);
+    try {
+      updateAsync(this, chunk, output, 0, (err, bytesWritten) => {
+        if (err) return callback(err);
+        this.push(output.slice(0, bytesWritten));
+        callback();
+      });
+    } catch (e) {
+      callback(e);
+    }
+    return;
+  }
   this.push(this._handle.update(chunk, encoding));
   callback();
 };
@@ -147,6 +194,8 @@ Cipher.prototype._flush = function _flush(callback) {
 };
 
 Cipher.prototype.update = function update(data, inputEncoding, outputEncoding) {
+  if (this[kPending])
+    throw new ERR_CRYPTO_INVALID_STATE('update');
   const encoding = getDefaultEncoding();
   inputEncoding = inputEncoding || encoding;
   outputEncoding = outputEncoding || encoding;
@@ -170,7 +219,47 @@ Cipher.prototype.update = function update(data, inputEncoding, outputEncoding) {
 };
 
 
+// Like update(), but writes the result to `output` instead of a new buffer,
+// and returns the number of bytes written. `output` may be `data` itself.
+// With a callback, large inputs are processed on the threadpool, and the
+// number of bytes written is passed to the callback.
+Cipher.prototype.updateInto = function updateInto(data, output, offset,
+                                                  callback) {
+  if (typeof offset === 'function') {
+    callback = offset;
+    offset = undefined;
+  }
+  if (this[kPending])
+    throw new ERR_CRYPTO_INVALID_STATE('updateInto');
+  if (!isArrayBufferView(data)) {
+    throw new ERR_INVALID_ARG_TYPE('data',
+                                   ['Buffer', 'TypedArray', 'DataView'], data);
+  }
+  if (!isArrayBufferView(output)) {
+    throw new ERR_INVALID_ARG_TYPE('output',
+                                   ['Buffer', 'TypedArray', 'DataView'],
+                                   output);
+  }
+  offset = offset === undefined ? 0 :
+    validateInt32(offset, 'offset', 0, output.byteLength);
+  if (callback !== undefined && typeof callback !== 'function')
+    throw new ERR_INVALID_CALLBACK();
+
+  if (callback !== undefined && data.byteLength >= kMinAsyncCipherSize)
+    return updateAsync(this, data, output, offset, callback);
+
+  const bytesWritten = this._handle.updateInto(data, output, offset);
+  if (bytesWritten === -1)
+    throw new ERR_BUFFER_OUT_OF_BOUNDS();
+  if (callback === undefined)
+    return bytesWritten;
+  process.nextTick(callback, null, bytesWritten);
+};
+
+
 Cipher.prototype.final = function final(outputEncoding) {
+  if (this[kPending])
+    throw new ERR_CRYPTO_INVALID_STATE('final');
   outputEncoding = outputEncoding || getDefaultEncoding();
   const ret = this._handle.final();
 
@@ -184,6 +273,8 @@ Cipher.prototype.final = function final(outputEncoding) {
 
 
 Cipher.prototype.setAutoPadding = function setAutoPadding(ap) {
+  if (this[kPending])
+    throw new ERR_CRYPTO_INVALID_STATE('setAutoPadding');
   if (this._handle.setAutoPadding(ap) === false)
     throw new ERR_CRYPTO_INVALID_STATE('setAutoPadding');
   return this;
@@ -198,6 +289,8 @@ Cipher.prototype.getAuthTag = function getAuthTag() {
 
 
 Cipher.prototype.setAuthTag = function setAuthTag(tagbuf) {
+  if (this[kPending])
+    throw new ERR_CRYPTO_INVALID_STATE('setAuthTag');
   if (!isArrayBufferView(tagbuf)) {
     throw new ERR_INVALID_ARG_TYPE('buffer',
                                    ['Buffer', 'TypedArray', 'DataView'],
@@ -212,6 +305,8 @@ Cipher.prototype.setAuthTag = function setAuthTag(tagbuf) {
 };
 
 Cipher.prototype.setAAD = function setAAD(aadbuf, options) {
+  if (this[kPending])
+    throw new ERR_CRYPTO_INVALID_STATE('setAAD');
   if (!isArrayBufferView(aadbuf)) {
     throw new ERR_INVALID_ARG_TYPE('buffer',
                                    ['Buffer', 'TypedArray', 'DataView'],
@@ -235,6 +330,7 @@ function addCipherPrototypeFunctions(constructor) {
   constructor.prototype._transform = Cipher.prototype._transform;
   constructor.prototype._flush = Cipher.prototype._flush;
   constructor.prototype.update = Cipher.prototype.update;
+  constructor.prototype.updateInto = Cipher.prototype.updateInto;
   constructor.prototype.final = Cipher.prototype.final;
   constructor.prototype.setAutoPadding = Cipher.prototype.setAutoPadding;
   constructor.prototype.getAuthTag = Cipher.prototype.getAuthTag;
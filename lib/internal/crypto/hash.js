@@ -1,13 +1,16 @@
 'use strict';
 
+const { AsyncWrap, Providers } = process.binding('async_wrap');
 const {
   Hash: _Hash,
-  Hmac: _Hmac
+  Hmac: _Hmac,
+  hash: _hash
 } = process.binding('crypto');
 
 const {
   getDefaultEncoding,
-  toBuf
+  toBuf,
+  validateArrayBufferView
 } = require('internal/crypto/util');
 
 const { Buffer } = require('buffer');
@@ -16,7 +19,10 @@ const {
   ERR_CRYPTO_HASH_DIGEST_NO_UTF16,
   ERR_CRYPTO_HASH_FINALIZED,
   ERR_CRYPTO_HASH_UPDATE_FAILED,
-  ERR_INVALID_ARG_TYPE
+  ERR_CRYPTO_INVALID_DIGEST,
+  ERR_CRYPTO_INVALID_STATE,
+  ERR_INVALID_ARG_TYPE,
+  ERR_INVALID_CALLBACK
 } = require('internal/errors').codes;
 const { inherits } = require('util');
 const { normalizeEncoding } = require('internal/util');
@@ -24,6 +30,13 @@ const { isArrayBufferView } = require('internal/util/types');
 const LazyTransform = require('internal/streams/lazy_transform');
 const kState = Symbol('state');
 const kFinalized = Symbol('finalized');
+const kAsync = Symbol('async');
+const kPending = Symbol('pending');
+
+// Chunks that are written to a hash created with `{ async: true }` are only
+// hashed on the threadpool if they are at least this large. For smaller ones,
+// the round trip costs more than the hashing itself.
+const kMinAsyncHashSize = 16 * 1024;
 
 function Hash(algorithm, options) {
   if (!(this instanceof Hash))
@@ -32,19 +45,57 @@ function Hash(algorithm, options) {
     throw new ERR_INVALID_ARG_TYPE('algorithm', 'string', algorithm);
   this._handle = new _Hash(algorithm);
   this[kState] = {
-    [kFinalized]: false
+    [kFinalized]: false,
+    [kAsync]: options != null && options.async === true,
+    [kPending]: false
   };
   LazyTransform.call(this, options);
 }
 
 inherits(Hash, LazyTransform);
 
+// Runs `fn(wrap)` on a hash created with `{ async: true }`. The handle and
+// `retain` are kept alive until the operation is done, and the hash cannot be
+// used synchronously in the meantime.
+function hashAsync(hash, retain, fn, callback) {
+  const state = hash[kState];
+  const wrap = new AsyncWrap(Providers.HASHREQUEST);
+  wrap.handle = hash._handle;
+  wrap.retain = retain;
+  wrap.ondone = (err, digest) => {
+    state[kPending] = false;
+    callback(err, digest);
+  };
+  state[kPending] = true;
+  fn(wrap);
+}
+
 Hash.prototype._transform = function _transform(chunk, encoding, callback) {
+  const state = this[kState];
+  if (state[kAsync] && isArrayBufferView(chunk) &&
+      chunk.byteLength >= kMinAsyncHashSize) {
+    hashAsync(this, chunk, (wrap) => {
+      this._handle.update(chunk, undefined, wrap);
+    }, (err) => callback(err));
+    return;
+  }
   this._handle.update(chunk, encoding);
   callback();
 };
 
 Hash.prototype._flush = function _flush(callback) {
+  const state = this[kState];
+  if (state[kAsync]) {
+    hashAsync(this, null, (wrap) => {
+      this._handle.digest(undefined, wrap);
+    }, (err, digest) => {
+      if (err) return callback(err);
+      state[kFinalized] = true;
+      this.push(digest);
+      callback();
+    });
+    return;
+  }
   this.push(this._handle.digest());
   callback();
 };
@@ -53,6 +104,8 @@ Hash.prototype.update = function update(data, encoding) {
   const state = this[kState];
   if (state[kFinalized])
     throw new ERR_CRYPTO_HASH_FINALIZED();
+  if (state[kPending])
+    throw new ERR_CRYPTO_INVALID_STATE('update');
 
   if (typeof data !== 'string' && !isArrayBufferView(data)) {
     throw new ERR_INVALID_ARG_TYPE('data',
@@ -69,6 +122,8 @@ Hash.prototype.digest = function digest(outputEncoding) {
   const state = this[kState];
   if (state[kFinalized])
     throw new ERR_CRYPTO_HASH_FINALIZED();
+  if (state[kPending])
+    throw new ERR_CRYPTO_INVALID_STATE('digest');
   outputEncoding = outputEncoding || getDefaultEncoding();
   if (normalizeEncoding(outputEncoding) === 'utf16le')
     throw new ERR_CRYPTO_HASH_DIGEST_NO_UTF16();
@@ -79,6 +134,69 @@ Hash.prototype.digest = function digest(outputEncoding) {
   return ret;
 };
 
+// One-shot hashing of `data`, which is either a single input or an array of
+// inputs. All inputs of an array are hashed in a single threadpool job.
+function hash(algorithm, data, outputEncoding, callback) {
+  if (typeof outputEncoding === 'function') {
+    callback = outputEncoding;
+    outputEncoding = undefined;
+  }
+  const { inputs, isBatch } = checkHashArgs(algorithm, data, outputEncoding);
+  outputEncoding = outputEncoding || getDefaultEncoding();
+
+  if (typeof callback !== 'function')
+    throw new ERR_INVALID_CALLBACK();
+
+  const wrap = new AsyncWrap(Providers.HASHREQUEST);
+  wrap.ondone = (err, digests) => {  // Retains inputs while in flight.
+    if (err) return callback.call(wrap, err);
+    callback.call(wrap, null,
+                  splitDigests(digests, inputs.length, isBatch,
+                               outputEncoding));
+  };
+
+  if (_hash(algorithm, inputs, wrap) === -1)
+    throw new ERR_CRYPTO_INVALID_DIGEST(algorithm);
+}
+
+function hashSync(algorithm, data, outputEncoding) {
+  const { inputs, isBatch } = checkHashArgs(algorithm, data, outputEncoding);
+  outputEncoding = outputEncoding || getDefaultEncoding();
+  const digests = _hash(algorithm, inputs, undefined);
+  if (digests === -1)
+    throw new ERR_CRYPTO_INVALID_DIGEST(algorithm);
+  return splitDigests(digests, inputs.length, isBatch, outputEncoding);
+}
+
+function checkHashArgs(algorithm, data, outputEncoding) {
+  if (typeof algorithm !== 'string')
+    throw new ERR_INVALID_ARG_TYPE('algorithm', 'string', algorithm);
+  if (outputEncoding &&
+      normalizeEncoding(outputEncoding) === 'utf16le') {
+    throw new ERR_CRYPTO_HASH_DIGEST_NO_UTF16();
+  }
+  const isBatch = Array.isArray(data);
+  const inputs = isBatch ?
+    data.map((input, i) => validateArrayBufferView(input, `data[${i}]`)) :
+    [validateArrayBufferView(data, 'data')];
+  return { inputs, isBatch };
+}
+
+function splitDigests(digests, count, isBatch, outputEncoding) {
+  if (!isBatch) {
+    return outputEncoding === 'buffer' ?
+      digests : digests.toString(outputEncoding);
+  }
+  const result = new Array(count);
+  const size = count > 0 ? digests.length / count : 0;
+  for (var i = 0; i < count; i++) {
+    const digest = digests.slice(i * size, (i + 1) * size);
+    result[i] = outputEncoding === 'buffer' ?
+      digest : digest.toString(outputEncoding);
+  }
+  return result;
+}
+
 
 function Hmac(hmac, key, options) {
   if (!(this instanceof Hmac))
@@ -123,5 +241,7 @@ Hmac.prototype._transform = Hash.prototype._transform;
 
 module.exports = {
   Hash,
-  Hmac
+  Hmac,
+  hash,
+  hashSync
 };
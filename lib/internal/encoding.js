@@ -406,6 +406,9 @@ function makeTextDecoderICU() {
         err.errno = ret;
         throw err;
       }
+      // Well-formed UTF-8 is decoded to a string directly.
+      if (typeof ret === 'string')
+        return ret;
       return ret.toString('ucs2');
     }
   }
@@ -6,12 +6,19 @@ class FreeList {
     this.ctor = ctor;
     this.max = max;
     this.list = [];
+    // Statistics, see http.getParserPoolStats().
+    this.created = 0;
+    this.reused = 0;
+    this.discarded = 0;
   }
 
   alloc() {
-    return this.list.length ?
-      this.list.pop() :
-      this.ctor.apply(this, arguments);
+    if (this.list.length) {
+      this.reused++;
+      return this.list.pop();
+    }
+    this.created++;
+    return this.ctor.apply(this, arguments);
   }
 
   free(obj) {
@@ -19,8 +26,16 @@ class FreeList {
       this.list.push(obj);
       return true;
     }
+    this.discarded++;
     return false;
   }
+
+  // Returns the objects that no longer fit into the list, so that the caller
+  // can dispose of them.
+  setMax(max) {
+    this.max = max;
+    return this.list.length > max ? this.list.splice(max) : [];
+  }
 }
 
 module.exports = FreeList;
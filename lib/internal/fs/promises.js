@@ -10,10 +10,16 @@ const {
 const binding = process.binding('fs');
 const { Buffer, kMaxLength } = require('buffer');
 const {
-  ERR_FS_FILE_TOO_LARGE,
-  ERR_INVALID_ARG_TYPE,
-  ERR_METHOD_NOT_IMPLEMENTED
-} = require('internal/errors').codes;
+  errnoException,
+  codes: {
+    ERR_FS_FILE_TOO_LARGE,
+    ERR_INVALID_ARG_TYPE,
+    ERR_METHOD_NOT_IMPLEMENTED,
+    ERR_OUT_OF_RANGE,
+    ERR_STREAM_DESTROYED
+  }
+} = require('internal/errors');
+const { internalBinding } = require('internal/bootstrap/loaders');
 const { getPathFromURL } = require('internal/url');
 const { isUint8Array } = require('internal/util/types');
 const {
@@ -69,6 +75,10 @@ class FileHandle {
     return fdatasync(this);
   }
 
+  pipeTo(stream, options) {
+    return pipeTo(this, stream, options);
+  }
+
   sync() {
     return fsync(this);
   }
@@ -164,6 +174,155 @@ async function readFileHandle(filehandle, options) {
   }
 }
 
+const kPipeToChunkSize = 65536;
+const { SendfilePipe, StreamPipe } = internalBinding('stream_pipe');
+let TCP;
+let Pipe;
+
+// Only plain TCP and pipe handles own a file descriptor that sendfile() can
+// write to directly; anything else (TLS, HTTP/2, userland streams) goes
+// through JS.
+function isSendfileSink(handle) {
+  if (SendfilePipe === undefined || handle == null)
+    return false;
+  if (TCP === undefined) {
+    ({ TCP } = process.binding('tcp_wrap'));
+    ({ Pipe } = process.binding('pipe_wrap'));
+  }
+  return handle instanceof TCP || handle instanceof Pipe;
+}
+
+// Other native streams, e.g. TLS sockets, can still be written to without
+// going through JS.
+function isStreamPipeSink(handle) {
+  return handle != null && handle._externalStream !== undefined;
+}
+
+// Resolves once everything written to the stream so far has been flushed.
+function flushWritable(stream) {
+  return new Promise((resolve, reject) => {
+    stream.write('', (err) => {
+      if (err)
+        reject(err);
+      else
+        resolve();
+    });
+  });
+}
+
+function sendfileTo(handle, stream, offset, length) {
+  // Hold back writes that happen while the kernel is copying the file, they
+  // go out in order once the transfer is done.
+  stream.cork();
+  return new Promise((resolve, reject) => {
+    const pipe = new SendfilePipe(handle.fd, stream._handle);
+    const onclose = () => pipe.stop();
+    pipe.oncomplete = (err, bytesSent) => {
+      stream.removeListener('close', onclose);
+      stream.uncork();
+      if (err < 0)
+        reject(errnoException(err, 'sendfile'));
+      else
+        resolve(bytesSent);
+    };
+    stream.once('close', onclose);
+    const err = pipe.start(offset, length);
+    if (err < 0) {
+      stream.removeListener('close', onclose);
+      stream.uncork();
+      reject(errnoException(err, 'sendfile'));
+    }
+  });
+}
+
+function onPipedFileHandleRead() {
+  // Errors and the end of the file are reported through `onunpipe`.
+}
+
+function streamPipeTo(handle, stream, offset, length) {
+  stream.cork();
+  return new Promise((resolve, reject) => {
+    const source = new binding.FileHandle(handle.fd, offset, length);
+    source.onread = onPipedFileHandleRead;
+    const pipe = new StreamPipe(source._externalStream,
+                                stream._handle._externalStream);
+    const onclose = () => pipe.unpipe();
+    pipe.onunpipe = (err, bytesSent) => {
+      stream.removeListener('close', onclose);
+      // The fd still belongs to `handle`.
+      source.releaseFD();
+      stream.uncork();
+      if (err < 0)
+        reject(errnoException(err, 'pipeTo'));
+      else
+        resolve(bytesSent);
+    };
+    stream.once('close', onclose);
+    pipe.start(false);
+  });
+}
+
+async function copyTo(handle, stream, offset, length) {
+  let bytesSent = 0;
+  while (length < 0 || bytesSent < length) {
+    const chunkSize = length < 0 ?
+      kPipeToChunkSize :
+      Math.min(kPipeToChunkSize, length - bytesSent);
+    const { bytesRead, buffer } =
+      await read(handle, Buffer.allocUnsafe(chunkSize), 0, chunkSize,
+                 offset + bytesSent);
+    if (bytesRead === 0)
+      break;
+    await new Promise((resolve, reject) => {
+      stream.write(buffer.slice(0, bytesRead), (err) => {
+        if (err)
+          reject(err);
+        else
+          resolve();
+      });
+    });
+    bytesSent += bytesRead;
+  }
+  return bytesSent;
+}
+
+async function pipeTo(handle, stream, options) {
+  validateFileHandle(handle);
+  if (stream === null || typeof stream !== 'object' ||
+      typeof stream.write !== 'function') {
+    throw new ERR_INVALID_ARG_TYPE('stream', 'stream.Writable', stream);
+  }
+  if (options === undefined || options === null)
+    options = {};
+  else if (typeof options !== 'object')
+    throw new ERR_INVALID_ARG_TYPE('options', 'Object', options);
+  const offset = options.offset === undefined ? 0 : options.offset;
+  const length = options.length === undefined ? -1 : options.length;
+  validateInteger(offset, 'offset');
+  validateInteger(length, 'length');
+  if (offset < 0)
+    throw new ERR_OUT_OF_RANGE('offset', '>= 0', offset);
+
+  if (length === 0)
+    return 0;
+
+  if (isSendfileSink(stream._handle)) {
+    await flushWritable(stream);
+    if (!isSendfileSink(stream._handle))
+      throw new ERR_STREAM_DESTROYED('pipeTo');
+    return sendfileTo(handle, stream, offset, length);
+  }
+
+  if (isStreamPipeSink(stream._handle)) {
+    await flushWritable(stream);
+    if (!isStreamPipeSink(stream._handle))
+      throw new ERR_STREAM_DESTROYED('pipeTo');
+    return streamPipeTo(handle, stream, offset, length);
+  }
+
+  return copyTo(handle, stream, offset, length);
+}
+
 // All of the functions are defined as async in order to ensure that errors
 // thrown cause promise rejections rather than being thrown synchronously.
 async function access(path, mode = F_OK) {
@@ -182,7 +182,8 @@ const IDX_OPTIONS_MAX_HEADER_LIST_PAIRS = 5;
 const IDX_OPTIONS_MAX_OUTSTANDING_PINGS = 6;
 const IDX_OPTIONS_MAX_OUTSTANDING_SETTINGS = 7;
 const IDX_OPTIONS_MAX_SESSION_MEMORY = 8;
-const IDX_OPTIONS_FLAGS = 9;
+const IDX_OPTIONS_MAX_WRITE_BATCH_SIZE = 9;
+const IDX_OPTIONS_FLAGS = 10;
 
 function updateOptionsBuffer(options) {
   var flags = 0;
@@ -231,6 +232,11 @@ function updateOptionsBuffer(options) {
     optionsBuffer[IDX_OPTIONS_MAX_SESSION_MEMORY] =
       Math.max(1, options.maxSessionMemory);
   }
+  if (typeof options.maxWriteBatchSize === 'number') {
+    flags |= (1 << IDX_OPTIONS_MAX_WRITE_BATCH_SIZE);
+    optionsBuffer[IDX_OPTIONS_MAX_WRITE_BATCH_SIZE] =
+      Math.max(0, options.maxWriteBatchSize);
+  }
   optionsBuffer[IDX_OPTIONS_FLAGS] = flags;
 }
 
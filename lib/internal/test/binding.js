@@ -11,4 +11,5 @@ process.emitWarning(
 const { internalBinding } = require('internal/bootstrap/loaders');
 module.exports = {
   ModuleWrap: internalBinding('module_wrap').ModuleWrap,
+  StreamPipe: internalBinding('stream_pipe').StreamPipe,
 };
@@ -6,6 +6,8 @@ const {
   clearMark: _clearMark,
   measure: _measure,
   milestones,
+  loopMetrics,
+  refreshLoopMetrics,
   observerCounts,
   setupObservers,
   timeOrigin,
@@ -27,7 +29,13 @@ const {
   NODE_PERFORMANCE_MILESTONE_LOOP_START,
   NODE_PERFORMANCE_MILESTONE_LOOP_EXIT,
   NODE_PERFORMANCE_MILESTONE_BOOTSTRAP_COMPLETE,
-  NODE_PERFORMANCE_MILESTONE_ENVIRONMENT
+  NODE_PERFORMANCE_MILESTONE_ENVIRONMENT,
+
+  NODE_PERFORMANCE_LOOP_METRIC_LOOP_COUNT,
+  NODE_PERFORMANCE_LOOP_METRIC_WAKEUPS,
+  NODE_PERFORMANCE_LOOP_METRIC_EVENTS,
+  NODE_PERFORMANCE_LOOP_METRIC_CTL_CALLS,
+  NODE_PERFORMANCE_LOOP_METRIC_IDLE_TIME
 } = constants;
 
 const { AsyncResource } = require('async_hooks');
@@ -389,6 +397,24 @@ class Performance {
     _measure(name, startMark, endMark);
   }
 
+  eventLoopMetrics() {
+    refreshLoopMetrics();
+    const wakeups = loopMetrics[NODE_PERFORMANCE_LOOP_METRIC_WAKEUPS];
+    const events = loopMetrics[NODE_PERFORMANCE_LOOP_METRIC_EVENTS];
+    const idleTime = loopMetrics[NODE_PERFORMANCE_LOOP_METRIC_IDLE_TIME];
+    const loopStart = nodeTiming.loopStart;
+    return {
+      loopCount: loopMetrics[NODE_PERFORMANCE_LOOP_METRIC_LOOP_COUNT],
+      wakeups,
+      events,
+      eventsPerWakeup: wakeups > 0 ? events / wakeups : 0,
+      ctlCalls: loopMetrics[NODE_PERFORMANCE_LOOP_METRIC_CTL_CALLS],
+      idleTime,
+      activeTime: loopStart === -1 ?
+        0 : Math.max(0, this.now() - loopStart - idleTime)
+    };
+  }
+
   clearMarks(name) {
     name = name !== undefined ? `${name}` : name;
     if (name !== undefined) {
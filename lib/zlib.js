@@ -22,8 +22,10 @@
 'use strict';
 
 const {
+  ERR_BROTLI_INVALID_PARAM,
   ERR_BUFFER_TOO_LARGE,
   ERR_INVALID_ARG_TYPE,
+  ERR_METHOD_NOT_IMPLEMENTED,
   ERR_OUT_OF_RANGE,
   ERR_ZLIB_INITIALIZATION_FAILED
 } = require('internal/errors').codes;
@@ -38,6 +40,8 @@ const {
 } = require('util');
 const binding = process.binding('zlib');
 const assert = require('assert').ok;
+const FreeList = require('internal/freelist');
+const { validateInteger } = require('internal/validators');
 const {
   Buffer,
   kMaxLength
@@ -49,7 +53,11 @@ const {
   Z_MIN_CHUNK, Z_MIN_WINDOWBITS, Z_MAX_WINDOWBITS, Z_MIN_LEVEL, Z_MAX_LEVEL,
   Z_MIN_MEMLEVEL, Z_MAX_MEMLEVEL, Z_DEFAULT_CHUNK, Z_DEFAULT_COMPRESSION,
   Z_DEFAULT_STRATEGY, Z_DEFAULT_WINDOWBITS, Z_DEFAULT_MEMLEVEL, Z_FIXED,
-  DEFLATE, DEFLATERAW, INFLATE, INFLATERAW, GZIP, GUNZIP, UNZIP
+  Z_HUFFMAN_ONLY, Z_OK,
+  DEFLATE, DEFLATERAW, INFLATE, INFLATERAW, GZIP, GUNZIP, UNZIP,
+  BROTLI_DECODE, BROTLI_ENCODE,
+  BROTLI_OPERATION_PROCESS, BROTLI_OPERATION_FLUSH, BROTLI_OPERATION_FINISH,
+  BROTLI_PARAM_NDIRECT, BROTLI_DECODER_PARAM_LARGE_WINDOW
 } = constants;
 
 // translation table for return codes.
@@ -142,24 +150,35 @@ function zlibBufferSync(engine, buffer) {
   return buffer;
 }
 
-function zlibOnError(message, errno) {
+function zlibOnError(message, errno, code) {
   var self = this.jsref;
   // there is no way to cleanly recover.
   // continuing only obscures problems.
-  _close(self);
   self._hadError = true;
+  _close(self);
+  self.emit('error', createZlibError(message, errno, code));
+}
 
+function createZlibError(message, errno, code) {
   // eslint-disable-next-line no-restricted-syntax
   const error = new Error(message);
   error.errno = errno;
-  error.code = codes[errno];
-  self.emit('error', error);
+  error.code = code !== undefined ? code : codes[errno];
+  return error;
 }
 
 function flushCallback(level, strategy, callback) {
-  if (!this._handle)
-    assert(false, 'zlib binding closed');
-  this._handle.params(level, strategy);
+  if (this._parallel) {
+    // The following blocks are compressed with the new parameters.
+    this._parallel.level = level;
+    this._parallel.strategy = strategy;
+  } else {
+    if (!this._handle)
+      assert(false, 'zlib binding closed');
+    this._handle.params(level, strategy);
+    // The handle no longer matches the pool it would be returned to.
+    this._handle.reusable = false;
+  }
   if (!this._hadError) {
     this._level = level;
     this._strategy = strategy;
@@ -215,18 +234,162 @@ function checkRangesOrGetDefault(number, name, lower, upper, def) {
   return number;
 }
 
-// the Zlib class they all inherit from
+const GZIP_HEADER_ID1 = 0x1f;
+const GZIP_HEADER_ID2 = 0x8b;
+const kDefaultBlockSize = 128 * 1024;
+const kMaxParallel = 1024;
+const kWindowSize = 32 * 1024;
+
+// Idle native handles, keyed by the mode and parameters they were initialized
+// with. Setting up zlib's state is expensive, so handles are reset and kept
+// here when their stream is closed, and picked up again by the next stream
+// with the same parameters.
+const handlePools = new Map();
+let handlePoolSize = 8;
+
+function createHandle(mode, windowBits, level, memLevel, strategy,
+                      dictionary) {
+  const handle = new binding.Zlib(mode);
+  handle.onerror = zlibOnError;
+  handle.writeState = new Uint32Array(2);
+  if (!handle.init(windowBits,
+                   level,
+                   memLevel,
+                   strategy,
+                   handle.writeState,
+                   processCallback,
+                   dictionary)) {
+    throw new ERR_ZLIB_INITIALIZATION_FAILED();
+  }
+  return handle;
+}
+
+function allocHandle(mode, windowBits, level, memLevel, strategy,
+                     dictionary) {
+  // Streams with a dictionary are not pooled, and neither is UNZIP, which
+  // turns into GUNZIP when it detects the gzip header.
+  if (dictionary !== undefined || mode === UNZIP) {
+    return createHandle(mode, windowBits, level, memLevel, strategy,
+                        dictionary);
+  }
+  const poolKey = `${mode} ${windowBits} ${level} ${memLevel} ${strategy}`;
+  let pool = handlePools.get(poolKey);
+  if (pool === undefined) {
+    pool = new FreeList('zlib', handlePoolSize, createHandle);
+    handlePools.set(poolKey, pool);
+  }
+  const reused = pool.list.length > 0;
+  const handle = pool.alloc(mode, windowBits, level, memLevel, strategy);
+  // The handle is being reused. Reset the async id and call init() callbacks.
+  if (reused)
+    handle.asyncReset();
+  handle.poolKey = poolKey;
+  handle.reusable = true;
+  return handle;
+}
+
+function freeHandle(handle, hadError) {
+  // Handles with a pending write, which can only be the case when the stream
+  // is destroyed, are closed once the write finishes. They keep their jsref,
+  // processCallback() and zlibOnError() may still run for that write.
+  const pool = handle.poolKey !== undefined && handlePools.get(handle.poolKey);
+  if (!pool || !handle.reusable || hadError || handle.buffer != null ||
+      pool.list.length >= pool.max || !handle.free()) {
+    if (pool)
+      pool.discarded++;
+    handle.close();
+    return;
+  }
+  handle.jsref = null;
+  pool.free(handle);
+}
+
+function setContextPoolSize(max) {
+  validateInteger(max, 'max');
+  if (max < 0)
+    throw new ERR_OUT_OF_RANGE('max', '>= 0', max);
+  handlePoolSize = max;
+  // Pooled handles have run their destroy() hooks in free() already, close()
+  // does not run them again.
+  for (const pool of handlePools.values())
+    pool.setMax(max).forEach((handle) => handle.close());
+}
+
+function getContextPoolStats() {
+  const stats = {
+    max: handlePoolSize,
+    size: 0,
+    created: 0,
+    reused: 0,
+    discarded: 0
+  };
+  for (const pool of handlePools.values()) {
+    stats.size += pool.list.length;
+    stats.created += pool.created;
+    stats.reused += pool.reused;
+    stats.discarded += pool.discarded;
+  }
+  return stats;
+}
+
+// the ZlibBase class all compression streams inherit from
 // This thing manages the queue of requests, and returns
 // true or false if there is anything in the queue when
-// you call the .write() method.
-function Zlib(opts, mode) {
+// you call the .write() method. The subclasses validate their own options
+// and attach the native handle (or, for parallel gzip, the block state)
+// once ZlibBase has been called.
+function ZlibBase(opts, flush, finishFlush, fullFlush) {
   var chunkSize = Z_DEFAULT_CHUNK;
+  if (opts) {
+    chunkSize = opts.chunkSize;
+    if (!checkFiniteNumber(chunkSize, 'options.chunkSize')) {
+      chunkSize = Z_DEFAULT_CHUNK;
+    } else if (chunkSize < Z_MIN_CHUNK) {
+      throw new ERR_OUT_OF_RANGE('options.chunkSize',
+                                 `>= ${Z_MIN_CHUNK}`, chunkSize);
+    }
+
+    if (opts.encoding || opts.objectMode || opts.writableObjectMode) {
+      opts = _extend({}, opts);
+      opts.encoding = null;
+      opts.objectMode = false;
+      opts.writableObjectMode = false;
+    }
+  }
+  Transform.call(this, opts);
+  this.bytesWritten = 0;
+  this._hadError = false;
+  this._handle = null;
+  this._writeState = null;
+  this._parallel = null;
+  this._outBuffer = Buffer.allocUnsafe(chunkSize);
+  this._outOffset = 0;
+  this._chunkSize = chunkSize;
+  this._flushFlag = flush;
+  this._scheduledFlushFlag = Z_NO_FLUSH;
+  this._origFlushFlag = flush;
+  this._finishFlushFlag = finishFlush;
+  this._defaultFullFlushFlag = fullFlush;
+  this._info = opts && opts.info;
+  this.once('end', this.close);
+}
+inherits(ZlibBase, Transform);
+
+function attachHandle(self, handle) {
+  self._handle = handle;
+  handle.jsref = self; // Used by processCallback() and zlibOnError()
+  self._writeState = handle.writeState;
+}
+
+function Zlib(opts, mode) {
   var flush = Z_NO_FLUSH;
   var finishFlush = Z_FINISH;
   var windowBits = Z_DEFAULT_WINDOWBITS;
   var level = Z_DEFAULT_COMPRESSION;
   var memLevel = Z_DEFAULT_MEMLEVEL;
   var strategy = Z_DEFAULT_STRATEGY;
+  var parallel = 0;
+  var blockSize = kDefaultBlockSize;
   var dictionary;
 
   // The Zlib class is not exported to user land, the mode should only be
@@ -235,14 +398,6 @@ function Zlib(opts, mode) {
   assert(mode >= DEFLATE && mode <= UNZIP);
 
   if (opts) {
-    chunkSize = opts.chunkSize;
-    if (!checkFiniteNumber(chunkSize, 'options.chunkSize')) {
-      chunkSize = Z_DEFAULT_CHUNK;
-    } else if (chunkSize < Z_MIN_CHUNK) {
-      throw new ERR_OUT_OF_RANGE('options.chunkSize',
-                                 `>= ${Z_MIN_CHUNK}`, chunkSize);
-    }
-
     flush = checkRangesOrGetDefault(
       opts.flush, 'options.flush',
       Z_NO_FLUSH, Z_BLOCK, Z_NO_FLUSH);
@@ -277,6 +432,16 @@ function Zlib(opts, mode) {
       opts.strategy, 'options.strategy',
       Z_DEFAULT_STRATEGY, Z_FIXED, Z_DEFAULT_STRATEGY);
 
+    if (mode === GZIP) {
+      parallel = checkRangesOrGetDefault(
+        opts.parallel, 'options.parallel',
+        1, kMaxParallel, 0);
+
+      blockSize = checkRangesOrGetDefault(
+        opts.blockSize, 'options.blockSize',
+        Z_MIN_CHUNK, kMaxLength, kDefaultBlockSize);
+    }
+
     dictionary = opts.dictionary;
     if (dictionary !== undefined && !isArrayBufferView(dictionary)) {
       if (isAnyArrayBuffer(dictionary)) {
@@ -289,51 +454,25 @@ function Zlib(opts, mode) {
         );
       }
     }
-
-    if (opts.encoding || opts.objectMode || opts.writableObjectMode) {
-      opts = _extend({}, opts);
-      opts.encoding = null;
-      opts.objectMode = false;
-      opts.writableObjectMode = false;
-    }
   }
-  Transform.call(this, opts);
-  this.bytesWritten = 0;
-  this._handle = new binding.Zlib(mode);
-  this._handle.jsref = this; // Used by processCallback() and zlibOnError()
-  this._handle.onerror = zlibOnError;
-  this._hadError = false;
-  this._writeState = new Uint32Array(2);
-
-  if (!this._handle.init(windowBits,
-                         level,
-                         memLevel,
-                         strategy,
-                         this._writeState,
-                         processCallback,
-                         dictionary)) {
-    throw new ERR_ZLIB_INITIALIZATION_FAILED();
+  ZlibBase.call(this, opts, flush, finishFlush, Z_FULL_FLUSH);
+  if (parallel > 0) {
+    this._parallel = new ParallelGzipState(windowBits, level, memLevel,
+                                           strategy, parallel, blockSize);
+  } else {
+    attachHandle(this, allocHandle(mode, windowBits, level, memLevel,
+                                   strategy, dictionary));
   }
-
-  this._outBuffer = Buffer.allocUnsafe(chunkSize);
-  this._outOffset = 0;
   this._level = level;
   this._strategy = strategy;
-  this._chunkSize = chunkSize;
-  this._flushFlag = flush;
-  this._scheduledFlushFlag = Z_NO_FLUSH;
-  this._origFlushFlag = flush;
-  this._finishFlushFlag = finishFlush;
-  this._info = opts && opts.info;
-  this.once('end', this.close);
 }
-inherits(Zlib, Transform);
+inherits(Zlib, ZlibBase);
 
-Object.defineProperty(Zlib.prototype, '_closed', {
+Object.defineProperty(ZlibBase.prototype, '_closed', {
   configurable: true,
   enumerable: true,
   get() {
-    return !this._handle;
+    return !this._handle && !this._parallel;
   }
 });
 
@@ -341,7 +480,7 @@ Object.defineProperty(Zlib.prototype, '_closed', {
 // perspective, but it is inconsistent with all other streams exposed by Node.js
 // that have this concept, where it stands for the number of bytes read
 // *from* the stream (that is, net.Socket/tls.Socket & file system streams).
-Object.defineProperty(Zlib.prototype, 'bytesRead', {
+Object.defineProperty(ZlibBase.prototype, 'bytesRead', {
   configurable: true,
   enumerable: true,
   get() {
@@ -364,7 +503,9 @@ Zlib.prototype.params = function params(level, strategy, callback) {
   }
 };
 
-Zlib.prototype.reset = function reset() {
+ZlibBase.prototype.reset = function reset() {
+  if (this._parallel)
+    throw new ERR_METHOD_NOT_IMPLEMENTED('reset');
   if (!this._handle)
     assert(false, 'zlib binding closed');
   return this._handle.reset();
@@ -372,7 +513,7 @@ Zlib.prototype.reset = function reset() {
 
 // This is the _flush function called by the transform class,
 // internally, when the last chunk has been written.
-Zlib.prototype._flush = function _flush(callback) {
+ZlibBase.prototype._flush = function _flush(callback) {
   this._transform(Buffer.alloc(0), '', callback);
 };
 
@@ -381,6 +522,8 @@ Zlib.prototype._flush = function _flush(callback) {
 // Roughly, the following holds:
 // Z_NO_FLUSH (< Z_TREES) < Z_BLOCK < Z_PARTIAL_FLUSH <
 //     Z_SYNC_FLUSH < Z_FULL_FLUSH < Z_FINISH
+// The BROTLI_OPERATION_* values 0 to 2 happen to be ordered the same way
+// by this table.
 const flushiness = [];
 let i = 0;
 for (const flushFlag of [Z_NO_FLUSH, Z_BLOCK, Z_PARTIAL_FLUSH,
@@ -392,12 +535,12 @@ function maxFlush(a, b) {
   return flushiness[a] > flushiness[b] ? a : b;
 }
 
-Zlib.prototype.flush = function flush(kind, callback) {
+ZlibBase.prototype.flush = function flush(kind, callback) {
   var ws = this._writableState;
 
   if (typeof kind === 'function' || (kind === undefined && !callback)) {
     callback = kind;
-    kind = Z_FULL_FLUSH;
+    kind = this._defaultFullFlushFlag;
   }
 
   if (ws.ended) {
@@ -424,12 +567,12 @@ Zlib.prototype.flush = function flush(kind, callback) {
   }
 };
 
-Zlib.prototype.close = function close(callback) {
+ZlibBase.prototype.close = function close(callback) {
   _close(this, callback);
   this.destroy();
 };
 
-Zlib.prototype._transform = function _transform(chunk, encoding, cb) {
+ZlibBase.prototype._transform = function _transform(chunk, encoding, cb) {
   // If it's the last chunk, or a final flush, we use the Z_FINISH flush flag
   // (or whatever flag was provided using opts.finishFlush).
   // If it's explicitly flushing at some other time, then we use
@@ -445,18 +588,29 @@ Zlib.prototype._transform = function _transform(chunk, encoding, cb) {
     if (chunk.byteLength >= ws.length)
       this._flushFlag = this._origFlushFlag;
   }
-  processChunk(this, chunk, flushFlag, cb);
+  if (this._parallel)
+    processChunkParallel(this, chunk, flushFlag, cb);
+  else
+    processChunk(this, chunk, flushFlag, cb);
 };
 
-Zlib.prototype._processChunk = function _processChunk(chunk, flushFlag, cb) {
+ZlibBase.prototype._processChunk = function _processChunk(chunk, flushFlag,
+                                                          cb) {
   // _processChunk() is left for backwards compatibility
-  if (typeof cb === 'function')
-    processChunk(this, chunk, flushFlag, cb);
-  else
+  if (typeof cb === 'function') {
+    if (this._parallel)
+      processChunkParallel(this, chunk, flushFlag, cb);
+    else
+      processChunk(this, chunk, flushFlag, cb);
+  } else {
     return processChunkSync(this, chunk, flushFlag);
+  }
 };
 
 function processChunkSync(self, chunk, flushFlag) {
+  if (self._parallel)
+    return processChunkParallelSync(self, chunk, flushFlag);
+
   var availInBefore = chunk.byteLength;
   var availOutBefore = self._chunkSize - self._outOffset;
   var inOff = 0;
@@ -625,15 +779,305 @@ function processCallback() {
   this.cb();
 }
 
+// Gzip streams created with the `parallel` option split their input into
+// blocks that are deflated independently of each other, so that several of
+// them can be compressed on the threadpool at the same time, the way pigz
+// does it. Each block is primed with the 32 KB of input that precede it as
+// its dictionary, which keeps the compression ratio close to that of a single
+// deflate stream, and ends with a sync flush so that the raw deflate output
+// of the blocks can be concatenated. The gzip header and trailer are written
+// here, with the CRC-32 of the input combined from those of the blocks.
+function ParallelGzipState(windowBits, level, memLevel, strategy, parallel,
+                           blockSize) {
+  // Raw deflate streams do not support a window size of 256 bytes. zlib uses
+  // 512 bytes for gzip streams that ask for it anyway.
+  this.windowBits = Math.max(windowBits, 9);
+  this.memLevel = memLevel;
+  this.level = level;
+  this.strategy = strategy;
+  this.parallel = parallel;
+  this.blockSize = blockSize;
+  // Idle binding.DeflateBlock handles.
+  this.handles = [];
+  // Submitted blocks in stream order, until their output has been pushed.
+  this.blocks = [];
+  // The block that input is being copied into.
+  this.buffer = null;
+  this.bufferOffset = 0;
+  // The dictionary for the next block.
+  this.window = null;
+  // The chunk passed to _transform(), and the callback to call once it has
+  // been taken care of.
+  this.chunk = null;
+  this.chunkOffset = 0;
+  this.flushFlag = Z_NO_FLUSH;
+  this.flushSubmitted = false;
+  this.cb = null;
+  this.headerWritten = false;
+  this.crc = 0;
+  this.size = 0;
+  this.closed = false;
+}
+
+function createBlockHandle(self, state) {
+  const handle = new binding.DeflateBlock(state.windowBits, state.memLevel);
+  handle.oncomplete = onBlockComplete;
+  handle.stream = self;
+  handle.state = state;
+  handle.block = null;
+  return handle;
+}
+
+function gzipHeader(level, strategy) {
+  if (level === Z_DEFAULT_COMPRESSION)
+    level = 6;
+  // The same extra flags that zlib writes, and an unknown operating system.
+  var xfl = 0;
+  if (level === 9)
+    xfl = 2;
+  else if (level < 2 || strategy >= Z_HUFFMAN_ONLY)
+    xfl = 4;
+  return Buffer.from([GZIP_HEADER_ID1, GZIP_HEADER_ID2, 8 /* deflate */, 0,
+                      0, 0, 0, 0, xfl, 255]);
+}
+
+function gzipTrailer(crc, size) {
+  const trailer = Buffer.allocUnsafe(8);
+  trailer.writeUInt32LE(crc, 0);
+  trailer.writeUInt32LE(size >>> 0, 4);
+  return trailer;
+}
+
+// Returns the dictionary for the block that follows `input`.
+function nextWindow(window, input) {
+  if (input.length >= kWindowSize)
+    return input.slice(input.length - kWindowSize);
+  if (window === null)
+    return input;
+  const joined = Buffer.concat([window, input]);
+  return joined.slice(Math.max(joined.length - kWindowSize, 0));
+}
+
+function createBlock(state, input, sync) {
+  const block = {
+    input,
+    length: input.length,
+    dictionary: state.window,
+    sync,
+    errno: Z_OK,
+    output: null,
+    crc: 0
+  };
+  state.window = nextWindow(state.window, input);
+  return block;
+}
+
+function submitBlock(self, flush) {
+  const state = self._parallel;
+  const input = state.buffer === null ?
+    Buffer.alloc(0) : state.buffer.slice(0, state.bufferOffset);
+  state.buffer = null;
+  state.bufferOffset = 0;
+  const block = createBlock(state, input, false);
+  const handle = state.handles.pop() || createBlockHandle(self, state);
+  handle.block = block;
+  state.blocks.push(block);
+  handle.compress(input, block.dictionary, flush, state.level, state.strategy);
+}
+
+function onBlockComplete(errno, output, crc) {
+  // This callback's context (`this`) is the binding.DeflateBlock handle.
+  const self = this.stream;
+  const state = this.state;
+  const block = this.block;
+  this.block = null;
+  block.input = null;
+  block.dictionary = null;
+  block.errno = errno;
+  block.output = output;
+  block.crc = crc;
+
+  if (state.closed) {
+    this.close();
+    return;
+  }
+  state.handles.push(this);
+
+  if (block.sync || self.destroyed)
+    return;
+
+  if (errno !== Z_OK) {
+    self._hadError = true;
+    _close(self);
+    self.emit('error', createZlibError('Zlib error', errno));
+    return;
+  }
+
+  processParallel(self);
+}
+
+function processChunkParallel(self, chunk, flushFlag, cb) {
+  const state = self._parallel;
+  if (!state)
+    assert(false, 'zlib binding closed');
+
+  state.chunk = chunk;
+  state.chunkOffset = 0;
+  state.flushFlag = flushFlag;
+  state.flushSubmitted = false;
+  state.cb = cb;
+  processParallel(self);
+}
+
+function processParallel(self) {
+  const state = self._parallel;
+  const blocks = state.blocks;
+
+  // Push the output of the blocks that are done, in order.
+  while (blocks.length > 0 && blocks[0].output !== null) {
+    const block = blocks.shift();
+    if (!state.headerWritten) {
+      self.push(gzipHeader(state.level, state.strategy));
+      state.headerWritten = true;
+    }
+    self.push(block.output);
+    state.crc = binding.crc32Combine(state.crc, block.crc, block.length);
+    state.size += block.length;
+    self.bytesWritten += block.length;
+  }
+
+  if (state.cb === null)
+    return;
+
+  // Copy the chunk into blocks, and start compressing every block that is
+  // full, as long as not too many blocks are in progress.
+  const chunk = state.chunk;
+  while (true) {
+    if (state.bufferOffset === state.blockSize) {
+      if (blocks.length >= state.parallel)
+        break;
+      submitBlock(self, Z_SYNC_FLUSH);
+    }
+    if (state.chunkOffset === chunk.length)
+      break;
+    if (state.buffer === null)
+      state.buffer = Buffer.allocUnsafe(state.blockSize);
+    const copied = chunk.copy(state.buffer, state.bufferOffset,
+                              state.chunkOffset);
+    state.bufferOffset += copied;
+    state.chunkOffset += copied;
+  }
+
+  // Wait for a block to finish before taking in more input.
+  if (state.chunkOffset < chunk.length)
+    return;
+
+  if (state.flushFlag !== Z_NO_FLUSH) {
+    const finish = state.flushFlag === Z_FINISH;
+    if (!state.flushSubmitted) {
+      if (state.bufferOffset === state.blockSize ||
+          blocks.length >= state.parallel) {
+        return;
+      }
+      if (state.bufferOffset > 0 || finish)
+        submitBlock(self, finish ? Z_FINISH : Z_SYNC_FLUSH);
+      // Like after a Z_FULL_FLUSH in zlib, the following data can be
+      // decompressed without the data that precedes it.
+      if (state.flushFlag === Z_FULL_FLUSH)
+        state.window = null;
+      state.flushSubmitted = true;
+    }
+    // A flush is done once everything before it has been pushed.
+    if (blocks.length > 0)
+      return;
+    if (finish)
+      self.push(gzipTrailer(state.crc, state.size));
+  }
+
+  const cb = state.cb;
+  state.cb = null;
+  state.chunk = null;
+  cb();
+}
+
+// The blocks are compressed one after another here, which results in the
+// same output as the asynchronous version.
+function processChunkParallelSync(self, chunk, flushFlag) {
+  const state = self._parallel;
+  const buffers = [gzipHeader(state.level, state.strategy)];
+  var nread = buffers[0].length;
+  var crc = 0;
+  var offset = 0;
+
+  while (true) {
+    const remaining = chunk.length - offset;
+    const last = remaining < state.blockSize;
+    if (last && remaining === 0 && flushFlag !== Z_FINISH)
+      break;
+    const input = chunk.slice(offset, offset + Math.min(remaining,
+                                                        state.blockSize));
+    offset += input.length;
+    const block = createBlock(state, input, true);
+    const handle = state.handles.pop() || createBlockHandle(self, state);
+    handle.block = block;
+    handle.compressSync(input, block.dictionary,
+                        last && flushFlag === Z_FINISH ? Z_FINISH :
+                          Z_SYNC_FLUSH,
+                        state.level, state.strategy);
+    if (block.errno !== Z_OK) {
+      const error = createZlibError('Zlib error', block.errno);
+      _close(self);
+      throw error;
+    }
+    buffers.push(block.output);
+    nread += block.output.length;
+    crc = binding.crc32Combine(crc, block.crc, input.length);
+    if (last)
+      break;
+  }
+
+  if (flushFlag === Z_FINISH) {
+    buffers.push(gzipTrailer(crc, chunk.length));
+    nread += 8;
+  }
+
+  self.bytesWritten = chunk.length;
+  _close(self);
+
+  if (nread >= kMaxLength)
+    throw new ERR_BUFFER_TOO_LARGE();
+
+  return Buffer.concat(buffers, nread);
+}
+
+function closeParallel(state) {
+  // Handles that are still compressing a block are closed once that is done.
+  state.closed = true;
+  for (const handle of state.handles)
+    handle.close();
+  state.handles = [];
+  state.blocks = [];
+  state.buffer = null;
+  state.window = null;
+  state.chunk = null;
+  state.cb = null;
+}
+
 function _close(engine, callback) {
   if (callback)
     process.nextTick(callback);
 
+  if (engine._parallel) {
+    closeParallel(engine._parallel);
+    engine._parallel = null;
+    return;
+  }
+
   // Caller may invoke .close after a zlib error (which will null _handle).
   if (!engine._handle)
     return;
 
-  engine._handle.close();
+  freeHandle(engine._handle, engine._hadError);
   engine._handle = null;
 }
 
@@ -689,6 +1133,80 @@ function Unzip(opts) {
 }
 inherits(Unzip, Zlib);
 
+// Brotli is only available when Node.js is linked against libbrotli, in
+// which case the binding provides the Brotli class.
+const kMaxBrotliParam =
+  Math.max(BROTLI_PARAM_NDIRECT, BROTLI_DECODER_PARAM_LARGE_WINDOW);
+const brotliInitParamsArray =
+  binding.Brotli !== undefined ? new Uint32Array(kMaxBrotliParam + 1) : null;
+
+function Brotli(opts, mode) {
+  var flush = BROTLI_OPERATION_PROCESS;
+  var finishFlush = BROTLI_OPERATION_FINISH;
+
+  assert(mode === BROTLI_DECODE || mode === BROTLI_ENCODE);
+
+  // Parameters that are not set keep the library's default.
+  brotliInitParamsArray.fill(-1);
+  if (opts) {
+    flush = checkRangesOrGetDefault(
+      opts.flush, 'options.flush',
+      BROTLI_OPERATION_PROCESS, BROTLI_OPERATION_FINISH,
+      BROTLI_OPERATION_PROCESS);
+
+    finishFlush = checkRangesOrGetDefault(
+      opts.finishFlush, 'options.finishFlush',
+      BROTLI_OPERATION_PROCESS, BROTLI_OPERATION_FINISH,
+      BROTLI_OPERATION_FINISH);
+
+    if (opts.params) {
+      for (const origKey of Object.keys(opts.params)) {
+        const key = +origKey;
+        if (!Number.isInteger(key) || key < 0 || key > kMaxBrotliParam ||
+            (brotliInitParamsArray[key] | 0) !== -1) {
+          throw new ERR_BROTLI_INVALID_PARAM(origKey);
+        }
+
+        const value = opts.params[origKey];
+        if (typeof value !== 'number' && typeof value !== 'boolean') {
+          throw new ERR_INVALID_ARG_TYPE('options.params[key]',
+                                         'number', opts.params[origKey]);
+        }
+        brotliInitParamsArray[key] = value;
+      }
+    }
+  }
+
+  ZlibBase.call(this, opts, flush, finishFlush, BROTLI_OPERATION_FLUSH);
+
+  const handle = new binding.Brotli(mode);
+  handle.onerror = zlibOnError;
+  handle.writeState = new Uint32Array(2);
+  if (!handle.init(brotliInitParamsArray,
+                   handle.writeState,
+                   processCallback)) {
+    // Invalid parameter values are only detected by the library.
+    handle.close();
+    throw new ERR_ZLIB_INITIALIZATION_FAILED();
+  }
+  attachHandle(this, handle);
+}
+inherits(Brotli, ZlibBase);
+
+function BrotliCompress(opts) {
+  if (!(this instanceof BrotliCompress))
+    return new BrotliCompress(opts);
+  Brotli.call(this, opts, BROTLI_ENCODE);
+}
+inherits(BrotliCompress, Brotli);
+
+function BrotliDecompress(opts) {
+  if (!(this instanceof BrotliDecompress))
+    return new BrotliDecompress(opts);
+  Brotli.call(this, opts, BROTLI_DECODE);
+}
+inherits(BrotliDecompress, Brotli);
+
 function createConvenienceMethod(ctor, sync) {
   if (sync) {
     return function(buffer, opts) {
@@ -739,7 +1257,10 @@ module.exports = {
   gunzip: createConvenienceMethod(Gunzip, false),
   gunzipSync: createConvenienceMethod(Gunzip, true),
   inflateRaw: createConvenienceMethod(InflateRaw, false),
-  inflateRawSync: createConvenienceMethod(InflateRaw, true)
+  inflateRawSync: createConvenienceMethod(InflateRaw, true),
+
+  getContextPoolStats,
+  setContextPoolSize
 };
 
 Object.defineProperties(module.exports, {
@@ -762,6 +1283,21 @@ Object.defineProperties(module.exports, {
   }
 });
 
+if (binding.Brotli !== undefined) {
+  Object.assign(module.exports, {
+    BrotliCompress,
+    BrotliDecompress,
+    brotliCompress: createConvenienceMethod(BrotliCompress, false),
+    brotliCompressSync: createConvenienceMethod(BrotliCompress, true),
+    brotliDecompress: createConvenienceMethod(BrotliDecompress, false),
+    brotliDecompressSync: createConvenienceMethod(BrotliDecompress, true)
+  });
+  Object.defineProperties(module.exports, {
+    createBrotliCompress: createProperty(BrotliCompress),
+    createBrotliDecompress: createProperty(BrotliDecompress)
+  });
+}
+
 // These should be considered deprecated
 // expose all the zlib constants
 const bkeys = Object.keys(constants);
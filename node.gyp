@@ -17,6 +17,7 @@
     'node_shared_cares%': 'false',
     'node_shared_libuv%': 'false',
     'node_shared_nghttp2%': 'false',
+    'node_shared_brotli%': 'false',
     'node_use_openssl%': 'true',
     'node_shared_openssl%': 'false',
     'node_v8_options%': '',
@@ -329,6 +330,7 @@
 
       'sources': [
         'src/async_wrap.cc',
+        'src/base64.cc',
         'src/bootstrapper.cc',
         'src/callback_scope.cc',
         'src/cares_wrap.cc',
@@ -377,6 +379,7 @@
         'src/process_wrap.cc',
         'src/sharedarraybuffer_metadata.cc',
         'src/signal_wrap.cc',
+        'src/simd_utils.cc',
         'src/spawn_sync.cc',
         'src/string_bytes.cc',
         'src/string_decoder.cc',
@@ -386,6 +389,7 @@
         'src/tcp_wrap.cc',
         'src/timers.cc',
         'src/tracing/agent.cc',
+        'src/tracing/binary_trace_writer.cc',
         'src/tracing/node_trace_buffer.cc',
         'src/tracing/node_trace_writer.cc',
         'src/tracing/trace_event.cc',
@@ -397,6 +401,7 @@
         'src/aliased_buffer.h',
         'src/async_wrap.h',
         'src/async_wrap-inl.h',
+        'src/base64.h',
         'src/base_object.h',
         'src/base_object-inl.h',
         'src/connection_wrap.h',
@@ -438,6 +443,7 @@
         'src/req_wrap.h',
         'src/req_wrap-inl.h',
         'src/sharedarraybuffer_metadata.h',
+        'src/simd_utils.h',
         'src/string_bytes.h',
         'src/string_decoder.h',
         'src/string_decoder-inl.h',
@@ -446,6 +452,7 @@
         'src/stream_pipe.h',
         'src/stream_wrap.h',
         'src/tracing/agent.h',
+        'src/tracing/binary_trace_writer.h',
         'src/tracing/node_trace_buffer.h',
         'src/tracing/node_trace_writer.h',
         'src/tracing/trace_event.h',
@@ -619,9 +626,13 @@
             'src/node_crypto.cc',
             'src/node_crypto_bio.cc',
             'src/node_crypto_clienthello.cc',
+            'src/node_crypto_key_operation.cc',
+            'src/node_crypto_session_cache.cc',
             'src/node_crypto.h',
             'src/node_crypto_bio.h',
             'src/node_crypto_clienthello.h',
+            'src/node_crypto_key_operation.h',
+            'src/node_crypto_session_cache.h',
             'src/tls_wrap.cc',
             'src/tls_wrap.h'
           ],
@@ -960,8 +971,10 @@
         'test/cctest/test_aliased_buffer.cc',
         'test/cctest/test_base64.cc',
         'test/cctest/test_node_postmortem_metadata.cc',
+        'test/cctest/test_node_trace_buffer.cc',
         'test/cctest/test_environment.cc',
         'test/cctest/test_platform.cc',
+        'test/cctest/test_simd_utils.cc',
         'test/cctest/test_util.cc',
         'test/cctest/test_url.cc'
       ],
@@ -971,6 +984,9 @@
           'defines': [
             'HAVE_OPENSSL=1',
           ],
+          'sources': [
+            'test/cctest/test_node_crypto_bio.cc',
+          ],
         }],
         [ 'node_use_perfctr=="true"', {
           'defines': [ 'HAVE_PERFCTR=1' ],
@@ -0,0 +1,38 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := v8_dump_build_config
+### Rules for action "v8_dump_build_config":
+quiet_cmd__root_repo_deps_v8_gypfiles_v8_gyp_v8_dump_build_config_target_v8_dump_build_config = ACTION _root_repo_deps_v8_gypfiles_v8_gyp_v8_dump_build_config_target_v8_dump_build_config $@
+cmd__root_repo_deps_v8_gypfiles_v8_gyp_v8_dump_build_config_target_v8_dump_build_config = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/deps/v8/gypfiles; mkdir -p $(builddir); python ../tools//testrunner/utils/dump_build_config_gyp.py "$(builddir)/v8_build_config.json" "dcheck_always_on=0" "is_asan=0" "is_cfi=0" "is_component_build=static_library" "is_debug=$(BUILDTYPE)" "is_gcov_coverage=0" "is_msan=0" "is_tsan=0" "is_ubsan_vptr=0" "target_cpu=x64" "v8_enable_i18n_support=1" "v8_enable_verify_predictable=0" "v8_target_cpu=x64" "v8_use_snapshot=true"
+
+$(builddir)/v8_build_config.json: obj := $(abs_obj)
+$(builddir)/v8_build_config.json: builddir := $(abs_builddir)
+$(builddir)/v8_build_config.json: TOOLSET := $(TOOLSET)
+$(builddir)/v8_build_config.json: $(srcdir)/deps/v8/tools/testrunner/utils/dump_build_config_gyp.py FORCE_DO_CMD
+	$(call do_cmd,_root_repo_deps_v8_gypfiles_v8_gyp_v8_dump_build_config_target_v8_dump_build_config)
+
+all_deps += $(builddir)/v8_build_config.json
+action__root_repo_deps_v8_gypfiles_v8_gyp_v8_dump_build_config_target_v8_dump_build_config_outputs := $(builddir)/v8_build_config.json
+
+
+### Rules for final target.
+# Build our special outputs first.
+$(obj).target/deps/v8/gypfiles/v8_dump_build_config.stamp: | $(action__root_repo_deps_v8_gypfiles_v8_gyp_v8_dump_build_config_target_v8_dump_build_config_outputs)
+
+# Preserve order dependency of special output on deps.
+$(action__root_repo_deps_v8_gypfiles_v8_gyp_v8_dump_build_config_target_v8_dump_build_config_outputs): | 
+
+$(obj).target/deps/v8/gypfiles/v8_dump_build_config.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/deps/v8/gypfiles/v8_dump_build_config.stamp:  FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/deps/v8/gypfiles/v8_dump_build_config.stamp
+# Add target alias
+.PHONY: v8_dump_build_config
+v8_dump_build_config: $(obj).target/deps/v8/gypfiles/v8_dump_build_config.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: v8_dump_build_config
+
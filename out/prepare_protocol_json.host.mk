@@ -0,0 +1,51 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := host
+TARGET := prepare_protocol_json
+### Rules for action "convert_node_protocol_to_json":
+quiet_cmd__root_repo_node_gyp_prepare_protocol_json_host_convert_node_protocol_to_json = ACTION _root_repo_node_gyp_prepare_protocol_json_host_convert_node_protocol_to_json $@
+cmd__root_repo_node_gyp_prepare_protocol_json_host_convert_node_protocol_to_json = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/.; mkdir -p $(obj)/gen; python deps/v8/third_party/inspector_protocol/convert_protocol_to_json.py "$(obj)/gen/node_protocol.pdl" "$(obj)/gen/node_protocol.json"
+
+$(obj)/gen/node_protocol.json: obj := $(abs_obj)
+$(obj)/gen/node_protocol.json: builddir := $(abs_builddir)
+$(obj)/gen/node_protocol.json: TOOLSET := $(TOOLSET)
+$(obj)/gen/node_protocol.json: $(obj)/gen/node_protocol.pdl FORCE_DO_CMD
+	$(call do_cmd,_root_repo_node_gyp_prepare_protocol_json_host_convert_node_protocol_to_json)
+
+all_deps += $(obj)/gen/node_protocol.json
+action__root_repo_node_gyp_prepare_protocol_json_host_convert_node_protocol_to_json_outputs := $(obj)/gen/node_protocol.json
+
+
+### Generated for copy rule.
+$(obj)/gen/node_protocol_config.json: TOOLSET := $(TOOLSET)
+$(obj)/gen/node_protocol_config.json: $(srcdir)/src/inspector/node_protocol_config.json FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += $(obj)/gen/node_protocol_config.json
+$(obj)/gen/node_protocol.pdl: TOOLSET := $(TOOLSET)
+$(obj)/gen/node_protocol.pdl: $(srcdir)/src/inspector/node_protocol.pdl FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += $(obj)/gen/node_protocol.pdl
+_root_repo_node_gyp_prepare_protocol_json_host_copies = $(obj)/gen/node_protocol_config.json $(obj)/gen/node_protocol.pdl
+
+### Rules for final target.
+# Build our special outputs first.
+$(obj).host/prepare_protocol_json.stamp: | $(action__root_repo_node_gyp_prepare_protocol_json_host_convert_node_protocol_to_json_outputs) $(_root_repo_node_gyp_prepare_protocol_json_host_copies)
+
+# Preserve order dependency of special output on deps.
+$(action__root_repo_node_gyp_prepare_protocol_json_host_convert_node_protocol_to_json_outputs) $(_root_repo_node_gyp_prepare_protocol_json_host_copies): | 
+
+$(obj).host/prepare_protocol_json.stamp: TOOLSET := $(TOOLSET)
+$(obj).host/prepare_protocol_json.stamp:  FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).host/prepare_protocol_json.stamp
+# Add target alias
+.PHONY: prepare_protocol_json
+prepare_protocol_json: $(obj).host/prepare_protocol_json.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: prepare_protocol_json
+
@@ -640,8 +640,14 @@ AsyncWrap::AsyncWrap(Environment* env,
 
 
 AsyncWrap::~AsyncWrap() {
+  if (async_id_ != -1)
+    EmitDestroy();
+}
+
+void AsyncWrap::EmitDestroy() {
   EmitTraceEventDestroy();
-  EmitDestroy(env(), get_async_id());
+  EmitDestroy(env(), async_id_);
+  async_id_ = -1;
 }
 
 void AsyncWrap::EmitTraceEventDestroy() {
@@ -56,6 +56,7 @@ namespace node {
   V(PROCESSWRAP)                                                              \
   V(PROMISE)                                                                  \
   V(QUERYWRAP)                                                                \
+  V(SENDFILEPIPE)                                                             \
   V(SHUTDOWNWRAP)                                                             \
   V(SIGNALWRAP)                                                               \
   V(STATWATCHER)                                                              \
@@ -72,6 +73,8 @@ namespace node {
 
 #if HAVE_OPENSSL
 #define NODE_ASYNC_CRYPTO_PROVIDER_TYPES(V)                                   \
+  V(CIPHERREQUEST)                                                            \
+  V(HASHREQUEST)                                                              \
   V(PBKDF2REQUEST)                                                            \
   V(RANDOMBYTESREQUEST)                                                       \
   V(SCRYPTREQUEST)                                                            \
@@ -147,6 +150,11 @@ class AsyncWrap : public BaseObject {
   static void EmitTraceEventAfter(ProviderType type, double async_id);
   void EmitTraceEventDestroy();
 
+  // Runs the destroy() callbacks for a resource that goes back into a pool
+  // instead of being deleted. The destructor does not run them a second time
+  // unless AsyncReset() has assigned a new async id in the meantime.
+  void EmitDestroy();
+
 
   inline ProviderType provider_type() const;
 
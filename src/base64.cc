@@ -0,0 +1,283 @@
+#include "base64.h"
+#include "simd_utils.h"
+
+#include <string.h>
+
+// The vectorized kernels are compiled with per-function target attributes and
+// selected at runtime, so the binary still runs on CPUs without SSSE3/AVX2.
+// Other compilers and architectures only get the scalar code in base64.h.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define NODE_BASE64_X86 1
+#include <immintrin.h>
+#endif
+
+namespace node {
+
+#if defined(NODE_BASE64_X86)
+
+namespace {
+
+// Encoding and decoding follow the approach described by Wojciech Muła and
+// Daniel Lemire in "Faster Base64 Encoding and Decoding Using AVX2
+// Instructions": shuffle three input bytes into each 32-bit lane, split them
+// into four 6-bit indices with two multiplies and translate the indices with
+// a 16-entry pshufb lookup table.
+
+__attribute__((target("ssse3")))
+inline __m128i EncodeLanes128(__m128i in) {
+  in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7,
+                                         4, 5, 3, 4, 1, 2, 0, 1));
+  const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+  const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+  const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+  const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+  const __m128i indices = _mm_or_si128(t1, t3);
+
+  __m128i lut_index = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+  lut_index = _mm_or_si128(lut_index, _mm_and_si128(less, _mm_set1_epi8(13)));
+  const __m128i shift_lut = _mm_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+      '/' - 63, 'A', 0, 0);
+  return _mm_add_epi8(_mm_shuffle_epi8(shift_lut, lut_index), indices);
+}
+
+__attribute__((target("avx2")))
+inline __m256i EncodeLanes256(__m256i in) {
+  in = _mm256_shuffle_epi8(in, _mm256_set_epi8(
+      10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+      10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+  const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+  const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+  const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+  const __m256i indices = _mm256_or_si256(t1, t3);
+
+  __m256i lut_index = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+  const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+  lut_index = _mm256_or_si256(lut_index,
+                              _mm256_and_si256(less, _mm256_set1_epi8(13)));
+  const __m256i shift_lut = _mm256_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+      '/' - 63, 'A', 0, 0,
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+      '/' - 63, 'A', 0, 0);
+  return _mm256_add_epi8(_mm256_shuffle_epi8(shift_lut, lut_index), indices);
+}
+
+// Each 16 byte load only uses the first 12 bytes, hence the 16 byte margin.
+__attribute__((target("ssse3")))
+size_t EncodeSSSE3(const char* src, size_t slen, char* dst) {
+  size_t i = 0;
+  size_t k = 0;
+  while (i + 16 <= slen) {
+    const __m128i in =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + k), EncodeLanes128(in));
+    i += 12;
+    k += 16;
+  }
+  return i;
+}
+
+// The two 128-bit halves are loaded from src and src + 12, so 24 bytes are
+// consumed per iteration but 28 bytes have to be readable.
+__attribute__((target("avx2")))
+size_t EncodeAVX2(const char* src, size_t slen, char* dst) {
+  size_t i = 0;
+  size_t k = 0;
+  while (i + 28 <= slen) {
+    const __m128i lo =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i hi =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 12));
+    const __m256i in =
+        _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + k),
+                        EncodeLanes256(in));
+    i += 24;
+    k += 32;
+  }
+  return i + EncodeSSSE3(src + i, slen - i, dst + k);
+}
+
+// Maps every byte of a block to its 6-bit value, including the URL-safe
+// alphabet that unbase64_table accepts.  Returns false if the block contains
+// anything else (padding, whitespace, garbage) so the caller can hand it to
+// the scalar code, which knows how to deal with that.
+__attribute__((target("ssse3")))
+inline bool DecodeLanes128(__m128i* in) {
+  const __m128i c = *in;
+#define V(lo, hi) _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8((lo) - 1)),   \
+                                _mm_cmpgt_epi8(_mm_set1_epi8((hi) + 1), c))
+  const __m128i upper = V('A', 'Z');
+  const __m128i lower = V('a', 'z');
+  const __m128i digit = V('0', '9');
+#undef V
+  const __m128i plus = _mm_cmpeq_epi8(c, _mm_set1_epi8('+'));
+  const __m128i slash = _mm_cmpeq_epi8(c, _mm_set1_epi8('/'));
+  const __m128i minus = _mm_cmpeq_epi8(c, _mm_set1_epi8('-'));
+  const __m128i underscore = _mm_cmpeq_epi8(c, _mm_set1_epi8('_'));
+
+  const __m128i valid = _mm_or_si128(
+      _mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, plus)),
+      _mm_or_si128(_mm_or_si128(slash, minus), underscore));
+  if (_mm_movemask_epi8(valid) != 0xFFFF)
+    return false;
+
+  __m128i shift = _mm_and_si128(upper, _mm_set1_epi8(-65));
+  shift = _mm_or_si128(shift, _mm_and_si128(lower, _mm_set1_epi8(-71)));
+  shift = _mm_or_si128(shift, _mm_and_si128(digit, _mm_set1_epi8(4)));
+  shift = _mm_or_si128(shift, _mm_and_si128(plus, _mm_set1_epi8(19)));
+  shift = _mm_or_si128(shift, _mm_and_si128(slash, _mm_set1_epi8(16)));
+  shift = _mm_or_si128(shift, _mm_and_si128(minus, _mm_set1_epi8(17)));
+  shift = _mm_or_si128(shift, _mm_and_si128(underscore, _mm_set1_epi8(-32)));
+  const __m128i values = _mm_add_epi8(c, shift);
+
+  // Merge four 6-bit values into one 24-bit value per 32-bit lane, then
+  // gather the three big-endian bytes of every lane into the low 12 bytes.
+  const __m128i pairs =
+      _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+  const __m128i merged = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+  *in = _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9,
+                                               8, 14, 13, 12, -1, -1, -1, -1));
+  return true;
+}
+
+__attribute__((target("avx2")))
+inline bool DecodeLanes256(__m256i* in) {
+  const __m256i c = *in;
+#define V(lo, hi)                                                             \
+  _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8((lo) - 1)),          \
+                   _mm256_cmpgt_epi8(_mm256_set1_epi8((hi) + 1), c))
+  const __m256i upper = V('A', 'Z');
+  const __m256i lower = V('a', 'z');
+  const __m256i digit = V('0', '9');
+#undef V
+  const __m256i plus = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('+'));
+  const __m256i slash = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('/'));
+  const __m256i minus = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('-'));
+  const __m256i underscore = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('_'));
+
+  const __m256i valid = _mm256_or_si256(
+      _mm256_or_si256(_mm256_or_si256(upper, lower),
+                      _mm256_or_si256(digit, plus)),
+      _mm256_or_si256(_mm256_or_si256(slash, minus), underscore));
+  if (_mm256_movemask_epi8(valid) != -1)
+    return false;
+
+  __m256i shift = _mm256_and_si256(upper, _mm256_set1_epi8(-65));
+  shift = _mm256_or_si256(shift,
+                          _mm256_and_si256(lower, _mm256_set1_epi8(-71)));
+  shift = _mm256_or_si256(shift, _mm256_and_si256(digit, _mm256_set1_epi8(4)));
+  shift = _mm256_or_si256(shift, _mm256_and_si256(plus, _mm256_set1_epi8(19)));
+  shift = _mm256_or_si256(shift,
+                          _mm256_and_si256(slash, _mm256_set1_epi8(16)));
+  shift = _mm256_or_si256(shift,
+                          _mm256_and_si256(minus, _mm256_set1_epi8(17)));
+  shift = _mm256_or_si256(shift,
+                          _mm256_and_si256(underscore, _mm256_set1_epi8(-32)));
+  const __m256i values = _mm256_add_epi8(c, shift);
+
+  const __m256i pairs =
+      _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+  const __m256i merged =
+      _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+  const __m256i packed = _mm256_shuffle_epi8(merged, _mm256_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+  // Close the gap between the 12 byte results of the two 128-bit lanes.
+  *in = _mm256_permutevar8x32_epi32(packed,
+                                    _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+  return true;
+}
+
+// Exactly 12 (resp. 24) bytes are stored per block: base64_decode() must not
+// touch the part of the destination buffer that it doesn't report as written.
+__attribute__((target("ssse3")))
+size_t DecodeSSSE3(char* dst, size_t dstlen,
+                   const char* src, size_t srclen, size_t* written) {
+  size_t i = 0;
+  size_t k = 0;
+  while (i + 16 <= srclen && k + 12 <= dstlen) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    if (!DecodeLanes128(&v))
+      break;
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + k), v);
+    const uint32_t tail = _mm_cvtsi128_si32(_mm_srli_si128(v, 8));
+    memcpy(dst + k + 8, &tail, sizeof(tail));
+    i += 16;
+    k += 12;
+  }
+  *written = k;
+  return i;
+}
+
+__attribute__((target("avx2")))
+size_t DecodeAVX2(char* dst, size_t dstlen,
+                  const char* src, size_t srclen, size_t* written) {
+  size_t i = 0;
+  size_t k = 0;
+  while (i + 32 <= srclen && k + 24 <= dstlen) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    if (!DecodeLanes256(&v))
+      break;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + k),
+                     _mm256_castsi256_si128(v));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + k + 16),
+                     _mm256_extracti128_si256(v, 1));
+    i += 32;
+    k += 24;
+  }
+  // Pick up a trailing 16 byte block, or retry the block that failed to find
+  // out if at least its first half is clean.
+  size_t tail_written;
+  i += DecodeSSSE3(dst + k, dstlen - k, src + i, srclen - i, &tail_written);
+  *written = k + tail_written;
+  return i;
+}
+
+}  // anonymous namespace
+
+size_t base64_encode_simd(const char* src, size_t slen, char* dst) {
+  switch (simd::GetLevel()) {
+    case simd::Level::kAVX2:
+      return EncodeAVX2(src, slen, dst);
+    case simd::Level::kSSSE3:
+      return EncodeSSSE3(src, slen, dst);
+    default:
+      return 0;
+  }
+}
+
+size_t base64_decode_simd(char* dst, size_t dstlen,
+                          const char* src, size_t srclen, size_t* written) {
+  switch (simd::GetLevel()) {
+    case simd::Level::kAVX2:
+      return DecodeAVX2(dst, dstlen, src, srclen, written);
+    case simd::Level::kSSSE3:
+      return DecodeSSSE3(dst, dstlen, src, srclen, written);
+    default:
+      *written = 0;
+      return 0;
+  }
+}
+
+#else  // !defined(NODE_BASE64_X86)
+
+size_t base64_encode_simd(const char* src, size_t slen, char* dst) {
+  return 0;
+}
+
+size_t base64_decode_simd(char* dst, size_t dstlen,
+                          const char* src, size_t srclen, size_t* written) {
+  *written = 0;
+  return 0;
+}
+
+#endif  // defined(NODE_BASE64_X86)
+
+}  // namespace node
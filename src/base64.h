@@ -52,6 +52,39 @@ extern const int8_t unbase64_table[256];
   static_cast<uint8_t>(unbase64_table[static_cast<uint8_t>(x)])
 
 
+// SSSE3/AVX2 kernels, selected at runtime (see base64.cc).  They process the
+// longest prefix that they can handle and return the number of input bytes
+// consumed; the scalar code below takes care of the rest.  Both return 0 on
+// CPUs and compilers without vector support.
+size_t base64_encode_simd(const char* src, size_t slen, char* dst);
+size_t base64_decode_simd(char* dst, size_t dstlen,
+                          const char* src, size_t srclen, size_t* written);
+
+// Below this many input bytes the scalar loop is faster than the call.
+static const size_t kBase64SimdThreshold = 32;
+
+// Only one-byte input can be fed to the vector kernels as-is.
+template <typename TypeName>
+inline size_t base64_decode_vector(char* const dst, const size_t dstlen,
+                                   const TypeName* const src,
+                                   const size_t srclen, size_t* const k) {
+  return 0;
+}
+
+inline size_t base64_decode_vector(char* const dst, const size_t dstlen,
+                                   const char* const src, const size_t srclen,
+                                   size_t* const k) {
+  if (srclen < kBase64SimdThreshold)
+    return 0;
+  const size_t offset = *k;
+  size_t written;
+  const size_t consumed =
+      base64_decode_simd(dst + offset, dstlen - offset, src, srclen, &written);
+  *k = offset + written;
+  return consumed;
+}
+
+
 template <typename TypeName>
 bool base64_decode_group_slow(char* const dst, const size_t dstlen,
                               const TypeName* const src, const size_t srclen,
@@ -90,8 +123,8 @@ size_t base64_decode_fast(char* const dst, const size_t dstlen,
   const size_t available = dstlen < decoded_size ? dstlen : decoded_size;
   const size_t max_k = available / 3 * 3;
   size_t max_i = srclen / 4 * 4;
-  size_t i = 0;
   size_t k = 0;
+  size_t i = base64_decode_vector(dst, max_k, src, max_i, &k);
   while (i < max_i && k < max_k) {
     const uint32_t v =
         unbase64(src[i + 0]) << 24 |
@@ -103,6 +136,9 @@ size_t base64_decode_fast(char* const dst, const size_t dstlen,
       if (!base64_decode_group_slow(dst, dstlen, src, srclen, &i, &k))
         return k;
       max_i = i + (srclen - i) / 4 * 4;  // Align max_i again.
+      // Whitespace is usually followed by another long run of clean input.
+      if (k < max_k)
+        i += base64_decode_vector(dst, max_k, src + i, max_i - i, &k);
     } else {
       dst[k + 0] = ((v >> 22) & 0xFC) | ((v >> 20) & 0x03);
       dst[k + 1] = ((v >> 12) & 0xF0) | ((v >> 10) & 0x0F);
@@ -125,10 +161,10 @@ size_t base64_decode(char* const dst, const size_t dstlen,
   return base64_decode_fast(dst, dstlen, src, srclen, decoded_size);
 }
 
-static size_t base64_encode(const char* src,
-                            size_t slen,
-                            char* dst,
-                            size_t dlen) {
+static inline size_t base64_encode(const char* src,
+                                   size_t slen,
+                                   char* dst,
+                                   size_t dlen) {
   // We know how much we'll write, just make sure that there's space.
   CHECK(dlen >= base64_encoded_size(slen) &&
         "not enough space provided for base64 encode");
@@ -146,9 +182,11 @@ static size_t base64_encode(const char* src,
                               "abcdefghijklmnopqrstuvwxyz"
                               "0123456789+/";
 
-  i = 0;
-  k = 0;
   n = slen / 3 * 3;
+  i = 0;
+  if (slen >= kBase64SimdThreshold)
+    i = base64_encode_simd(src, n, dst);
+  k = i / 3 * 4;
 
   while (i < n) {
     a = src[i + 0] & 0xff;
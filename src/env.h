@@ -221,6 +221,7 @@ struct PackageConfig {
   V(onheaders_string, "onheaders")                                            \
   V(oninit_string, "oninit")                                                  \
   V(onmessage_string, "onmessage")                                            \
+  V(onmessagebatch_string, "onmessagebatch")                                  \
   V(onnewsession_string, "onnewsession")                                      \
   V(onocspresponse_string, "onocspresponse")                                  \
   V(ongoawaydata_string, "ongoawaydata")                                      \
@@ -385,6 +386,7 @@ class IsolateData {
 #undef VP
 
   std::unordered_map<nghttp2_rcbuf*, v8::Eternal<v8::String>> http2_static_strs;
+  std::vector<v8::Eternal<v8::String>> http_parser_static_strs;
   inline v8::Isolate* isolate() const;
 
  private:
@@ -193,6 +193,7 @@ static node_module* modlist_addon;
 static std::string trace_enabled_categories;  // NOLINT(runtime/string)
 static std::string trace_file_pattern =  // NOLINT(runtime/string)
   "node_trace.${rotation}.log";
+static tracing::TraceFormat trace_file_format = tracing::TraceFormat::kJSON;
 static bool abort_on_uncaught_exception = false;
 
 // Bit flag used to track security reverts (see node_revert.h)
@@ -292,7 +293,8 @@ DebugOptions debug_options;
 static struct {
 #if NODE_USE_V8_PLATFORM
   void Initialize(int thread_pool_size) {
-    tracing_agent_.reset(new tracing::Agent(trace_file_pattern));
+    tracing_agent_.reset(
+        new tracing::Agent(trace_file_pattern, trace_file_format));
     auto controller = tracing_agent_->GetTracingController();
     tracing::TraceEventHelper::SetTracingController(controller);
     StartTracingAgent();
@@ -2536,6 +2538,10 @@ static void PrintHelp() {
          "                             filepath for the trace-events data, it\n"
          "                             supports ${rotation} and ${pid}\n"
          "                             log-rotation id. %%2$u is the pid.\n"
+         "  --trace-event-format=format\n"
+         "                             format of the trace-events data, one\n"
+         "                             of json (default), binary or\n"
+         "                             binary-gzip\n"
          "  --trace-events-enabled     track trace events\n"
          "  --trace-sync-io            show stack trace when use of sync IO\n"
          "                             is detected after the first tick\n"
@@ -2667,6 +2673,7 @@ static void CheckIfAllowedInEnv(const char* exe, bool is_env,
     "--trace-deprecation",
     "--trace-event-categories",
     "--trace-event-file-pattern",
+    "--trace-event-format",
     "--trace-events-enabled",
     "--trace-sync-io",
     "--trace-warnings",
@@ -2826,6 +2833,18 @@ static void ParseArgs(int* argc,
       }
       args_consumed += 1;
       trace_file_pattern = file_pattern;
+    } else if (strncmp(arg, "--trace-event-format=", 21) == 0) {
+      const char* format = arg + 21;
+      if (strcmp(format, "json") == 0) {
+        trace_file_format = tracing::TraceFormat::kJSON;
+      } else if (strcmp(format, "binary") == 0) {
+        trace_file_format = tracing::TraceFormat::kBinary;
+      } else if (strcmp(format, "binary-gzip") == 0) {
+        trace_file_format = tracing::TraceFormat::kCompressedBinary;
+      } else {
+        fprintf(stderr, "%s: invalid value for %s\n", argv[0], arg);
+        exit(9);
+      }
     } else if (strcmp(arg, "--track-heap-objects") == 0) {
       track_heap_objects = true;
     } else if (strcmp(arg, "--throw-deprecation") == 0) {
@@ -3729,6 +3748,12 @@ int Start(int argc, char** argv) {
   V8::Initialize();
   performance::performance_v8_start = PERFORMANCE_NOW();
   v8_initialized = true;
+
+  // Track the time spent blocked in the poll phase, it is reported by
+  // performance.eventLoopMetrics(). Fails with UV_ENOSYS on platforms where
+  // libuv does not implement it.
+  uv_loop_configure(uv_default_loop(), UV_METRICS_IDLE_TIME);
+
   const int exit_code =
       Start(uv_default_loop(), argc, argv, exec_argc, exec_argv);
   v8_platform.StopTracingAgent();
@@ -24,6 +24,11 @@
 
 #include "zlib.h"
 
+#if HAVE_BROTLI
+#include "brotli/decode.h"
+#include "brotli/encode.h"
+#endif
+
 #include <errno.h>
 #if !defined(_MSC_VER)
 #include <unistd.h>
@@ -1235,7 +1240,9 @@ void DefineZlibConstants(Local<Object> target) {
     GUNZIP,
     DEFLATERAW,
     INFLATERAW,
-    UNZIP
+    UNZIP,
+    BROTLI_DECODE,
+    BROTLI_ENCODE
   };
 
   NODE_DEFINE_CONSTANT(target, DEFLATE);
@@ -1258,6 +1265,44 @@ void DefineZlibConstants(Local<Object> target) {
   NODE_DEFINE_CONSTANT(target, Z_MIN_LEVEL);
   NODE_DEFINE_CONSTANT(target, Z_MAX_LEVEL);
   NODE_DEFINE_CONSTANT(target, Z_DEFAULT_LEVEL);
+
+#if HAVE_BROTLI
+  NODE_DEFINE_CONSTANT(target, BROTLI_DECODE);
+  NODE_DEFINE_CONSTANT(target, BROTLI_ENCODE);
+
+  NODE_DEFINE_CONSTANT(target, BROTLI_OPERATION_PROCESS);
+  NODE_DEFINE_CONSTANT(target, BROTLI_OPERATION_FLUSH);
+  NODE_DEFINE_CONSTANT(target, BROTLI_OPERATION_FINISH);
+
+  // encoder parameters
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_MODE);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MODE_GENERIC);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MODE_TEXT);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MODE_FONT);
+  NODE_DEFINE_CONSTANT(target, BROTLI_DEFAULT_MODE);
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_QUALITY);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MIN_QUALITY);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MAX_QUALITY);
+  NODE_DEFINE_CONSTANT(target, BROTLI_DEFAULT_QUALITY);
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_LGWIN);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MIN_WINDOW_BITS);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MAX_WINDOW_BITS);
+  NODE_DEFINE_CONSTANT(target, BROTLI_LARGE_MAX_WINDOW_BITS);
+  NODE_DEFINE_CONSTANT(target, BROTLI_DEFAULT_WINDOW);
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_LGBLOCK);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MIN_INPUT_BLOCK_BITS);
+  NODE_DEFINE_CONSTANT(target, BROTLI_MAX_INPUT_BLOCK_BITS);
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_DISABLE_LITERAL_CONTEXT_MODELING);
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_SIZE_HINT);
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_LARGE_WINDOW);
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_NPOSTFIX);
+  NODE_DEFINE_CONSTANT(target, BROTLI_PARAM_NDIRECT);
+
+  // decoder parameters
+  NODE_DEFINE_CONSTANT(target,
+                       BROTLI_DECODER_PARAM_DISABLE_RING_BUFFER_REALLOCATION);
+  NODE_DEFINE_CONSTANT(target, BROTLI_DECODER_PARAM_LARGE_WINDOW);
+#endif  // HAVE_BROTLI
 }
 
 void DefineDLOpenConstants(Local<Object> target) {
@@ -27,6 +27,7 @@
 #include "node_crypto_bio.h"
 #include "node_crypto_groups.h"
 #include "node_crypto_clienthello-inl.h"
+#include "node_crypto_key_operation.h"
 #include "node_mutex.h"
 #include "node_internals.h"
 #include "tls_wrap.h"  // TLSWrap
@@ -79,6 +80,7 @@ using v8::Local;
 using v8::Maybe;
 using v8::MaybeLocal;
 using v8::NewStringType;
+using v8::Number;
 using v8::Nothing;
 using v8::Null;
 using v8::Object;
@@ -351,6 +353,12 @@ void SecureContext::Initialize(Environment* env, Local<Object> target) {
   env->SetProtoMethod(t, "setTicketKeys", SetTicketKeys);
   env->SetProtoMethod(t, "setFreeListLength", SetFreeListLength);
   env->SetProtoMethod(t, "enableTicketKeyCallback", EnableTicketKeyCallback);
+  env->SetProtoMethod(t, "enableSessionCache", EnableSessionCache);
+  env->SetProtoMethodNoSideEffect(t, "getSessionCacheStats",
+                                  GetSessionCacheStats);
+  env->SetProtoMethodNoSideEffect(t, "getBufferMemoryStats",
+                                  GetBufferMemoryStats);
+  env->SetProtoMethod(t, "enableAsyncPrivateKey", EnableAsyncPrivateKey);
   env->SetProtoMethodNoSideEffect(t, "getCertificate", GetCertificate<true>);
   env->SetProtoMethodNoSideEffect(t, "getIssuer", GetCertificate<false>);
 
@@ -1230,6 +1238,101 @@ void SecureContext::EnableTicketKeyCallback(
 }
 
 
+// enableSessionCache(name, shards, size, timeout) makes this context store
+// the sessions of its server connections in the named SessionCache, and
+// resume them from there.
+void SecureContext::EnableSessionCache(
+    const FunctionCallbackInfo<Value>& args) {
+  SecureContext* sc;
+  ASSIGN_OR_RETURN_UNWRAP(&sc, args.Holder());
+
+  CHECK(args[0]->IsString());  // name
+  CHECK(args[1]->IsUint32());  // shards
+  CHECK(args[2]->IsUint32());  // size
+  CHECK(args[3]->IsUint32());  // timeout, in seconds
+  node::Utf8Value name(args.GetIsolate(), args[0]);
+  sc->session_cache_ =
+      SessionCache::Get(*name,
+                        args[1].As<Uint32>()->Value(),
+                        args[2].As<Uint32>()->Value(),
+                        args[3].As<Uint32>()->Value());
+  SSL_CTX_sess_set_remove_cb(sc->ctx_.get(), RemoveSessionCallback);
+}
+
+
+// Returns [hits, misses, stores, evictions, size], or undefined if the
+// context does not use a session cache.
+void SecureContext::GetSessionCacheStats(
+    const FunctionCallbackInfo<Value>& args) {
+  SecureContext* sc;
+  ASSIGN_OR_RETURN_UNWRAP(&sc, args.Holder());
+  if (!sc->session_cache_)
+    return;
+
+  Environment* env = sc->env();
+  SessionCache::Stats stats = sc->session_cache_->GetStats();
+  const double values[] = {
+    static_cast<double>(stats.hits),
+    static_cast<double>(stats.misses),
+    static_cast<double>(stats.stores),
+    static_cast<double>(stats.evictions),
+    static_cast<double>(stats.size)
+  };
+  Local<Array> array = Array::New(env->isolate(), arraysize(values));
+  for (size_t i = 0; i < arraysize(values); i++) {
+    array->Set(env->context(), i, Number::New(env->isolate(), values[i]))
+        .FromJust();
+  }
+  args.GetReturnValue().Set(array);
+}
+
+
+// Returns [bytes, peakBytes, buffers, pooledBytes], where pooledBytes is
+// shared by all contexts.
+void SecureContext::GetBufferMemoryStats(
+    const FunctionCallbackInfo<Value>& args) {
+  SecureContext* sc;
+  ASSIGN_OR_RETURN_UNWRAP(&sc, args.Holder());
+
+  Environment* env = sc->env();
+  const double values[] = {
+    static_cast<double>(sc->bio_memory_stats_->bytes),
+    static_cast<double>(sc->bio_memory_stats_->peak_bytes),
+    static_cast<double>(sc->bio_memory_stats_->buffers),
+    static_cast<double>(NodeBIO::PooledBytes())
+  };
+  Local<Array> array = Array::New(env->isolate(), arraysize(values));
+  for (size_t i = 0; i < arraysize(values); i++) {
+    array->Set(env->context(), i, Number::New(env->isolate(), values[i]))
+        .FromJust();
+  }
+  args.GetReturnValue().Set(array);
+}
+
+
+// Makes the handshakes of servers that use this context run the operations
+// of its current private key on the threadpool. Returns false if that is not
+// supported.
+void SecureContext::EnableAsyncPrivateKey(
+    const FunctionCallbackInfo<Value>& args) {
+  SecureContext* sc;
+  ASSIGN_OR_RETURN_UNWRAP(&sc, args.Holder());
+
+  EVP_PKEY* pkey = SSL_CTX_get0_privatekey(sc->ctx_.get());
+  sc->async_private_key_ =
+      pkey != nullptr && EnableAsyncKeyOperations(pkey);
+  args.GetReturnValue().Set(sc->async_private_key_);
+}
+
+
+// Called by OpenSSL for sessions that must not be resumed anymore.
+void SecureContext::RemoveSessionCallback(SSL_CTX* ctx, SSL_SESSION* sess) {
+  SecureContext* sc = static_cast<SecureContext*>(SSL_CTX_get_app_data(ctx));
+  if (sc != nullptr && sc->session_cache_)
+    sc->session_cache_->Remove(sess);
+}
+
+
 int SecureContext::TicketKeyCallback(SSL* ssl,
                                      unsigned char* name,
                                      unsigned char* iv,
@@ -1424,7 +1527,16 @@ SSL_SESSION* SSLWrap<Base>::GetSessionCallback(SSL* s,
   Base* w = static_cast<Base*>(SSL_get_app_data(s));
 
   *copy = 0;
-  return w->next_sess_.release();
+  if (w->next_sess_)
+    return w->next_sess_.release();
+
+  // Look the session up in the native cache, if there is one. This does not
+  // need a round trip to JS.
+  SecureContext* sc = static_cast<SecureContext*>(
+      SSL_CTX_get_app_data(SSL_get_SSL_CTX(s)));
+  if (sc != nullptr && sc->session_cache_)
+    return sc->session_cache_->Lookup(key, len);
+  return nullptr;
 }
 
 
@@ -1435,6 +1547,11 @@ int SSLWrap<Base>::NewSessionCallback(SSL* s, SSL_SESSION* sess) {
   HandleScope handle_scope(env->isolate());
   Context::Scope context_scope(env->context());
 
+  SecureContext* sc = static_cast<SecureContext*>(
+      SSL_CTX_get_app_data(SSL_get_SSL_CTX(s)));
+  if (sc != nullptr && sc->session_cache_)
+    sc->session_cache_->Store(sess, SecureContext::kMaxSessionSize);
+
   if (!w->session_callbacks_)
     return 0;
 
@@ -2378,7 +2495,7 @@ int SSLWrap<Base>::SSLCertCallback(SSL* s, void* arg) {
     return 1;
 
   if (!w->is_waiting_cert_cb())
-    return 1;
+    return w->PauseForKeyOperations(s);
 
   if (w->cert_cb_running_)
     return -1;
@@ -2410,13 +2527,30 @@ int SSLWrap<Base>::SSLCertCallback(SSL* s, void* arg) {
   w->MakeCallback(env->oncertcb_string(), arraysize(argv), argv);
 
   if (!w->cert_cb_running_)
-    return 1;
+    return w->PauseForKeyOperations(s);
 
   // Performing async action, wait...
   return -1;
 }
 
 
+// The server's private key operations come after the certificate callback.
+// If they can be offloaded, pause the handshake here once, so that its owner
+// continues it in an OpenSSL async job, see KeyOperationJob. The rest of the
+// async part of the handshake must not call into JS.
+template <class Base>
+int SSLWrap<Base>::PauseForKeyOperations(SSL* s) {
+  if (async_key_operations_ ||
+      KeyOperationScope::Current() == nullptr ||
+      !HasAsyncKeyOperations(SSL_get_privatekey(s))) {
+    return 1;
+  }
+
+  async_key_operations_ = true;
+  return -1;
+}
+
+
 template <class Base>
 void SSLWrap<Base>::CertCbDone(const FunctionCallbackInfo<Value>& args) {
   Base* w;
@@ -2569,6 +2703,7 @@ void CipherBase::Initialize(Environment* env, Local<Object> target) {
   env->SetProtoMethod(t, "init", Init);
   env->SetProtoMethod(t, "initiv", InitIv);
   env->SetProtoMethod(t, "update", Update);
+  env->SetProtoMethod(t, "updateInto", UpdateInto);
   env->SetProtoMethod(t, "final", Final);
   env->SetProtoMethod(t, "setAutoPadding", SetAutoPadding);
   env->SetProtoMethodNoSideEffect(t, "getAuthTag", GetAuthTag);
@@ -2976,6 +3111,22 @@ CipherBase::UpdateResult CipherBase::Update(const char* data,
                                             int len,
                                             unsigned char** out,
                                             int* out_len) {
+  *out_len = 0;
+  int buff_len;
+  UpdateResult r = PrepareUpdate(data, len, &buff_len);
+  if (r != kSuccess)
+    return r;
+
+  *out = Malloc<unsigned char>(buff_len);
+  r = UpdateInto(data, len, *out, out_len);
+  CHECK_LE(*out_len, buff_len);
+  return r;
+}
+
+
+CipherBase::UpdateResult CipherBase::PrepareUpdate(const char* data,
+                                                   int len,
+                                                   int* buff_len) {
   if (!ctx_)
     return kErrorState;
 
@@ -2996,28 +3147,36 @@ CipherBase::UpdateResult CipherBase::Update(const char* data,
     auth_tag_set_ = true;
   }
 
-  *out_len = 0;
-  int buff_len = len + EVP_CIPHER_CTX_block_size(ctx_.get());
+  // The output can be up to one block larger than the input, except for
+  // stream ciphers (and stream modes), which is what allows updateInto() to
+  // work in place for them.
+  const int block_size = EVP_CIPHER_CTX_block_size(ctx_.get());
+  *buff_len = block_size > 1 ? len + block_size : len;
   // For key wrapping algorithms, get output size by calling
   // EVP_CipherUpdate() with null output.
   if (kind_ == kCipher && mode == EVP_CIPH_WRAP_MODE &&
       EVP_CipherUpdate(ctx_.get(),
                        nullptr,
-                       &buff_len,
+                       buff_len,
                        reinterpret_cast<const unsigned char*>(data),
                        len) != 1) {
     return kErrorState;
   }
+  return kSuccess;
+}
 
-  *out = Malloc<unsigned char>(buff_len);
+
+CipherBase::UpdateResult CipherBase::UpdateInto(const char* data,
+                                                int len,
+                                                unsigned char* out,
+                                                int* out_len) {
+  const int mode = EVP_CIPHER_CTX_mode(ctx_.get());
   int r = EVP_CipherUpdate(ctx_.get(),
-                           *out,
+                           out,
                            out_len,
                            reinterpret_cast<const unsigned char*>(data),
                            len);
 
-  CHECK_LE(*out_len, buff_len);
-
   // When in CCM mode, EVP_CipherUpdate will fail if the authentication tag is
   // invalid. In that case, remember the error and throw in final().
   if (!r && kind_ == kDecipher && mode == EVP_CIPH_CCM_MODE) {
@@ -3067,6 +3226,64 @@ void CipherBase::Update(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// Defined below, next to the other jobs that run on the threadpool.
+void CipherUpdateAsync(Environment* env,
+                       CipherBase* cipher,
+                       const char* data,
+                       int len,
+                       unsigned char* out,
+                       Local<Value> wrap);
+
+
+// updateInto(input, output, offset, wrap) writes the result of update() to
+// output at the given offset instead of allocating a new buffer, and returns
+// the number of bytes written, or -1 if output is too small. With a wrap
+// object, the data is processed on the threadpool and the number of bytes is
+// passed to the wrap object's ondone() instead.
+void CipherBase::UpdateInto(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  CipherBase* cipher;
+  ASSIGN_OR_RETURN_UNWRAP(&cipher, args.Holder());
+
+  CHECK(args[0]->IsArrayBufferView());  // input; wrap object retains ref.
+  CHECK(args[1]->IsArrayBufferView());  // output; wrap object retains ref.
+  CHECK(args[2]->IsUint32());  // offset
+  CHECK(args[3]->IsObject() || args[3]->IsUndefined());  // wrap object
+  const char* data = Buffer::Data(args[0]);
+  const size_t len = Buffer::Length(args[0]);
+  const uint32_t offset = args[2].As<Uint32>()->Value();
+  const size_t out_size = Buffer::Length(args[1]);
+  CHECK_LE(offset, out_size);
+  CHECK_LE(len, static_cast<size_t>(INT_MAX));
+
+  int buff_len;
+  UpdateResult r = cipher->PrepareUpdate(data, len, &buff_len);
+  if (r != kSuccess) {
+    if (r == kErrorState) {
+      ThrowCryptoError(env, ERR_get_error(),
+                       "Trying to add data in unsupported state");
+    }
+    return;
+  }
+  if (static_cast<size_t>(buff_len) > out_size - offset)
+    return args.GetReturnValue().Set(-1);
+
+  unsigned char* out =
+      reinterpret_cast<unsigned char*>(Buffer::Data(args[1])) + offset;
+  if (args[3]->IsObject())
+    return CipherUpdateAsync(env, cipher, data, len, out, args[3]);
+
+  int out_len = 0;
+  if (cipher->UpdateInto(data, len, out, &out_len) != kSuccess) {
+    return ThrowCryptoError(env, ERR_get_error(),
+                            "Trying to add data in unsupported state");
+  }
+  CHECK_LE(out_len, buff_len);
+  args.GetReturnValue().Set(out_len);
+}
+
+
 bool CipherBase::SetAutoPadding(bool auto_padding) {
   if (!ctx_)
     return false;
@@ -3277,6 +3494,15 @@ void Hmac::HmacDigest(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// Defined below, next to the other jobs that run on the threadpool.
+void HashUpdateAsync(Environment* env,
+                     EVP_MD_CTX* mdctx,
+                     const char* data,
+                     size_t size,
+                     bool finalize,
+                     Local<Value> wrap);
+
+
 void Hash::Initialize(Environment* env, v8::Local<Object> target) {
   Local<FunctionTemplate> t = env->NewFunctionTemplate(New);
 
@@ -3330,6 +3556,17 @@ void Hash::HashUpdate(const FunctionCallbackInfo<Value>& args) {
   Hash* hash;
   ASSIGN_OR_RETURN_UNWRAP(&hash, args.Holder());
 
+  // With a wrap object, the data is hashed on the threadpool. The wrap object
+  // retains both the data and this object until its ondone() is called.
+  if (args[2]->IsObject()) {
+    CHECK(args[0]->IsArrayBufferView());
+    if (!hash->mdctx_)
+      return args.GetReturnValue().Set(false);
+    HashUpdateAsync(env, hash->mdctx_.get(), Buffer::Data(args[0]),
+                    Buffer::Length(args[0]), false, args[2]);
+    return args.GetReturnValue().Set(true);
+  }
+
   // Only copy the data if we have to, because it's a string
   bool r = true;
   if (args[0]->IsString()) {
@@ -3355,6 +3592,14 @@ void Hash::HashDigest(const FunctionCallbackInfo<Value>& args) {
   Hash* hash;
   ASSIGN_OR_RETURN_UNWRAP(&hash, args.Holder());
 
+  // digest(undefined, wrap) computes the digest on the threadpool and passes
+  // it to the wrap object's ondone() as a Buffer.
+  if (args[1]->IsObject()) {
+    hash->finalized_ = true;
+    HashUpdateAsync(env, hash->mdctx_.get(), nullptr, 0, true, args[1]);
+    return;
+  }
+
   enum encoding encoding = BUFFER;
   if (args.Length() >= 1) {
     encoding = ParseEncoding(env->isolate(), args[0], BUFFER);
@@ -4717,6 +4962,187 @@ inline void PBKDF2(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+struct HashJob : public CryptoJob {
+  const EVP_MD* md;
+  // The inputs are retained by the wrap object while the job is in flight.
+  std::vector<std::pair<const char*, size_t>> inputs;
+  std::vector<unsigned char> digests;
+  CryptoErrorVector errors;
+
+  inline explicit HashJob(Environment* env) : CryptoJob(env) {}
+
+  inline void DoThreadPoolWork() override {
+    const size_t md_size = EVP_MD_size(md);
+    digests.resize(inputs.size() * md_size);
+    EVPMDPointer mdctx(EVP_MD_CTX_new());
+    for (size_t i = 0; i < inputs.size(); i++) {
+      unsigned int md_len;
+      if (!mdctx ||
+          EVP_DigestInit_ex(mdctx.get(), md, nullptr) <= 0 ||
+          EVP_DigestUpdate(mdctx.get(), inputs[i].first,
+                           inputs[i].second) <= 0 ||
+          EVP_DigestFinal_ex(mdctx.get(), &digests[i * md_size],
+                             &md_len) <= 0) {
+        errors.Capture();
+        return;
+      }
+    }
+  }
+
+  inline void AfterThreadPoolWork() override {
+    Local<Value> argv[2] = { ToError(), ToDigests() };
+    async_wrap->MakeCallback(env->ondone_string(), arraysize(argv), argv);
+  }
+
+  inline Local<Value> ToError() const {
+    if (errors.empty()) return Undefined(env->isolate());
+    return errors.ToException(env);
+  }
+
+  // All digests in one Buffer, in the order of the inputs.
+  inline Local<Value> ToDigests() const {
+    if (!errors.empty()) return Undefined(env->isolate());
+    return Buffer::Copy(env,
+                        reinterpret_cast<const char*>(digests.data()),
+                        digests.size()).ToLocalChecked();
+  }
+};
+
+
+// hash(algorithm, inputs, wrap) hashes each of the ArrayBufferViews in the
+// inputs array on its own, in a single job, so that many small inputs cost one
+// trip to the threadpool.
+void HashBatch(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args[0]->IsString());  // algorithm
+  CHECK(args[1]->IsArray());  // inputs; wrap object retains them.
+  CHECK(args[2]->IsObject() || args[2]->IsUndefined());  // wrap object
+  std::unique_ptr<HashJob> job(new HashJob(env));
+  Utf8Value algorithm(args.GetIsolate(), args[0]);
+  job->md = EVP_get_digestbyname(*algorithm);
+  if (job->md == nullptr) return args.GetReturnValue().Set(-1);
+  Local<Array> inputs = args[1].As<Array>();
+  job->inputs.reserve(inputs->Length());
+  for (uint32_t i = 0; i < inputs->Length(); i++) {
+    Local<Value> input = inputs->Get(env->context(), i).ToLocalChecked();
+    CHECK(input->IsArrayBufferView());
+    job->inputs.emplace_back(Buffer::Data(input), Buffer::Length(input));
+  }
+  if (args[2]->IsObject()) return HashJob::Run(std::move(job), args[2]);
+  env->PrintSyncTrace();
+  job->DoThreadPoolWork();
+  if (!job->errors.empty()) {
+    env->isolate()->ThrowException(job->ToError());
+    return;
+  }
+  args.GetReturnValue().Set(job->ToDigests());
+}
+
+
+// Feeds data to the EVP_MD_CTX of a Hash object, and finalizes it if asked
+// to, for hash.update() and hash.digest() with a wrap object.
+struct HashUpdateJob : public CryptoJob {
+  EVP_MD_CTX* mdctx;  // Owned by the Hash object, which the wrap retains.
+  const char* data;
+  size_t size;
+  bool finalize;
+  unsigned char md_value[EVP_MAX_MD_SIZE];
+  unsigned int md_len;
+  CryptoErrorVector errors;
+
+  inline explicit HashUpdateJob(Environment* env)
+      : CryptoJob(env), md_len(0) {}
+
+  inline void DoThreadPoolWork() override {
+    if ((size > 0 && EVP_DigestUpdate(mdctx, data, size) <= 0) ||
+        (finalize && EVP_DigestFinal_ex(mdctx, md_value, &md_len) <= 0)) {
+      errors.Capture();
+    }
+  }
+
+  inline void AfterThreadPoolWork() override {
+    Local<Value> argv[2] = {
+      Undefined(env->isolate()),
+      Undefined(env->isolate())
+    };
+    if (!errors.empty()) {
+      argv[0] = errors.ToException(env);
+    } else if (finalize) {
+      argv[1] = Buffer::Copy(env,
+                             reinterpret_cast<const char*>(md_value),
+                             md_len).ToLocalChecked();
+    }
+    async_wrap->MakeCallback(env->ondone_string(), arraysize(argv), argv);
+  }
+};
+
+
+void HashUpdateAsync(Environment* env,
+                     EVP_MD_CTX* mdctx,
+                     const char* data,
+                     size_t size,
+                     bool finalize,
+                     Local<Value> wrap) {
+  std::unique_ptr<HashUpdateJob> job(new HashUpdateJob(env));
+  job->mdctx = mdctx;
+  job->data = data;
+  job->size = size;
+  job->finalize = finalize;
+  HashUpdateJob::Run(std::move(job), wrap);
+}
+
+
+struct CipherUpdateJob : public CryptoJob {
+  CipherBase* cipher;  // The wrap object retains the cipher's JS object.
+  const char* data;
+  int len;
+  unsigned char* out;
+  int out_len;
+  bool ok;
+  CryptoErrorVector errors;
+
+  inline explicit CipherUpdateJob(Environment* env)
+      : CryptoJob(env), out_len(0), ok(false) {}
+
+  inline void DoThreadPoolWork() override {
+    ok = cipher->UpdateInto(data, len, out, &out_len) ==
+         CipherBase::kSuccess;
+    // OpenSSL's error queue is thread-local, so collect the errors here.
+    if (!ok) errors.Capture();
+  }
+
+  inline void AfterThreadPoolWork() override {
+    Local<Value> argv[2] = {
+      Undefined(env->isolate()),
+      Integer::New(env->isolate(), out_len)
+    };
+    if (!ok) {
+      argv[0] = errors.empty() ?
+          errors.ToException(env, FIXED_ONE_BYTE_STRING(env->isolate(),
+              "Trying to add data in unsupported state")) :
+          errors.ToException(env);
+      argv[1] = Undefined(env->isolate());
+    }
+    async_wrap->MakeCallback(env->ondone_string(), arraysize(argv), argv);
+  }
+};
+
+
+void CipherUpdateAsync(Environment* env,
+                       CipherBase* cipher,
+                       const char* data,
+                       int len,
+                       unsigned char* out,
+                       Local<Value> wrap) {
+  std::unique_ptr<CipherUpdateJob> job(new CipherUpdateJob(env));
+  job->cipher = cipher;
+  job->data = data;
+  job->len = len;
+  job->out = out;
+  CipherUpdateJob::Run(std::move(job), wrap);
+}
+
+
 #ifndef OPENSSL_NO_SCRYPT
 struct ScryptJob : public CryptoJob {
   unsigned char* keybuf_data;
@@ -5209,6 +5635,7 @@ void Initialize(Local<Object> target,
 #endif
 
   env->SetMethod(target, "pbkdf2", PBKDF2);
+  env->SetMethod(target, "hash", HashBatch);
   env->SetMethod(target, "randomBytes", RandomBytes);
   env->SetMethodNoSideEffect(target, "timingSafeEqual", TimingSafeEqual);
   env->SetMethodNoSideEffect(target, "getSSLCiphers", GetSSLCiphers);
@@ -27,6 +27,10 @@
 #include "node.h"
 // ClientHelloParser
 #include "node_crypto_clienthello.h"
+// SessionCache
+#include "node_crypto_session_cache.h"
+// NodeBIO::MemoryStats
+#include "node_crypto_bio.h"
 
 #include "node_buffer.h"
 
@@ -108,6 +112,13 @@ class SecureContext : public BaseObject {
   SSLCtxPointer ctx_;
   X509Pointer cert_;
   X509Pointer issuer_;
+  std::shared_ptr<SessionCache> session_cache_;
+  // Memory held by the NodeBIOs of the TLS connections that use this context.
+  std::shared_ptr<NodeBIO::MemoryStats> bio_memory_stats_ =
+      std::make_shared<NodeBIO::MemoryStats>();
+  // Whether the handshakes of servers that use this context may offload
+  // their private key operations, see KeyOperationJob.
+  bool async_private_key_ = false;
 #ifndef OPENSSL_NO_ENGINE
   bool client_cert_engine_provided_ = false;
 #endif  // !OPENSSL_NO_ENGINE
@@ -163,6 +174,14 @@ class SecureContext : public BaseObject {
       const v8::FunctionCallbackInfo<v8::Value>& args);
   static void EnableTicketKeyCallback(
       const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void EnableSessionCache(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void GetSessionCacheStats(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void GetBufferMemoryStats(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void EnableAsyncPrivateKey(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
 
   template <bool primary>
   static void GetCertificate(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -174,6 +193,8 @@ class SecureContext : public BaseObject {
                                HMAC_CTX* hctx,
                                int enc);
 
+  static void RemoveSessionCallback(SSL_CTX* ctx, SSL_SESSION* sess);
+
 #if OPENSSL_VERSION_NUMBER >= 0x10100000L
   static int TicketCompatibilityCallback(SSL* ssl,
                                          unsigned char* name,
@@ -194,6 +215,7 @@ class SecureContext : public BaseObject {
     ctx_.reset();
     cert_.reset();
     issuer_.reset();
+    session_cache_.reset();
   }
 };
 
@@ -215,7 +237,8 @@ class SSLWrap {
         new_session_wait_(false),
         cert_cb_(nullptr),
         cert_cb_arg_(nullptr),
-        cert_cb_running_(false) {
+        cert_cb_running_(false),
+        async_key_operations_(false) {
     ssl_.reset(SSL_new(sc->ctx_.get()));
     CHECK(ssl_);
     env_->isolate()->AdjustAmountOfExternalAllocatedMemory(kExternalSize);
@@ -303,6 +326,7 @@ class SSLWrap {
                                 void* arg);
   static int TLSExtStatusCallback(SSL* s, void* arg);
   static int SSLCertCallback(SSL* s, void* arg);
+  int PauseForKeyOperations(SSL* s);
 
   void DestroySSL();
   void WaitForCertCb(CertCb cb, void* arg);
@@ -325,6 +349,9 @@ class SSLWrap {
   void* cert_cb_arg_;
   bool cert_cb_running_;
 
+  // Set once the handshake was paused by PauseForKeyOperations().
+  bool async_key_operations_;
+
   ClientHelloParser hello_parser_;
 
   Persistent<v8::Object> ocsp_response_;
@@ -364,6 +391,12 @@ class CipherBase : public BaseObject {
   bool CheckCCMMessageLength(int message_len);
   UpdateResult Update(const char* data, int len, unsigned char** out,
                       int* out_len);
+  // Update() is split into PrepareUpdate(), which has to run on the main
+  // thread and computes the size of the output buffer, and UpdateInto(), which
+  // only calls into OpenSSL and may run on the threadpool.
+  UpdateResult PrepareUpdate(const char* data, int len, int* buff_len);
+  UpdateResult UpdateInto(const char* data, int len, unsigned char* out,
+                          int* out_len);
   bool Final(unsigned char** out, int* out_len);
   bool SetAutoPadding(bool auto_padding);
 
@@ -374,6 +407,7 @@ class CipherBase : public BaseObject {
   static void Init(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void InitIv(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Update(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void UpdateInto(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Final(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void SetAutoPadding(const v8::FunctionCallbackInfo<v8::Value>& args);
 
@@ -394,6 +428,8 @@ class CipherBase : public BaseObject {
   }
 
  private:
+  friend struct CipherUpdateJob;
+
   DeleteFnPtr<EVP_CIPHER_CTX, EVP_CIPHER_CTX_free> ctx_;
   const CipherKind kind_;
   bool auth_tag_set_;
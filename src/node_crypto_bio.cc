@@ -20,11 +20,14 @@
 // USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "node_crypto_bio.h"
+#include "node_mutex.h"
 #include "openssl/bio.h"
 #include "util-inl.h"
 #include <limits.h>
 #include <string.h>
 
+#include <vector>
+
 namespace node {
 namespace crypto {
 
@@ -37,6 +40,25 @@ namespace crypto {
 #define BIO_get_init(bio) bio->init
 #endif
 
+namespace {
+
+// Buffers of 1024 << i bytes, i.e. from NodeBIO::kInitialBufferLength up to
+// NodeBIO::kThroughputBufferLength, are kept in buffer_pool[i].
+const size_t kPoolClassCount = 5;
+Mutex buffer_pool_mutex;
+std::vector<char*> buffer_pool[kPoolClassCount];
+size_t pooled_bytes;
+
+// Returns kPoolClassCount if buffers of `len` bytes are not pooled.
+size_t PoolClass(size_t len) {
+  size_t i = 0;
+  while (i < kPoolClassCount && len != (static_cast<size_t>(1024) << i))
+    i++;
+  return i;
+}
+
+}  // anonymous namespace
+
 
 BIO* NodeBIO::New() {
   // The const_cast doesn't violate const correctness.  OpenSSL's usage of
@@ -65,6 +87,95 @@ void NodeBIO::AssignEnvironment(Environment* env) {
 }
 
 
+void NodeBIO::AssignMemoryStats(std::shared_ptr<MemoryStats> stats) {
+  CHECK_NULL(read_head_);
+  memory_stats_ = stats;
+}
+
+
+size_t NodeBIO::PooledBytes() {
+  Mutex::ScopedLock lock(buffer_pool_mutex);
+  return pooled_bytes;
+}
+
+
+char* NodeBIO::AllocateData(size_t len) {
+  size_t i = PoolClass(len);
+  if (i < kPoolClassCount) {
+    Mutex::ScopedLock lock(buffer_pool_mutex);
+    if (!buffer_pool[i].empty()) {
+      char* data = buffer_pool[i].back();
+      buffer_pool[i].pop_back();
+      pooled_bytes -= len;
+      return data;
+    }
+  }
+  return new char[len];
+}
+
+
+void NodeBIO::FreeData(char* data, size_t len) {
+  size_t i = PoolClass(len);
+  if (i < kPoolClassCount) {
+    Mutex::ScopedLock lock(buffer_pool_mutex);
+    if (buffer_pool[i].size() < kMaxPooledBuffers) {
+      buffer_pool[i].push_back(data);
+      pooled_bytes += len;
+      return;
+    }
+  }
+  delete[] data;
+}
+
+
+NodeBIO::Buffer* NodeBIO::NewBuffer(size_t len) {
+  Buffer* buffer = new Buffer(env_, len);
+  if (memory_stats_) {
+    memory_stats_->bytes += len;
+    memory_stats_->buffers++;
+    if (memory_stats_->bytes > memory_stats_->peak_bytes)
+      memory_stats_->peak_bytes = memory_stats_->bytes;
+  }
+  return buffer;
+}
+
+
+void NodeBIO::DeleteBuffer(Buffer* buffer) {
+  if (memory_stats_) {
+    CHECK_GE(memory_stats_->bytes, buffer->len_);
+    memory_stats_->bytes -= buffer->len_;
+    memory_stats_->buffers--;
+  }
+  delete buffer;
+}
+
+
+void NodeBIO::ReleaseBuffers(bool resize) {
+  CHECK_EQ(length_, 0);
+  if (read_head_ == nullptr)
+    return;
+
+  Buffer* current = read_head_;
+  do {
+    Buffer* next = current->next_;
+    DeleteBuffer(current);
+    current = next;
+  } while (current != read_head_);
+
+  read_head_ = nullptr;
+  write_head_ = nullptr;
+  if (!resize)
+    return;
+
+  // Start smaller next time if the data did not fill a quarter of the buffers.
+  if (peak_length_ <= buffer_length_ / 4 &&
+      buffer_length_ / 2 >= kInitialBufferLength) {
+    buffer_length_ /= 2;
+  }
+  peak_length_ = 0;
+}
+
+
 int NodeBIO::New(BIO* bio) {
   BIO_set_data(bio, new NodeBIO());
 
@@ -107,12 +218,21 @@ int NodeBIO::Read(BIO* bio, char* out, int len) {
 
 
 char* NodeBIO::Peek(size_t* size) {
+  if (read_head_ == nullptr) {
+    *size = 0;
+    return nullptr;
+  }
   *size = read_head_->write_pos_ - read_head_->read_pos_;
   return read_head_->data_ + read_head_->read_pos_;
 }
 
 
 size_t NodeBIO::PeekMultiple(char** out, size_t* size, size_t* count) {
+  if (read_head_ == nullptr) {
+    *count = 0;
+    return 0;
+  }
+
   Buffer* pos = read_head_;
   size_t max = *count;
   size_t total = 0;
@@ -315,8 +435,12 @@ size_t NodeBIO::Read(char* out, size_t size) {
   CHECK_EQ(expected, bytes_read);
   length_ -= bytes_read;
 
-  // Free all empty buffers, but write_head's child
-  FreeEmpty();
+  // Give all buffers back once drained, or else free all empty buffers, but
+  // write_head's child
+  if (length_ == 0)
+    ReleaseBuffers();
+  else
+    FreeEmpty();
 
   return bytes_read;
 }
@@ -338,7 +462,7 @@ void NodeBIO::FreeEmpty() {
     CHECK_EQ(cur->write_pos_, cur->read_pos_);
 
     Buffer* next = cur->next_;
-    delete cur;
+    DeleteBuffer(cur);
     cur = next;
   }
   prev->next_ = cur;
@@ -409,6 +533,8 @@ void NodeBIO::Write(const char* data, size_t size) {
     left -= to_write;
     offset += to_write;
     length_ += to_write;
+    if (length_ > peak_length_)
+      peak_length_ = length_;
     write_head_->write_pos_ += to_write;
     CHECK_LE(write_head_->write_pos_, write_head_->len_);
 
@@ -428,7 +554,9 @@ void NodeBIO::Write(const char* data, size_t size) {
 
 
 char* NodeBIO::PeekWritable(size_t* size) {
-  TryAllocateForWrite(*size);
+  // The suggested size is usually far more than what is going to be written,
+  // the length of the buffers follows what actually was.
+  TryAllocateForWrite(0);
 
   size_t available = write_head_->len_ - write_head_->write_pos_;
   if (*size != 0 && available > *size)
@@ -441,10 +569,26 @@ char* NodeBIO::PeekWritable(size_t* size) {
 
 
 void NodeBIO::Commit(size_t size) {
+  // Nothing was read into the buffer that PeekWritable() returned. That says
+  // nothing about how much data is coming, keep the buffer length.
+  if (length_ == 0 && size == 0) {
+    ReleaseBuffers(false);
+    return;
+  }
+
   write_head_->write_pos_ += size;
   length_ += size;
+  if (length_ > peak_length_)
+    peak_length_ = length_;
   CHECK_LE(write_head_->write_pos_, write_head_->len_);
 
+  // Data is coming in faster than it fits, use larger buffers from now on
+  if (size != 0 &&
+      write_head_->write_pos_ == write_head_->len_ &&
+      buffer_length_ < kThroughputBufferLength) {
+    buffer_length_ *= 2;
+  }
+
   // Allocate new buffer if write head is full,
   // and there're no other place to go
   TryAllocateForWrite(0);
@@ -465,11 +609,13 @@ void NodeBIO::TryAllocateForWrite(size_t hint) {
   if (w == nullptr ||
       (w->write_pos_ == w->len_ &&
        (w->next_ == r || w->next_->write_pos_ != 0))) {
-    size_t len = w == nullptr ? initial_ :
-                             kThroughputBufferLength;
-    if (len < hint)
-      len = hint;
-    Buffer* next = new Buffer(env_, len);
+    // Round up to a length that the pool keeps
+    size_t len = buffer_length_;
+    if (hint > kThroughputBufferLength)
+      hint = kThroughputBufferLength;
+    while (len < hint)
+      len *= 2;
+    Buffer* next = NewBuffer(len);
 
     if (w == nullptr) {
       next->next_ = next;
@@ -484,20 +630,8 @@ void NodeBIO::TryAllocateForWrite(size_t hint) {
 
 
 void NodeBIO::Reset() {
-  if (read_head_ == nullptr)
-    return;
-
-  while (read_head_->read_pos_ != read_head_->write_pos_) {
-    CHECK(read_head_->write_pos_ > read_head_->read_pos_);
-
-    length_ -= read_head_->write_pos_ - read_head_->read_pos_;
-    read_head_->write_pos_ = 0;
-    read_head_->read_pos_ = 0;
-
-    read_head_ = read_head_->next_;
-  }
-  write_head_ = read_head_;
-  CHECK_EQ(length_, 0);
+  length_ = 0;
+  ReleaseBuffers();
 }
 
 
@@ -508,7 +642,7 @@ NodeBIO::~NodeBIO() {
   Buffer* current = read_head_;
   do {
     Buffer* next = current->next_;
-    delete current;
+    DeleteBuffer(current);
     current = next;
   } while (current != read_head_);
 
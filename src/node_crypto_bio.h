@@ -29,13 +29,29 @@
 #include "util-inl.h"
 #include "v8.h"
 
+#include <memory>
+
 namespace node {
 namespace crypto {
 
+// The data of NodeBIOs is kept in a ring of buffers. Buffers come from a
+// process-wide pool and go back to it whenever the NodeBIO is drained, so that
+// idle connections do not hold on to any memory. Their size adapts to the
+// throughput of the NodeBIO: it grows while data arrives faster than it is
+// consumed, and shrinks while bursts are small.
 class NodeBIO {
  public:
+  // Memory held by a group of NodeBIOs, e.g. those of the connections that use
+  // a SecureContext.
+  struct MemoryStats {
+    size_t bytes = 0;
+    size_t peak_bytes = 0;
+    size_t buffers = 0;
+  };
+
   NodeBIO() : env_(nullptr),
-              initial_(kInitialBufferLength),
+              buffer_length_(kInitialBufferLength),
+              peak_length_(0),
               length_(0),
               eof_return_(-1),
               read_head_(nullptr),
@@ -51,6 +67,10 @@ class NodeBIO {
   static BIO* NewFixed(const char* data, size_t len);
 
   void AssignEnvironment(Environment* env);
+  void AssignMemoryStats(std::shared_ptr<MemoryStats> stats);
+
+  // Returns the number of bytes that the pool keeps for reuse.
+  static size_t PooledBytes();
 
   // Move read head to next buffer if needed
   void TryMoveReadHead();
@@ -84,7 +104,8 @@ class NodeBIO {
   void Write(const char* data, size_t size);
 
   // Return pointer to internal data and amount of
-  // contiguous data available for future writes
+  // contiguous data available for future writes, which is at most `*size`
+  // unless that is 0
   char* PeekWritable(size_t* size);
 
   // Commit reserved data
@@ -104,8 +125,9 @@ class NodeBIO {
     return eof_return_;
   }
 
+  // Sets the length of the first buffer
   inline void set_initial(size_t initial) {
-    initial_ = initial;
+    buffer_length_ = initial;
   }
 
   static NodeBIO* FromBIO(BIO* bio);
@@ -125,6 +147,11 @@ class NodeBIO {
   // Enough to handle the most of the client hellos
   static const size_t kInitialBufferLength = 1024;
   static const size_t kThroughputBufferLength = 16384;
+  // The pool keeps at most this many buffers of each length
+  static const size_t kMaxPooledBuffers = 64;
+
+  static char* AllocateData(size_t len);
+  static void FreeData(char* data, size_t len);
 
   class Buffer {
    public:
@@ -133,13 +160,13 @@ class NodeBIO {
                                            write_pos_(0),
                                            len_(len),
                                            next_(nullptr) {
-      data_ = new char[len];
+      data_ = AllocateData(len);
       if (env_ != nullptr)
         env_->isolate()->AdjustAmountOfExternalAllocatedMemory(len);
     }
 
     ~Buffer() {
-      delete[] data_;
+      FreeData(data_, len_);
       if (env_ != nullptr) {
         const int64_t len = static_cast<int64_t>(len_);
         env_->isolate()->AdjustAmountOfExternalAllocatedMemory(-len);
@@ -154,8 +181,18 @@ class NodeBIO {
     char* data_;
   };
 
+  Buffer* NewBuffer(size_t len);
+  void DeleteBuffer(Buffer* buffer);
+  // Returns all buffers to the pool, once the NodeBIO is drained. With
+  // `resize`, the next buffer is made smaller if they were mostly unused.
+  void ReleaseBuffers(bool resize = true);
+
   Environment* env_;
-  size_t initial_;
+  std::shared_ptr<MemoryStats> memory_stats_;
+  // Length of the next buffer
+  size_t buffer_length_;
+  // Largest length since the buffers were last released
+  size_t peak_length_;
   size_t length_;
   int eof_return_;
   Buffer* read_head_;
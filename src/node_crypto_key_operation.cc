@@ -0,0 +1,236 @@
+#include "node_crypto_key_operation.h"
+#include "node_crypto.h"  // ClearErrorOnReturn
+#include "util-inl.h"
+#include "uv.h"
+
+#include <openssl/async.h>
+#include <openssl/ec.h>
+#include <openssl/rsa.h>
+
+#include <memory>
+#include <string.h>
+
+namespace node {
+namespace crypto {
+
+namespace {
+
+typedef int (*RSAOperation)(int flen,
+                            const unsigned char* from,
+                            unsigned char* to,
+                            RSA* rsa,
+                            int padding);
+typedef int (*ECDSASign)(int type,
+                         const unsigned char* dgst,
+                         int dlen,
+                         unsigned char* sig,
+                         unsigned int* siglen,
+                         const BIGNUM* kinv,
+                         const BIGNUM* r,
+                         EC_KEY* eckey);
+
+uv_once_t init_once = UV_ONCE_INIT;
+uv_key_t current_scope;
+RSA_METHOD* async_rsa_method;
+EC_KEY_METHOD* async_ec_key_method;
+
+// Signing with RSA ends up here, see RSA_sign().
+int AsyncRSAPrivateEncrypt(int flen,
+                           const unsigned char* from,
+                           unsigned char* to,
+                           RSA* rsa,
+                           int padding) {
+  const RSAOperation encrypt = RSA_meth_get_priv_enc(RSA_PKCS1_OpenSSL());
+  const std::vector<unsigned char> input(from, from + flen);
+  CHECK_EQ(RSA_up_ref(rsa), 1);
+  const std::shared_ptr<RSA> key(rsa, RSA_free);
+
+  unsigned int len;
+  bool ok = KeyOperationJob::Run(
+      [=](unsigned char* out, unsigned int* out_len) {
+        int ret = encrypt(input.size(), input.data(), out, key.get(), padding);
+        if (ret < 0)
+          return false;
+        *out_len = ret;
+        return true;
+      }, RSA_size(rsa), to, &len);
+  return ok ? len : -1;
+}
+
+
+int AsyncECDSASign(int type,
+                   const unsigned char* dgst,
+                   int dlen,
+                   unsigned char* sig,
+                   unsigned int* siglen,
+                   const BIGNUM* kinv,
+                   const BIGNUM* r,
+                   EC_KEY* eckey) {
+  ECDSASign sign;
+  EC_KEY_METHOD_get_sign(EC_KEY_OpenSSL(), &sign, nullptr, nullptr);
+  // TLS does not precompute any values.
+  if (kinv != nullptr || r != nullptr)
+    return sign(type, dgst, dlen, sig, siglen, kinv, r, eckey);
+
+  const std::vector<unsigned char> digest(dgst, dgst + dlen);
+  CHECK_EQ(EC_KEY_up_ref(eckey), 1);
+  const std::shared_ptr<EC_KEY> key(eckey, EC_KEY_free);
+
+  bool ok = KeyOperationJob::Run(
+      [=](unsigned char* out, unsigned int* out_len) {
+        return sign(type, digest.data(), digest.size(), out, out_len,
+                    nullptr, nullptr, key.get()) == 1;
+      }, ECDSA_size(eckey), sig, siglen);
+  return ok ? 1 : 0;
+}
+
+
+void Init() {
+  CHECK_EQ(uv_key_create(&current_scope), 0);
+
+  async_rsa_method = RSA_meth_dup(RSA_PKCS1_OpenSSL());
+  CHECK_NOT_NULL(async_rsa_method);
+  RSA_meth_set_priv_enc(async_rsa_method, AsyncRSAPrivateEncrypt);
+
+  int (*sign_setup)(EC_KEY*, BN_CTX*, BIGNUM**, BIGNUM**);
+  ECDSA_SIG* (*sign_sig)(const unsigned char*, int, const BIGNUM*,
+                         const BIGNUM*, EC_KEY*);
+  EC_KEY_METHOD_get_sign(EC_KEY_OpenSSL(), nullptr, &sign_setup, &sign_sig);
+  async_ec_key_method = EC_KEY_METHOD_new(EC_KEY_OpenSSL());
+  CHECK_NOT_NULL(async_ec_key_method);
+  EC_KEY_METHOD_set_sign(async_ec_key_method,
+                         AsyncECDSASign,
+                         sign_setup,
+                         sign_sig);
+}
+
+}  // anonymous namespace
+
+
+bool EnableAsyncKeyOperations(EVP_PKEY* pkey) {
+  uv_once(&init_once, Init);
+  if (!ASYNC_is_capable())
+    return false;
+
+  switch (EVP_PKEY_base_id(pkey)) {
+    case EVP_PKEY_RSA:
+      return RSA_set_method(EVP_PKEY_get0_RSA(pkey), async_rsa_method) == 1;
+    case EVP_PKEY_EC:
+      return EC_KEY_set_method(EVP_PKEY_get0_EC_KEY(pkey),
+                               async_ec_key_method) == 1;
+    default:
+      return false;
+  }
+}
+
+
+bool HasAsyncKeyOperations(EVP_PKEY* pkey) {
+  if (pkey == nullptr)
+    return false;
+
+  uv_once(&init_once, Init);
+  switch (EVP_PKEY_base_id(pkey)) {
+    case EVP_PKEY_RSA:
+      return RSA_get_method(EVP_PKEY_get0_RSA(pkey)) == async_rsa_method;
+    case EVP_PKEY_EC:
+      return EC_KEY_get_method(EVP_PKEY_get0_EC_KEY(pkey)) ==
+          async_ec_key_method;
+    default:
+      return false;
+  }
+}
+
+
+KeyOperationJob::KeyOperationJob(Environment* env,
+                                 Operation operation,
+                                 size_t max_out_len,
+                                 DoneCb cb,
+                                 void* arg)
+    : ThreadPoolWork(env),
+      operation_(std::move(operation)),
+      out_(max_out_len),
+      cb_(cb),
+      arg_(arg) {}
+
+
+bool KeyOperationJob::Run(Operation operation,
+                          size_t max_out_len,
+                          unsigned char* out,
+                          unsigned int* out_len) {
+  KeyOperationScope* scope = KeyOperationScope::Current();
+  if (scope == nullptr || ASYNC_get_current_job() == nullptr)
+    return operation(out, out_len);
+
+  KeyOperationJob* job = new KeyOperationJob(scope->env_,
+                                             std::move(operation),
+                                             max_out_len,
+                                             scope->cb_,
+                                             scope->arg_);
+  scope->job_ = job;
+  job->ScheduleWork();
+
+  // The stack of the async job stays around while it is paused, but `scope`
+  // does not.
+  while (!job->done_ && !job->abandoned_)
+    CHECK_EQ(ASYNC_pause_job(), 1);
+
+  if (!job->done_)
+    return false;
+
+  bool ok = job->ok_;
+  if (ok) {
+    memcpy(out, job->out_.data(), job->out_len_);
+    *out_len = job->out_len_;
+  }
+  delete job;
+  return ok;
+}
+
+
+void KeyOperationJob::Abandon() {
+  CHECK(!done_);
+  abandoned_ = true;
+}
+
+
+void KeyOperationJob::DoThreadPoolWork() {
+  // Errors are reported on the thread of the handshake, if at all.
+  ClearErrorOnReturn clear_error_on_return;
+  ok_ = operation_(out_.data(), &out_len_);
+  CHECK_LE(out_len_, out_.size());
+}
+
+
+void KeyOperationJob::AfterThreadPoolWork(int status) {
+  CHECK(status == 0 || status == UV_ECANCELED);
+  if (abandoned_) {
+    delete this;
+    return;
+  }
+
+  done_ = true;
+  // This may resume the handshake, which deletes the job.
+  cb_(arg_);
+}
+
+
+KeyOperationScope::KeyOperationScope(Environment* env,
+                                     KeyOperationJob::DoneCb cb,
+                                     void* arg)
+    : env_(env), cb_(cb), arg_(arg), previous_(Current()) {
+  uv_key_set(&current_scope, this);
+}
+
+
+KeyOperationScope::~KeyOperationScope() {
+  uv_key_set(&current_scope, previous_);
+}
+
+
+KeyOperationScope* KeyOperationScope::Current() {
+  uv_once(&init_once, Init);
+  return static_cast<KeyOperationScope*>(uv_key_get(&current_scope));
+}
+
+}  // namespace crypto
+}  // namespace node
@@ -0,0 +1,104 @@
+#ifndef SRC_NODE_CRYPTO_KEY_OPERATION_H_
+#define SRC_NODE_CRYPTO_KEY_OPERATION_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include "node_internals.h"  // ThreadPoolWork
+#include "openssl/evp.h"
+
+#include <functional>
+#include <vector>
+
+namespace node {
+namespace crypto {
+
+// The private key operations of a server's handshake can run on the
+// threadpool, so that a burst of new connections does not hold up the ones
+// that are established.
+//
+// This relies on OpenSSL's async jobs (SSL_MODE_ASYNC), which run the handshake
+// on a stack of their own. A key operation pauses the job while a
+// KeyOperationJob does the work, and the handshake returns in the meantime.
+// It continues where it left off when the owner of the SSL calls
+// SSL_do_handshake() again once the job is done.
+
+// Makes the private key operations of `pkey` offloadable. Returns false if
+// this is not supported for the type of the key, or on this platform.
+bool EnableAsyncKeyOperations(EVP_PKEY* pkey);
+bool HasAsyncKeyOperations(EVP_PKEY* pkey);
+
+class KeyOperationJob : public ThreadPoolWork {
+ public:
+  typedef void (*DoneCb)(void* arg);
+  // Writes the output of the operation and its length to `out` and `out_len`.
+  // Returns false if the operation failed.
+  typedef std::function<bool(unsigned char* out, unsigned int* out_len)>
+      Operation;
+
+  // Runs `operation` in a job when called from inside of a KeyOperationScope
+  // and of an async job, and right away otherwise.
+  static bool Run(Operation operation,
+                  size_t max_out_len,
+                  unsigned char* out,
+                  unsigned int* out_len);
+
+  inline bool done() const { return done_; }
+
+  // Must be called when the owner goes away before the job is done. The
+  // owner must then resume the handshake one last time, which makes the
+  // paused operation fail. The job deletes itself once it is done.
+  void Abandon();
+
+  void DoThreadPoolWork() override;
+  void AfterThreadPoolWork(int status) override;
+
+ private:
+  KeyOperationJob(Environment* env,
+                  Operation operation,
+                  size_t max_out_len,
+                  DoneCb cb,
+                  void* arg);
+
+  Operation operation_;
+  std::vector<unsigned char> out_;
+  unsigned int out_len_ = 0;
+  bool ok_ = false;
+  bool done_ = false;
+  bool abandoned_ = false;
+  DoneCb cb_;
+  void* arg_;
+
+  DISALLOW_COPY_AND_ASSIGN(KeyOperationJob);
+};
+
+// Allows the key operations of the handshake that is driven inside of it to
+// be offloaded. `cb` is called with `arg` once a job that was started is done.
+class KeyOperationScope {
+ public:
+  KeyOperationScope(Environment* env, KeyOperationJob::DoneCb cb, void* arg);
+  ~KeyOperationScope();
+
+  // The scope of the current thread, if any.
+  static KeyOperationScope* Current();
+
+  // The job that was started inside of the scope, if any.
+  inline KeyOperationJob* job() const { return job_; }
+
+ private:
+  Environment* const env_;
+  const KeyOperationJob::DoneCb cb_;
+  void* const arg_;
+  KeyOperationJob* job_ = nullptr;
+  KeyOperationScope* const previous_;
+
+  friend class KeyOperationJob;
+
+  DISALLOW_COPY_AND_ASSIGN(KeyOperationScope);
+};
+
+}  // namespace crypto
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_NODE_CRYPTO_KEY_OPERATION_H_
@@ -0,0 +1,164 @@
+#include "node_crypto_session_cache.h"
+#include "util-inl.h"
+#include "uv.h"
+
+#include <functional>
+
+namespace node {
+namespace crypto {
+
+namespace {
+
+Mutex caches_mutex;
+// Caches are destroyed with the last SecureContext that uses them.
+std::unordered_map<std::string, std::weak_ptr<SessionCache>> caches;
+
+inline uint64_t NowInMilliseconds() {
+  return uv_hrtime() / 1000000;
+}
+
+inline std::string SessionId(const unsigned char* id, unsigned int length) {
+  return std::string(reinterpret_cast<const char*>(id), length);
+}
+
+}  // anonymous namespace
+
+
+std::shared_ptr<SessionCache> SessionCache::Get(const std::string& name,
+                                                size_t shard_count,
+                                                size_t capacity,
+                                                uint32_t timeout) {
+  Mutex::ScopedLock lock(caches_mutex);
+  std::shared_ptr<SessionCache> cache = caches[name].lock();
+  if (!cache) {
+    cache = std::make_shared<SessionCache>(shard_count, capacity, timeout);
+    caches[name] = cache;
+  }
+  // Forget about caches that are gone.
+  for (auto it = caches.begin(); it != caches.end();) {
+    if (it->second.expired())
+      it = caches.erase(it);
+    else
+      ++it;
+  }
+  return cache;
+}
+
+
+SessionCache::SessionCache(size_t shard_count,
+                           size_t capacity,
+                           uint32_t timeout)
+    : shard_count_(shard_count),
+      shard_capacity_((capacity + shard_count - 1) / shard_count),
+      timeout_(timeout),
+      shards_(new Shard[shard_count]) {
+  CHECK_GT(shard_count, 0);
+  CHECK_GT(capacity, 0);
+}
+
+
+SessionCache::Shard* SessionCache::ShardFor(const std::string& id) {
+  return &shards_[std::hash<std::string>()(id) % shard_count_];
+}
+
+
+void SessionCache::Erase(Shard* shard,
+                         std::unordered_map<std::string, Entry>::iterator it) {
+  shard->lru.erase(it->second.lru);
+  shard->entries.erase(it);
+}
+
+
+bool SessionCache::Store(SSL_SESSION* session, size_t max_size) {
+  unsigned int id_length;
+  const unsigned char* id = SSL_SESSION_get_id(session, &id_length);
+  if (id_length == 0)
+    return false;
+
+  int size = i2d_SSL_SESSION(session, nullptr);
+  if (size <= 0 || static_cast<size_t>(size) > max_size)
+    return false;
+  std::vector<unsigned char> data(size);
+  unsigned char* serialized = data.data();
+  i2d_SSL_SESSION(session, &serialized);
+
+  const uint64_t timeout =
+      timeout_ != 0 ? timeout_ : SSL_SESSION_get_timeout(session);
+  const std::string key = SessionId(id, id_length);
+  Shard* shard = ShardFor(key);
+  Mutex::ScopedLock lock(shard->mutex);
+
+  auto it = shard->entries.find(key);
+  if (it != shard->entries.end())
+    Erase(shard, it);
+  while (shard->entries.size() >= shard_capacity_) {
+    Erase(shard, shard->entries.find(shard->lru.back()));
+    shard->stats.evictions++;
+  }
+
+  shard->lru.push_front(key);
+  Entry& entry = shard->entries[key];
+  entry.data = std::move(data);
+  entry.expires = NowInMilliseconds() + timeout * 1000;
+  entry.lru = shard->lru.begin();
+  shard->stats.stores++;
+  return true;
+}
+
+
+SSL_SESSION* SessionCache::Lookup(const unsigned char* id,
+                                  unsigned int id_length) {
+  const std::string key = SessionId(id, id_length);
+  Shard* shard = ShardFor(key);
+  std::vector<unsigned char> data;
+  {
+    Mutex::ScopedLock lock(shard->mutex);
+    auto it = shard->entries.find(key);
+    if (it == shard->entries.end()) {
+      shard->stats.misses++;
+      return nullptr;
+    }
+    if (it->second.expires <= NowInMilliseconds()) {
+      Erase(shard, it);
+      shard->stats.misses++;
+      return nullptr;
+    }
+    shard->lru.splice(shard->lru.begin(), shard->lru, it->second.lru);
+    data = it->second.data;
+    shard->stats.hits++;
+  }
+
+  // Deserialize outside of the lock, it is the expensive part.
+  const unsigned char* serialized = data.data();
+  return d2i_SSL_SESSION(nullptr, &serialized, data.size());
+}
+
+
+void SessionCache::Remove(SSL_SESSION* session) {
+  unsigned int id_length;
+  const unsigned char* id = SSL_SESSION_get_id(session, &id_length);
+  const std::string key = SessionId(id, id_length);
+  Shard* shard = ShardFor(key);
+  Mutex::ScopedLock lock(shard->mutex);
+  auto it = shard->entries.find(key);
+  if (it != shard->entries.end())
+    Erase(shard, it);
+}
+
+
+SessionCache::Stats SessionCache::GetStats() const {
+  Stats stats;
+  for (size_t i = 0; i < shard_count_; i++) {
+    Shard* shard = &shards_[i];
+    Mutex::ScopedLock lock(shard->mutex);
+    stats.hits += shard->stats.hits;
+    stats.misses += shard->stats.misses;
+    stats.stores += shard->stats.stores;
+    stats.evictions += shard->stats.evictions;
+    stats.size += shard->entries.size();
+  }
+  return stats;
+}
+
+}  // namespace crypto
+}  // namespace node
@@ -0,0 +1,89 @@
+#ifndef SRC_NODE_CRYPTO_SESSION_CACHE_H_
+#define SRC_NODE_CRYPTO_SESSION_CACHE_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include "node_mutex.h"
+#include "openssl/ssl.h"
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace node {
+namespace crypto {
+
+// A server-side cache of TLS sessions, keyed by session ID. Caches are
+// identified by name and live in the memory of the process, so that all
+// SecureContexts that use the same name share their sessions, including ones
+// that belong to different Worker threads. This avoids a full handshake when a
+// client that was served by one of them connects to another.
+//
+// The cache is split into shards, each with its own lock, so that threads that
+// handshake at the same time rarely wait for each other. Each shard evicts its
+// least recently used sessions when it is full, and sessions expire after a
+// fixed time.
+class SessionCache {
+ public:
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t stores = 0;
+    uint64_t evictions = 0;
+    size_t size = 0;
+  };
+
+  // Returns the cache with the given name, and creates it if there is none.
+  // An existing cache keeps the parameters that it was created with.
+  // `timeout` is in seconds; 0 means that each session expires after its own
+  // timeout, i.e. the one of the SecureContext that created it.
+  static std::shared_ptr<SessionCache> Get(const std::string& name,
+                                           size_t shard_count,
+                                           size_t capacity,
+                                           uint32_t timeout);
+
+  SessionCache(size_t shard_count, size_t capacity, uint32_t timeout);
+
+  // Returns false if the session could not be stored, e.g. because it is too
+  // large.
+  bool Store(SSL_SESSION* session, size_t max_size);
+  // Returns a new session that the caller owns, or nullptr.
+  SSL_SESSION* Lookup(const unsigned char* id, unsigned int id_length);
+  void Remove(SSL_SESSION* session);
+
+  Stats GetStats() const;
+
+ private:
+  struct Entry {
+    std::vector<unsigned char> data;
+    uint64_t expires;  // In milliseconds, see uv_hrtime().
+    std::list<std::string>::iterator lru;
+  };
+
+  struct Shard {
+    Mutex mutex;
+    std::unordered_map<std::string, Entry> entries;
+    std::list<std::string> lru;  // Most recently used first.
+    Stats stats;
+  };
+
+  Shard* ShardFor(const std::string& id);
+  static void Erase(Shard* shard,
+                    std::unordered_map<std::string, Entry>::iterator it);
+
+  const size_t shard_count_;
+  const size_t shard_capacity_;
+  const uint32_t timeout_;
+  std::unique_ptr<Shard[]> shards_;
+
+  DISALLOW_COPY_AND_ASSIGN(SessionCache);
+};
+
+}  // namespace crypto
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_NODE_CRYPTO_SESSION_CACHE_H_
@@ -189,6 +189,14 @@ Http2Options::Http2Options(Environment* env) {
   if (flags & (1 << IDX_OPTIONS_MAX_SESSION_MEMORY)) {
     SetMaxSessionMemory(buffer[IDX_OPTIONS_MAX_SESSION_MEMORY] * 1e6);
   }
+
+  // By default, everything nghttp2 has to send goes out in a single write.
+  // Sessions with many busy streams can limit how much is gathered at once
+  // so that a write does not pin an unbounded number of DATA chunks. Whatever
+  // did not fit is sent once that write has completed.
+  if (flags & (1 << IDX_OPTIONS_MAX_WRITE_BATCH_SIZE)) {
+    SetMaxWriteBatchSize(buffer[IDX_OPTIONS_MAX_WRITE_BATCH_SIZE]);
+  }
 }
 
 void Http2Session::Http2Settings::Init() {
@@ -353,11 +361,153 @@ const char* Http2Session::TypeName() const {
   }
 }
 
+// The HPACK static table (RFC 7541, Appendix A). Names and values that
+// appear in it are referenced from here rather than copied by nghttp2.
+struct StaticHeader {
+  const char* name;
+  size_t namelen;
+  const char* value;
+  size_t valuelen;
+};
+
+#define HPACK_STATIC_TABLE(V)                                                 \
+  V(":authority", "")                                                         \
+  V(":method", "GET")                                                         \
+  V(":method", "POST")                                                        \
+  V(":path", "/")                                                             \
+  V(":path", "/index.html")                                                   \
+  V(":scheme", "http")                                                        \
+  V(":scheme", "https")                                                       \
+  V(":status", "200")                                                         \
+  V(":status", "204")                                                         \
+  V(":status", "206")                                                         \
+  V(":status", "304")                                                         \
+  V(":status", "400")                                                         \
+  V(":status", "404")                                                         \
+  V(":status", "500")                                                         \
+  V("accept-charset", "")                                                     \
+  V("accept-encoding", "gzip, deflate")                                       \
+  V("accept-language", "")                                                    \
+  V("accept-ranges", "")                                                      \
+  V("accept", "")                                                             \
+  V("access-control-allow-origin", "")                                        \
+  V("age", "")                                                                \
+  V("allow", "")                                                              \
+  V("authorization", "")                                                      \
+  V("cache-control", "")                                                      \
+  V("content-disposition", "")                                                \
+  V("content-encoding", "")                                                   \
+  V("content-language", "")                                                   \
+  V("content-length", "")                                                     \
+  V("content-location", "")                                                   \
+  V("content-range", "")                                                      \
+  V("content-type", "")                                                       \
+  V("cookie", "")                                                             \
+  V("date", "")                                                               \
+  V("etag", "")                                                               \
+  V("expect", "")                                                             \
+  V("expires", "")                                                            \
+  V("from", "")                                                               \
+  V("host", "")                                                               \
+  V("if-match", "")                                                           \
+  V("if-modified-since", "")                                                  \
+  V("if-none-match", "")                                                      \
+  V("if-range", "")                                                           \
+  V("if-unmodified-since", "")                                                \
+  V("last-modified", "")                                                      \
+  V("link", "")                                                               \
+  V("location", "")                                                           \
+  V("max-forwards", "")                                                       \
+  V("proxy-authenticate", "")                                                 \
+  V("proxy-authorization", "")                                                \
+  V("range", "")                                                              \
+  V("referer", "")                                                            \
+  V("refresh", "")                                                            \
+  V("retry-after", "")                                                        \
+  V("server", "")                                                             \
+  V("set-cookie", "")                                                         \
+  V("strict-transport-security", "")                                          \
+  V("transfer-encoding", "")                                                  \
+  V("user-agent", "")                                                         \
+  V("vary", "")                                                               \
+  V("via", "")                                                                \
+  V("www-authenticate", "")
+
+const StaticHeader kStaticHeaders[] = {
+#define V(name, value) { name, sizeof(name) - 1, value, sizeof(value) - 1 },
+  HPACK_STATIC_TABLE(V)
+#undef V
+};
+
+// Points `nv` at the static table where possible. Returns true if both the
+// name and the value were found there.
+static bool UseStaticHeader(nghttp2_nv* nv) {
+  bool found_name = false;
+  for (const StaticHeader& entry : kStaticHeaders) {
+    if (entry.namelen != nv->namelen ||
+        memcmp(entry.name, nv->name, nv->namelen) != 0) {
+      // Entries with the same name are adjacent.
+      if (found_name)
+        break;
+      continue;
+    }
+    if (!found_name) {
+      nv->name = reinterpret_cast<uint8_t*>(const_cast<char*>(entry.name));
+      nv->flags |= NGHTTP2_NV_FLAG_NO_COPY_NAME;
+      found_name = true;
+    }
+    if (entry.valuelen == nv->valuelen &&
+        memcmp(entry.value, nv->value, nv->valuelen) == 0) {
+      nv->value = reinterpret_cast<uint8_t*>(const_cast<char*>(entry.value));
+      nv->flags |= NGHTTP2_NV_FLAG_NO_COPY_VALUE;
+      return true;
+    }
+  }
+  return false;
+}
+
+const char* Http2HeaderCache::Lookup(const char* pair, size_t length) {
+  if (length > kMaxPairLength)
+    return nullptr;
+
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++)
+    hash = (hash ^ static_cast<uint8_t>(pair[i])) * 16777619u;
+
+  auto range = entries_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    const std::string& entry = it->second;
+    if (entry.size() == length && memcmp(entry.data(), pair, length) == 0)
+      return entry.data();
+  }
+
+  if (entries_.size() >= kMaxEntries)
+    return nullptr;
+
+  if (candidates_.erase(hash) == 0) {
+    if (candidates_.size() >= kMaxCandidates)
+      candidates_.clear();
+    candidates_.emplace(hash, true);
+    return nullptr;
+  }
+
+  // Seen before, so this is likely to be sent again. The string's storage
+  // does not move when the map is rehashed.
+  return entries_.emplace(hash, std::string(pair, length))->second.data();
+}
+
+static Http2HeaderCache* HeaderCacheFor(Http2Stream* stream) {
+  Http2Session* session = stream->session();
+  return session != nullptr ? session->header_cache() : nullptr;
+}
+
 // The Headers class initializes a proper array of nghttp2_nv structs
 // containing the header name value pairs.
 Headers::Headers(Isolate* isolate,
                  Local<Context> context,
-                 Local<Array> headers) {
+                 Local<Array> headers,
+                 Http2HeaderCache* cache) {
   Local<Value> header_string = headers->Get(context, 0).ToLocalChecked();
   Local<Value> header_count = headers->Get(context, 1).ToLocalChecked();
   count_ = header_count.As<Uint32>()->Value();
@@ -400,6 +550,7 @@ Headers::Headers(Isolate* isolate,
       return;
     }
 
+    char* pair = p;
     nva[n].flags = NGHTTP2_NV_FLAG_NONE;
     nva[n].name = reinterpret_cast<uint8_t*>(p);
     nva[n].namelen = strlen(p);
@@ -407,6 +558,16 @@ Headers::Headers(Isolate* isolate,
     nva[n].value = reinterpret_cast<uint8_t*>(p);
     nva[n].valuelen = strlen(p);
     p += nva[n].valuelen + 1;
+
+    if (UseStaticHeader(&nva[n]) || cache == nullptr)
+      continue;
+    const char* cached = cache->Lookup(pair, p - pair - 1);
+    if (cached != nullptr) {
+      nva[n].name = reinterpret_cast<uint8_t*>(const_cast<char*>(cached));
+      nva[n].value = nva[n].name + nva[n].namelen + 1;
+      nva[n].flags =
+          NGHTTP2_NV_FLAG_NO_COPY_NAME | NGHTTP2_NV_FLAG_NO_COPY_VALUE;
+    }
   }
 }
 
@@ -548,6 +709,7 @@ Http2Session::Http2Session(Environment* env,
   Http2Options opts(env);
 
   max_session_memory_ = opts.GetMaxSessionMemory();
+  max_write_batch_size_ = opts.GetMaxWriteBatchSize();
 
   uint32_t maxHeaderPairs = opts.GetMaxHeaderPairs();
   max_header_pairs_ =
@@ -1470,6 +1632,7 @@ void Http2Session::ClearOutgoing(int status) {
 
   if (outgoing_buffers_.size() > 0) {
     outgoing_storage_.clear();
+    outgoing_length_ = 0;
 
     std::vector<nghttp2_stream_write> current_outgoing_buffers_;
     current_outgoing_buffers_.swap(outgoing_buffers_);
@@ -1508,11 +1671,17 @@ void Http2Session::CopyDataIntoOutgoing(const uint8_t* src, size_t src_length) {
   // of the outgoing_buffers_ vector may invalidate the pointer.
   // The correct base pointers will be set later, before writing to the
   // underlying socket.
-  outgoing_buffers_.emplace_back(nghttp2_stream_write {
+  PushOutgoingBuffer(nghttp2_stream_write {
     uv_buf_init(nullptr, src_length)
   });
 }
 
+// Queue a given block of data for sending without copying it.
+void Http2Session::PushOutgoingBuffer(nghttp2_stream_write&& write) {
+  outgoing_length_ += write.buf.len;
+  outgoing_buffers_.emplace_back(std::move(write));
+}
+
 // Prompts nghttp2 to begin serializing it's pending data and pushes each
 // chunk out to the i/o socket to be sent. This is a particularly hot method
 // that will generally be called at least twice be event loop iteration.
@@ -1544,6 +1713,8 @@ uint8_t Http2Session::SendPendingData() {
   while ((src_length = nghttp2_session_mem_send(session_, &src)) > 0) {
     Debug(this, "nghttp2 has %d bytes to send", src_length);
     CopyDataIntoOutgoing(src, src_length);
+    if (IsWriteBatchFull())
+      break;
   }
 
   CHECK_NE(src_length, NGHTTP2_ERR_NOMEM);
@@ -1568,26 +1739,40 @@ uint8_t Http2Session::SendPendingData() {
 
   // Set the buffer base pointers for copied data that ended up in the
   // sessions's own storage since it might have shifted around during gathering.
-  // (Those are marked by having .base == nullptr.)
+  // (Those are marked by having .base == nullptr.) Runs of copied data are
+  // contiguous in that storage, so each run becomes a single buffer, e.g. a
+  // DATA frame header together with the frames nghttp2 serialized before it.
+  // Everything else refers to memory owned by JS and is passed on as-is.
   size_t offset = 0;
   size_t i = 0;
+  bool last_was_copied = false;
   for (const nghttp2_stream_write& write : outgoing_buffers_) {
     statistics_.data_sent += write.buf.len;
     if (write.buf.base == nullptr) {
-      bufs[i++] = uv_buf_init(
-          reinterpret_cast<char*>(outgoing_storage_.data() + offset),
-          write.buf.len);
+      if (last_was_copied) {
+        bufs[i - 1].len += write.buf.len;
+      } else {
+        bufs[i++] = uv_buf_init(
+            reinterpret_cast<char*>(outgoing_storage_.data() + offset),
+            write.buf.len);
+      }
       offset += write.buf.len;
+      last_was_copied = true;
     } else {
       bufs[i++] = write.buf;
+      last_was_copied = false;
     }
   }
 
   chunks_sent_since_last_write_++;
 
-  StreamWriteResult res = underlying_stream()->Write(*bufs, count);
+  const bool batch_full = IsWriteBatchFull();
+  StreamWriteResult res = underlying_stream()->Write(*bufs, i);
   if (!res.async) {
     ClearOutgoing(res.err);
+    // Asynchronous writes schedule the rest in OnStreamAfterWrite().
+    if (batch_full && !(flags_ & SESSION_STATE_WRITE_SCHEDULED))
+      MaybeScheduleWrite();
   }
 
   MaybeStopReading();
@@ -1610,6 +1795,11 @@ int Http2Session::OnSendData(
   Http2Session* session = static_cast<Http2Session*>(user_data);
   Http2Stream* stream = GetStream(session, frame->hd.stream_id, source);
 
+  // nghttp2 keeps the frame and offers it again on the next call to
+  // nghttp2_session_mem_send().
+  if (session->IsWriteBatchFull())
+    return NGHTTP2_ERR_WOULDBLOCK;
+
   // Send the frame header + a byte that indicates padding length.
   session->CopyDataIntoOutgoing(framehd, 9);
   if (frame->data.padlen > 0) {
@@ -1628,13 +1818,13 @@ int Http2Session::OnSendData(
     if (write.buf.len <= length) {
       // This write does not suffice by itself, so we can consume it completely.
       length -= write.buf.len;
-      session->outgoing_buffers_.emplace_back(std::move(write));
+      session->PushOutgoingBuffer(std::move(write));
       stream->queue_.pop();
       continue;
     }
 
     // Slice off `length` bytes of the first write in the queue.
-    session->outgoing_buffers_.emplace_back(nghttp2_stream_write {
+    session->PushOutgoingBuffer(nghttp2_stream_write {
       uv_buf_init(write.buf.base, length)
     });
     write.buf.base += length;
@@ -1644,7 +1834,7 @@ int Http2Session::OnSendData(
 
   if (frame->data.padlen > 0) {
     // Send padding if that was requested.
-    session->outgoing_buffers_.emplace_back(nghttp2_stream_write {
+    session->PushOutgoingBuffer(nghttp2_stream_write {
       uv_buf_init(const_cast<char*>(zero_bytes_256), frame->data.padlen - 1)
     });
   }
@@ -2353,7 +2543,7 @@ void Http2Session::Request(const FunctionCallbackInfo<Value>& args) {
   int options = args[1]->IntegerValue(context).ToChecked();
   Http2Priority priority(env, args[2], args[3], args[4]);
 
-  Headers list(isolate, context, headers);
+  Headers list(isolate, context, headers, session->header_cache());
 
   Debug(session, "request submitted");
 
@@ -2456,7 +2646,7 @@ void Http2Stream::Respond(const FunctionCallbackInfo<Value>& args) {
   Local<Array> headers = args[0].As<Array>();
   int options = args[1]->IntegerValue(context).ToChecked();
 
-  Headers list(isolate, context, headers);
+  Headers list(isolate, context, headers, HeaderCacheFor(stream));
 
   args.GetReturnValue().Set(
       stream->SubmitResponse(*list, list.length(), options));
@@ -2474,7 +2664,7 @@ void Http2Stream::Info(const FunctionCallbackInfo<Value>& args) {
 
   Local<Array> headers = args[0].As<Array>();
 
-  Headers list(isolate, context, headers);
+  Headers list(isolate, context, headers, HeaderCacheFor(stream));
   args.GetReturnValue().Set(stream->SubmitInfo(*list, list.length()));
   Debug(stream, "%d informational headers sent", list.length());
 }
@@ -2489,7 +2679,7 @@ void Http2Stream::Trailers(const FunctionCallbackInfo<Value>& args) {
 
   Local<Array> headers = args[0].As<Array>();
 
-  Headers list(isolate, context, headers);
+  Headers list(isolate, context, headers, HeaderCacheFor(stream));
   args.GetReturnValue().Set(stream->SubmitTrailers(*list, list.length()));
   Debug(stream, "%d trailing headers sent", list.length());
 }
@@ -2528,7 +2718,7 @@ void Http2Stream::PushPromise(const FunctionCallbackInfo<Value>& args) {
   Local<Array> headers = args[0].As<Array>();
   int options = args[1]->IntegerValue(context).ToChecked();
 
-  Headers list(isolate, context, headers);
+  Headers list(isolate, context, headers, HeaderCacheFor(parent));
 
   Debug(parent, "creating push promise");
 
@@ -11,6 +11,8 @@
 
 #include <algorithm>
 #include <queue>
+#include <string>
+#include <unordered_map>
 
 namespace node {
 namespace http2 {
@@ -462,9 +464,18 @@ class Http2Options {
     return max_session_memory_;
   }
 
+  void SetMaxWriteBatchSize(size_t max) {
+    max_write_batch_size_ = max;
+  }
+
+  size_t GetMaxWriteBatchSize() {
+    return max_write_batch_size_;
+  }
+
  private:
   nghttp2_option* options_;
   uint64_t max_session_memory_ = DEFAULT_MAX_SESSION_MEMORY;
+  size_t max_write_batch_size_ = 0;
   uint32_t max_header_pairs_ = DEFAULT_MAX_HEADER_LIST_PAIRS;
   padding_strategy_type padding_strategy_ = PADDING_STRATEGY_NONE;
   size_t max_outstanding_pings_ = DEFAULT_MAX_PINGS;
@@ -712,6 +723,32 @@ class Http2Stream::Provider::Stream : public Http2Stream::Provider {
 };
 
 
+// Keeps copies of header name/value pairs that a session sends repeatedly,
+// e.g. the same content-type or cache-control on every response. Headers
+// points nghttp2 at these copies using NGHTTP2_NV_FLAG_NO_COPY_NAME and
+// NGHTTP2_NV_FLAG_NO_COPY_VALUE, instead of having nghttp2 duplicate the
+// strings for every frame it queues. Frames that are still queued may refer
+// to an entry, so entries are never evicted; the cache stops growing once
+// it is full instead.
+class Http2HeaderCache {
+ public:
+  // `pair` is a header name and value separated by a NUL byte. Returns the
+  // cached copy of it, or nullptr if the pair is not cached (yet). Pairs are
+  // cached the second time they are seen.
+  const char* Lookup(const char* pair, size_t length);
+
+  size_t size() const { return entries_.size(); }
+
+ private:
+  static const size_t kMaxEntries = 128;
+  static const size_t kMaxPairLength = 256;
+  static const size_t kMaxCandidates = 1024;
+
+  std::unordered_multimap<uint32_t, std::string> entries_;
+  // Pairs seen once, by hash.
+  std::unordered_map<uint32_t, bool> candidates_;
+};
+
 class Http2Session : public AsyncWrap, public StreamListener {
  public:
   Http2Session(Environment* env,
@@ -779,6 +816,8 @@ class Http2Session : public AsyncWrap, public StreamListener {
   // Returns pointer to the stream, or nullptr if stream does not exist
   inline Http2Stream* FindStream(int32_t id);
 
+  Http2HeaderCache* header_cache() { return &header_cache_; }
+
   inline bool CanAddStream();
 
   // Adds a stream instance to this session
@@ -1004,6 +1043,14 @@ class Http2Session : public AsyncWrap, public StreamListener {
   // use this to allow timeout tracking during long-lasting writes
   uint32_t chunks_sent_since_last_write_ = 0;
 
+  // Header pairs that are referenced instead of copied. This must outlive
+  // session_, which is ensured by it being a member.
+  Http2HeaderCache header_cache_;
+
+  // The number of bytes SendPendingData() gathers from nghttp2 before it
+  // writes them to the socket. 0 means no limit.
+  size_t max_write_batch_size_ = 0;
+
   uv_buf_t stream_buf_ = uv_buf_init(nullptr, 0);
   v8::Local<v8::ArrayBuffer> stream_buf_ab_;
 
@@ -1015,9 +1062,16 @@ class Http2Session : public AsyncWrap, public StreamListener {
 
   std::vector<nghttp2_stream_write> outgoing_buffers_;
   std::vector<uint8_t> outgoing_storage_;
+  // Total length of everything in outgoing_buffers_.
+  size_t outgoing_length_ = 0;
   std::vector<int32_t> pending_rst_streams_;
 
   void CopyDataIntoOutgoing(const uint8_t* src, size_t src_length);
+  void PushOutgoingBuffer(nghttp2_stream_write&& write);
+  bool IsWriteBatchFull() const {
+    return max_write_batch_size_ > 0 &&
+           outgoing_length_ >= max_write_batch_size_;
+  }
   void ClearOutgoing(int status);
 
   friend class Http2Scope;
@@ -1227,7 +1281,13 @@ class ExternalHeader :
 
 class Headers {
  public:
-  Headers(Isolate* isolate, Local<Context> context, Local<Array> headers);
+  // If `cache` is given, frequently used header pairs are referenced from it
+  // instead of being copied by nghttp2. In that case the nghttp2_nv structs
+  // must only be passed to nghttp2 for the session that owns the cache.
+  Headers(Isolate* isolate,
+          Local<Context> context,
+          Local<Array> headers,
+          Http2HeaderCache* cache = nullptr);
   ~Headers() {}
 
   nghttp2_nv* operator*() {
@@ -49,6 +49,7 @@ namespace node {
 namespace {
 
 using v8::Array;
+using v8::ArrayBuffer;
 using v8::Boolean;
 using v8::Context;
 using v8::EscapableHandleScope;
@@ -58,11 +59,13 @@ using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
 using v8::HandleScope;
 using v8::Integer;
+using v8::Isolate;
 using v8::Local;
 using v8::MaybeLocal;
 using v8::Object;
 using v8::String;
 using v8::Uint32;
+using v8::Uint32Array;
 using v8::Undefined;
 using v8::Value;
 
@@ -72,17 +75,110 @@ const uint32_t kOnBody = 2;
 const uint32_t kOnMessageComplete = 3;
 const uint32_t kOnExecute = 4;
 
+// Header names that are common enough to be worth keeping around as
+// internalized strings, so that parsing them does not allocate.  Names are
+// only recognized when spelled exactly as below or in all lowercase, because
+// the original spelling is visible through `rawHeaders`.
+#define HTTP_KNOWN_HEADER_NAMES(V)                                            \
+  V("Accept")                                                                 \
+  V("Accept-Charset")                                                         \
+  V("Accept-Encoding")                                                        \
+  V("Accept-Language")                                                        \
+  V("Accept-Ranges")                                                          \
+  V("Access-Control-Allow-Origin")                                            \
+  V("Age")                                                                    \
+  V("Authorization")                                                          \
+  V("Cache-Control")                                                          \
+  V("Connection")                                                             \
+  V("Content-Disposition")                                                    \
+  V("Content-Encoding")                                                       \
+  V("Content-Language")                                                       \
+  V("Content-Length")                                                         \
+  V("Content-Type")                                                           \
+  V("Cookie")                                                                 \
+  V("Date")                                                                   \
+  V("DNT")                                                                    \
+  V("ETag")                                                                   \
+  V("Expect")                                                                 \
+  V("Expires")                                                                \
+  V("Forwarded")                                                              \
+  V("From")                                                                   \
+  V("Host")                                                                   \
+  V("If-Match")                                                               \
+  V("If-Modified-Since")                                                      \
+  V("If-None-Match")                                                          \
+  V("If-Range")                                                               \
+  V("If-Unmodified-Since")                                                    \
+  V("Keep-Alive")                                                             \
+  V("Last-Modified")                                                          \
+  V("Location")                                                               \
+  V("Origin")                                                                 \
+  V("Pragma")                                                                 \
+  V("Proxy-Authorization")                                                    \
+  V("Range")                                                                  \
+  V("Referer")                                                                \
+  V("Server")                                                                 \
+  V("Set-Cookie")                                                             \
+  V("Transfer-Encoding")                                                      \
+  V("Upgrade")                                                                \
+  V("Upgrade-Insecure-Requests")                                              \
+  V("User-Agent")                                                             \
+  V("Vary")                                                                   \
+  V("Via")                                                                    \
+  V("X-Forwarded-For")                                                        \
+  V("X-Forwarded-Host")                                                       \
+  V("X-Forwarded-Proto")                                                      \
+  V("X-Requested-With")
+
+struct KnownHeaderName {
+  const char* name;
+  size_t length;
+};
+
+const KnownHeaderName kKnownHeaderNames[] = {
+#define V(name) { name, sizeof(name) - 1 },
+  HTTP_KNOWN_HEADER_NAMES(V)
+#undef V
+};
+
+// Returns the slot of `str` in IsolateData::http_parser_static_strs, or -1
+// if it is not a known header name.  Every entry of kKnownHeaderNames has two
+// slots, one for the spelling from the table and one for the lowercase form.
+int FindKnownHeaderName(const char* str, size_t length) {
+  for (size_t i = 0; i < arraysize(kKnownHeaderNames); i++) {
+    const KnownHeaderName& known = kKnownHeaderNames[i];
+    if (known.length != length || ToLower(known.name[0]) != ToLower(str[0]))
+      continue;
+    if (memcmp(known.name, str, length) == 0)
+      return i * 2;
+    size_t j = 0;
+    while (j < length && ToLower(known.name[j]) == str[j])
+      j++;
+    if (j == length)
+      return i * 2 + 1;
+  }
+  return -1;
+}
+
 
 // helper class for the Parser
 struct StringPtr {
+  // Heap buffers up to this size are kept across Reset() calls, so that a
+  // parser that is reused for many requests on a keep-alive connection does
+  // not allocate again for every fragmented header. Release() drops them once
+  // the parser goes back into the free list in lib/_http_common.js.
+  static const size_t kMaxRetainedSize = 4096;
+
   StringPtr() {
     on_heap_ = false;
+    heap_ = nullptr;
+    capacity_ = 0;
     Reset();
   }
 
 
   ~StringPtr() {
-    Reset();
+    delete[] heap_;
   }
 
 
@@ -91,46 +187,77 @@ struct StringPtr {
   // to leak references. See issue #2438 and test-http-parser-bad-ref.js.
   void Save() {
     if (!on_heap_ && size_ > 0) {
-      char* s = new char[size_];
-      memcpy(s, str_, size_);
-      str_ = s;
+      Reserve(size_);
+      memcpy(heap_, str_, size_);
+      str_ = heap_;
       on_heap_ = true;
     }
   }
 
 
   void Reset() {
-    if (on_heap_) {
-      delete[] str_;
-      on_heap_ = false;
+    if (capacity_ > kMaxRetainedSize) {
+      delete[] heap_;
+      heap_ = nullptr;
+      capacity_ = 0;
     }
 
+    on_heap_ = false;
     str_ = nullptr;
     size_ = 0;
   }
 
 
+  void Release() {
+    delete[] heap_;
+    heap_ = nullptr;
+    capacity_ = 0;
+    Reset();
+  }
+
+
   void Update(const char* str, size_t size) {
     if (str_ == nullptr) {
       str_ = str;
     } else if (on_heap_ || str_ + size_ != str) {
       // Non-consecutive input, make a copy on the heap.
-      // TODO(bnoordhuis) Use slab allocation, O(n) allocs is bad.
-      char* s = new char[size_ + size];
-      memcpy(s, str_, size_);
-      memcpy(s + size_, str, size);
-
-      if (on_heap_)
-        delete[] str_;
-      else
+      if (!on_heap_) {
+        Reserve(size_ + size);
+        memcpy(heap_, str_, size_);
+        str_ = heap_;
         on_heap_ = true;
-
-      str_ = s;
+      } else {
+        Grow(size_ + size);
+      }
+      memcpy(heap_ + size_, str, size);
     }
     size_ += size;
   }
 
 
+  // Makes sure heap_ can hold `size` bytes, discarding its contents.
+  void Reserve(size_t size) {
+    if (heap_ != nullptr && size <= capacity_)
+      return;
+    delete[] heap_;
+    capacity_ = size < 64 ? 64 : size;
+    heap_ = new char[capacity_];
+  }
+
+
+  // Makes sure heap_ can hold `size` bytes, keeping its first size_ bytes.
+  void Grow(size_t size) {
+    if (size <= capacity_)
+      return;
+    capacity_ = size > capacity_ * 2 ? size : capacity_ * 2;
+    char* heap = new char[capacity_];
+    memcpy(heap, heap_, size_);
+    delete[] heap_;
+    heap_ = heap;
+    str_ = heap_;
+  }
+
+
   Local<String> ToString(Environment* env) const {
     if (str_)
       return OneByteString(env->isolate(), str_, size_);
@@ -139,9 +266,34 @@ struct StringPtr {
   }
 
 
+  // Like ToString(), but returns a cached string for well-known header names.
+  Local<String> ToHeaderName(Environment* env) const {
+    const int slot = str_ != nullptr ? FindKnownHeaderName(str_, size_) : -1;
+    if (slot < 0)
+      return ToString(env);
+
+    auto& static_strs = env->isolate_data()->http_parser_static_strs;
+    if (static_strs.empty())
+      static_strs.resize(arraysize(kKnownHeaderNames) * 2);
+    v8::Eternal<String>& eternal = static_strs[slot];
+    if (eternal.IsEmpty()) {
+      Local<String> str =
+          String::NewFromOneByte(env->isolate(),
+                                 reinterpret_cast<const uint8_t*>(str_),
+                                 v8::NewStringType::kInternalized,
+                                 size_).ToLocalChecked();
+      eternal.Set(env->isolate(), str);
+      return str;
+    }
+    return eternal.Get(env->isolate());
+  }
+
+
   const char* str_;
   bool on_heap_;
   size_t size_;
+  char* heap_;
+  size_t capacity_;
 };
 
 
@@ -232,6 +384,7 @@ class Parser : public AsyncWrap, public StreamListener {
       A_STATUS_MESSAGE,
       A_UPGRADE,
       A_SHOULD_KEEP_ALIVE,
+      A_HEADER_OFFSETS,  // Only used with flat headers, see SetFlatHeaders().
       A_MAX
     };
 
@@ -251,7 +404,10 @@ class Parser : public AsyncWrap, public StreamListener {
       Flush();
     } else {
       // Fast case, pass headers and URL to JS land.
-      argv[A_HEADERS] = CreateHeaders();
+      if (flat_headers_)
+        argv[A_HEADERS] = CreateFlatHeaders(&argv[A_HEADER_OFFSETS]);
+      else
+        argv[A_HEADERS] = CreateHeaders();
       if (parser_.type == HTTP_REQUEST)
         argv[A_URL] = url_.ToString(env());
     }
@@ -377,14 +533,15 @@ class Parser : public AsyncWrap, public StreamListener {
 
 
   static void Free(const FunctionCallbackInfo<Value>& args) {
-    Environment* env = Environment::GetCurrent(args);
     Parser* parser;
     ASSIGN_OR_RETURN_UNWRAP(&parser, args.Holder());
 
     // Since the Parser destructor isn't going to run the destroy() callbacks
     // it needs to be triggered manually.
-    parser->EmitTraceEventDestroy();
-    parser->EmitDestroy(env, parser->get_async_id());
+    parser->EmitDestroy();
+    // Parsers can sit in the free list for a long time, don't let them hold
+    // on to the header buffers meanwhile.
+    parser->ReleaseBuffers();
   }
 
 
@@ -472,6 +629,18 @@ class Parser : public AsyncWrap, public StreamListener {
   }
 
 
+  // When enabled, header names and values are no longer delivered as an
+  // array of strings.  Instead, the callbacks receive a single Buffer that
+  // holds all of them back to back, and a Uint32Array with the end offset
+  // of each name and value within that buffer.  This is reset by
+  // reinitialize().
+  static void SetFlatHeaders(const FunctionCallbackInfo<Value>& args) {
+    Parser* parser;
+    ASSIGN_OR_RETURN_UNWRAP(&parser, args.Holder());
+    parser->flat_headers_ = args[0]->IsTrue();
+  }
+
+
   template <bool should_pause>
   static void Pause(const FunctionCallbackInfo<Value>& args) {
     Environment* env = Environment::GetCurrent(args);
@@ -629,7 +798,7 @@ class Parser : public AsyncWrap, public StreamListener {
     do {
       size_t j = 0;
       while (i < num_values_ && j < arraysize(argv) / 2) {
-        argv[j * 2] = fields_[i].ToString(env());
+        argv[j * 2] = fields_[i].ToHeaderName(env());
         argv[j * 2 + 1] = values_[i].ToString(env());
         i++;
         j++;
@@ -643,6 +812,33 @@ class Parser : public AsyncWrap, public StreamListener {
   }
 
 
+  Local<Object> CreateFlatHeaders(Local<Value>* offsets) {
+    size_t length = 0;
+    for (size_t i = 0; i < num_values_; i++)
+      length += fields_[i].size_ + values_[i].size_;
+
+    Local<Object> headers = Buffer::New(env(), length).ToLocalChecked();
+    char* data = Buffer::Data(headers);
+    Local<ArrayBuffer> ab =
+        ArrayBuffer::New(env()->isolate(), num_values_ * 2 * sizeof(uint32_t));
+    uint32_t* ends = static_cast<uint32_t*>(ab->GetContents().Data());
+
+    size_t offset = 0;
+    for (size_t i = 0; i < num_values_; i++) {
+      const StringPtr* strs[] = { &fields_[i], &values_[i] };
+      for (size_t j = 0; j < arraysize(strs); j++) {
+        if (strs[j]->size_ > 0)
+          memcpy(data + offset, strs[j]->str_, strs[j]->size_);
+        offset += strs[j]->size_;
+        ends[i * 2 + j] = offset;
+      }
+    }
+
+    *offsets = Uint32Array::New(ab, 0, num_values_ * 2);
+    return headers;
+  }
+
+
   // spill headers and request path to JS land
   void Flush() {
     HandleScope scope(env()->isolate());
@@ -653,10 +849,15 @@ class Parser : public AsyncWrap, public StreamListener {
     if (!cb->IsFunction())
       return;
 
-    Local<Value> argv[2] = {
-      CreateHeaders(),
-      url_.ToString(env())
+    Local<Value> argv[3] = {
+      Local<Value>(),
+      url_.ToString(env()),
+      Undefined(env()->isolate())
     };
+    if (flat_headers_)
+      argv[0] = CreateFlatHeaders(&argv[2]);
+    else
+      argv[0] = CreateHeaders();
 
     MaybeLocal<Value> r = MakeCallback(cb.As<Function>(),
                                        arraysize(argv),
@@ -670,6 +871,18 @@ class Parser : public AsyncWrap, public StreamListener {
   }
 
 
+  // Leaves num_fields_ and num_values_ alone, Free() may be called from
+  // within a parser callback.
+  void ReleaseBuffers() {
+    url_.Release();
+    status_message_.Release();
+    for (size_t i = 0; i < arraysize(fields_); i++)
+      fields_[i].Release();
+    for (size_t i = 0; i < arraysize(values_); i++)
+      values_[i].Release();
+  }
+
+
   void Init(enum http_parser_type type) {
     http_parser_init(&parser_, type);
     url_.Reset();
@@ -678,6 +891,7 @@ class Parser : public AsyncWrap, public StreamListener {
     num_values_ = 0;
     have_flushed_ = false;
     got_exception_ = false;
+    flat_headers_ = false;
   }
 
 
@@ -690,6 +904,7 @@ class Parser : public AsyncWrap, public StreamListener {
   size_t num_values_;
   bool have_flushed_;
   bool got_exception_;
+  bool flat_headers_;
   Local<Object> current_buffer_;
   size_t current_buffer_len_;
   char* current_buffer_data_;
@@ -725,6 +940,92 @@ const struct http_parser_settings Parser::settings = {
 };
 
 
+// Removes CR and LF characters, and any whitespace that follows them, from
+// a header value to protect against response splitting.  This mirrors
+// escapeHeaderValue() in lib/_http_outgoing.js.  Returns the new length.
+size_t EscapeHeaderValue(uint8_t* value, size_t length) {
+  uint8_t* const end = value + length;
+  uint8_t* p = value;
+  while (p < end && *p != '\r' && *p != '\n')
+    p++;
+  uint8_t* out = p;
+  while (p < end) {
+    if (*p != '\r' && *p != '\n') {
+      *out++ = *p++;
+      continue;
+    }
+    while (p < end && (*p == '\r' || *p == '\n'))
+      p++;
+    while (p < end && (*p == ' ' || *p == '\t'))
+      p++;
+  }
+  return out - value;
+}
+
+
+// serializeHead(firstLine, fields) joins the start line and a flat
+// [name, value, name, value, ...] array of header fields into the head of
+// an HTTP/1.1 message, including the terminating empty line, using a single
+// allocation.  The fields must already have been validated.  Returns
+// undefined if any of them is not a one-byte string; the caller is expected
+// to fall back to building the head in JS in that case.
+void SerializeHead(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
+  Local<Context> context = env->context();
+
+  CHECK(args[0]->IsString());
+  CHECK(args[1]->IsArray());
+  Local<String> first_line = args[0].As<String>();
+  Local<Array> fields = args[1].As<Array>();
+  const uint32_t count = fields->Length();
+  CHECK_EQ(count % 2, 0);
+
+  if (!first_line->IsOneByte())
+    return;
+
+  // ": " and CRLF for every field, plus the final CRLF.
+  size_t length = first_line->Length() + (count / 2) * 4 + 2;
+  for (uint32_t i = 0; i < count; i++) {
+    Local<Value> field;
+    if (!fields->Get(context, i).ToLocal(&field))
+      return;
+    if (!field->IsString() || !field.As<String>()->IsOneByte())
+      return;
+    length += field.As<String>()->Length();
+  }
+
+  MaybeStackBuffer<uint8_t, 1024> head(length);
+  size_t offset = first_line->WriteOneByte(isolate, *head, 0, -1,
+                                           String::NO_NULL_TERMINATION);
+  for (uint32_t i = 0; i < count; i += 2) {
+    Local<String> name =
+        fields->Get(context, i).ToLocalChecked().As<String>();
+    Local<String> value =
+        fields->Get(context, i + 1).ToLocalChecked().As<String>();
+    offset += name->WriteOneByte(isolate, *head + offset, 0, -1,
+                                 String::NO_NULL_TERMINATION);
+    head[offset++] = ':';
+    head[offset++] = ' ';
+    const size_t value_length =
+        value->WriteOneByte(isolate, *head + offset, 0, -1,
+                            String::NO_NULL_TERMINATION);
+    offset += EscapeHeaderValue(*head + offset, value_length);
+    head[offset++] = '\r';
+    head[offset++] = '\n';
+  }
+  head[offset++] = '\r';
+  head[offset++] = '\n';
+  CHECK_LE(offset, length);
+
+  Local<String> result;
+  if (String::NewFromOneByte(isolate, *head, v8::NewStringType::kNormal,
+                             offset).ToLocal(&result)) {
+    args.GetReturnValue().Set(result);
+  }
+}
+
+
 void Initialize(Local<Object> target,
                 Local<Value> unused,
                 Local<Context> context,
@@ -767,9 +1068,12 @@ void Initialize(Local<Object> target,
   env->SetProtoMethod(t, "consume", Parser::Consume);
   env->SetProtoMethod(t, "unconsume", Parser::Unconsume);
   env->SetProtoMethod(t, "getCurrentBuffer", Parser::GetCurrentBuffer);
+  env->SetProtoMethod(t, "setFlatHeaders", Parser::SetFlatHeaders);
 
   target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "HTTPParser"),
               t->GetFunction());
+
+  env->SetMethod(target, "serializeHead", SerializeHead);
 }
 
 }  // anonymous namespace
@@ -47,6 +47,7 @@
 #include "node.h"
 #include "node_buffer.h"
 #include "node_errors.h"
+#include "simd_utils.h"
 #include "env-inl.h"
 #include "util-inl.h"
 #include "base_object-inl.h"
@@ -207,13 +208,6 @@ class ConverterObject : public BaseObject, Converter {
     int flags = args[2]->Uint32Value(env->context()).ToChecked();
 
     UErrorCode status = U_ZERO_ERROR;
-    MaybeStackBuffer<UChar> result;
-    MaybeLocal<Object> ret;
-    size_t limit = ucnv_getMinCharSize(converter->conv) *
-                   input_obj_length;
-    if (limit > 0)
-      result.AllocateSufficientStorage(limit);
-
     UBool flush = (flags & CONVERTER_FLAGS_FLUSH) == CONVERTER_FLAGS_FLUSH;
 
     const char* source = input_obj_data;
@@ -227,6 +221,34 @@ class ConverterObject : public BaseObject, Converter {
       converter->bomSeen_ = true;
     }
 
+    // Well-formed UTF-8 decodes to the same thing no matter what the error
+    // handling mode is.  Skip ICU and the UTF-16 round trip through a Buffer
+    // if no partial character is pending from a previous streaming call.
+    UErrorCode pending_status = U_ZERO_ERROR;
+    if (U_SUCCESS(status) &&
+        ucnv_getType(converter->conv) == UCNV_UTF8 &&
+        ucnv_toUCountPending(converter->conv, &pending_status) == 0 &&
+        U_SUCCESS(pending_status) &&
+        simd::ValidateUtf8(source, source_length)) {
+      Local<String> str;
+      if (String::NewFromUtf8(env->isolate(),
+                              source,
+                              v8::NewStringType::kNormal,
+                              source_length).ToLocal(&str)) {
+        args.GetReturnValue().Set(str);
+        if (flush)
+          converter->bomSeen_ = false;
+        return;
+      }
+    }
+
+    MaybeStackBuffer<UChar> result;
+    MaybeLocal<Object> ret;
+    size_t limit = ucnv_getMinCharSize(converter->conv) *
+                   input_obj_length;
+    if (limit > 0)
+      result.AllocateSufficientStorage(limit);
+
     UChar* target = *result;
     ucnv_toUnicode(converter->conv,
                    &target, target + (limit * sizeof(UChar)),
@@ -554,9 +554,13 @@ class InternalCallbackScope {
   bool closed_ = false;
 };
 
+// Work items declare their libuv threadpool priority class. File system
+// requests issued through uv_fs_*() are always scheduled as UV_WORK_FAST_IO.
 class ThreadPoolWork {
  public:
-  explicit inline ThreadPoolWork(Environment* env) : env_(env) {}
+  explicit inline ThreadPoolWork(Environment* env,
+                                 uv_work_kind kind = UV_WORK_CPU)
+      : env_(env), kind_(kind) {}
   inline virtual ~ThreadPoolWork() = default;
 
   inline void ScheduleWork();
@@ -567,14 +571,16 @@ class ThreadPoolWork {
 
  private:
   Environment* env_;
+  uv_work_kind kind_;
   uv_work_t work_req_;
 };
 
 void ThreadPoolWork::ScheduleWork() {
   env_->IncreaseWaitingRequestCounter();
-  int status = uv_queue_work(
+  int status = uv_queue_work_ex(
       env_->event_loop(),
       &work_req_,
+      kind_,
       [](uv_work_t* req) {
         ThreadPoolWork* self = ContainerOf(&ThreadPoolWork::work_req_, req);
         self->DoThreadPoolWork();
@@ -377,6 +377,22 @@ void Timerify(const FunctionCallbackInfo<Value>& args) {
   args.GetReturnValue().Set(wrap);
 }
 
+// Copies the counters libuv keeps for this environment's event loop into
+// the loopMetrics array. Idle time is converted to milliseconds.
+void RefreshLoopMetrics(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  AliasedBuffer<double, v8::Float64Array>& loop_metrics =
+      env->performance_state()->loop_metrics;
+  uv_metrics_t metrics;
+  uv_metrics_info(env->event_loop(), &metrics);
+  loop_metrics[NODE_PERFORMANCE_LOOP_METRIC_LOOP_COUNT] = metrics.loop_count;
+  loop_metrics[NODE_PERFORMANCE_LOOP_METRIC_WAKEUPS] = metrics.wakeups;
+  loop_metrics[NODE_PERFORMANCE_LOOP_METRIC_EVENTS] = metrics.events;
+  loop_metrics[NODE_PERFORMANCE_LOOP_METRIC_CTL_CALLS] = metrics.ctl_calls;
+  loop_metrics[NODE_PERFORMANCE_LOOP_METRIC_IDLE_TIME] =
+      metrics.idle_time / 1e6;
+}
+
 
 void Initialize(Local<Object> target,
                 Local<Value> unused,
@@ -391,6 +407,9 @@ void Initialize(Local<Object> target,
   target->Set(context,
               FIXED_ONE_BYTE_STRING(isolate, "milestones"),
               state->milestones.GetJSArray()).FromJust();
+  target->Set(context,
+              FIXED_ONE_BYTE_STRING(isolate, "loopMetrics"),
+              state->loop_metrics.GetJSArray()).FromJust();
 
   Local<String> performanceEntryString =
       FIXED_ONE_BYTE_STRING(isolate, "PerformanceEntry");
@@ -407,6 +426,7 @@ void Initialize(Local<Object> target,
   env->SetMethod(target, "markMilestone", MarkMilestone);
   env->SetMethod(target, "setupObservers", SetupPerformanceObservers);
   env->SetMethod(target, "timerify", Timerify);
+  env->SetMethod(target, "refreshLoopMetrics", RefreshLoopMetrics);
 
   Local<Object> constants = Object::New(isolate);
 
@@ -425,6 +445,11 @@ void Initialize(Local<Object> target,
   NODE_PERFORMANCE_MILESTONES(V)
 #undef V
 
+#define V(name, _)                                                            \
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, NODE_PERFORMANCE_LOOP_METRIC_##name);
+  NODE_PERFORMANCE_LOOP_METRICS(V)
+#undef V
+
   v8::PropertyAttribute attr =
       static_cast<v8::PropertyAttribute>(v8::ReadOnly | v8::DontDelete);
 
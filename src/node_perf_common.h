@@ -27,6 +27,14 @@ extern uint64_t performance_v8_start;
   V(BOOTSTRAP_COMPLETE, "bootstrapComplete")
 
 
+#define NODE_PERFORMANCE_LOOP_METRICS(V)                                      \
+  V(LOOP_COUNT, "loopCount")                                                  \
+  V(WAKEUPS, "wakeups")                                                       \
+  V(EVENTS, "events")                                                         \
+  V(CTL_CALLS, "ctlCalls")                                                    \
+  V(IDLE_TIME, "idleTime")
+
+
 #define NODE_PERFORMANCE_ENTRY_TYPES(V)                                       \
   V(NODE, "node")                                                             \
   V(MARK, "mark")                                                             \
@@ -42,6 +50,13 @@ enum PerformanceMilestone {
   NODE_PERFORMANCE_MILESTONE_INVALID
 };
 
+enum PerformanceLoopMetric {
+#define V(name, _) NODE_PERFORMANCE_LOOP_METRIC_##name,
+  NODE_PERFORMANCE_LOOP_METRICS(V)
+#undef V
+  NODE_PERFORMANCE_LOOP_METRIC_INVALID
+};
+
 enum PerformanceEntryType {
 #define V(name, _) NODE_PERFORMANCE_ENTRY_TYPE_##name,
   NODE_PERFORMANCE_ENTRY_TYPES(V)
@@ -60,6 +75,11 @@ class performance_state {
       offsetof(performance_state_internal, milestones),
       NODE_PERFORMANCE_MILESTONE_INVALID,
       root),
+    loop_metrics(
+      isolate,
+      offsetof(performance_state_internal, loop_metrics),
+      NODE_PERFORMANCE_LOOP_METRIC_INVALID,
+      root),
     observers(
       isolate,
       offsetof(performance_state_internal, observers),
@@ -71,6 +91,7 @@ class performance_state {
 
   AliasedBuffer<uint8_t, v8::Uint8Array> root;
   AliasedBuffer<double, v8::Float64Array> milestones;
+  AliasedBuffer<double, v8::Float64Array> loop_metrics;
   AliasedBuffer<uint32_t, v8::Uint32Array> observers;
 
   void Mark(enum PerformanceMilestone milestone,
@@ -80,6 +101,7 @@ class performance_state {
   struct performance_state_internal {
     // doubles first so that they are always sizeof(double)-aligned
     double milestones[NODE_PERFORMANCE_MILESTONE_INVALID];
+    double loop_metrics[NODE_PERFORMANCE_LOOP_METRIC_INVALID];
     uint32_t observers[NODE_PERFORMANCE_ENTRY_TYPE_INVALID];
   };
 };
@@ -68,6 +68,7 @@ Worker::Worker(Environment* env, Local<Object> wrap)
   array_buffer_allocator_.reset(CreateArrayBufferAllocator());
 
   CHECK_EQ(uv_loop_init(&loop_), 0);
+  uv_loop_configure(&loop_, UV_METRICS_IDLE_TIME);
   isolate_ = NewIsolate(array_buffer_allocator_.get(), &loop_);
   CHECK_NE(isolate_, nullptr);
 
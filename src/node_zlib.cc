@@ -30,11 +30,18 @@
 #include "v8.h"
 #include "zlib.h"
 
+#if HAVE_BROTLI
+#include "brotli/decode.h"
+#include "brotli/encode.h"
+#endif
+
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/types.h>
 #include <atomic>
+#include <string>
+#include <vector>
 
 namespace node {
 
@@ -46,11 +53,15 @@ using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
 using v8::HandleScope;
 using v8::Int32;
+using v8::Integer;
+using v8::Isolate;
 using v8::Local;
 using v8::Number;
 using v8::Object;
 using v8::String;
+using v8::Uint32;
 using v8::Uint32Array;
+using v8::Undefined;
 using v8::Value;
 
 namespace {
@@ -63,42 +74,35 @@ enum node_zlib_mode {
   GUNZIP,
   DEFLATERAW,
   INFLATERAW,
-  UNZIP
+  UNZIP,
+  BROTLI_DECODE,
+  BROTLI_ENCODE
 };
 
 #define GZIP_HEADER_ID1 0x1f
 #define GZIP_HEADER_ID2 0x8b
 
 /**
- * Deflate/Inflate
+ * The parts of a streaming (de)compressor that do not depend on the
+ * compression library: the write() call that runs on the threadpool, error
+ * reporting and closing, and the accounting of the memory allocated by the
+ * library. Subclasses wrap one library's stream state.
  */
-class ZCtx : public AsyncWrap, public ThreadPoolWork {
+class CompressionStream : public AsyncWrap, public ThreadPoolWork {
  public:
-  ZCtx(Environment* env, Local<Object> wrap, node_zlib_mode mode)
+  CompressionStream(Environment* env, Local<Object> wrap)
       : AsyncWrap(env, wrap, AsyncWrap::PROVIDER_ZLIB),
         ThreadPoolWork(env),
-        dictionary_(nullptr),
-        dictionary_len_(0),
-        err_(0),
-        flush_(0),
         init_done_(false),
-        level_(0),
-        memLevel_(0),
-        mode_(mode),
-        strategy_(0),
-        windowBits_(0),
         write_in_progress_(false),
         pending_close_(false),
         refs_(0),
-        gzip_id_bytes_read_(0),
         write_result_(nullptr) {
     MakeWeak();
   }
 
-
-  ~ZCtx() override {
+  ~CompressionStream() override {
     CHECK_EQ(false, write_in_progress_ && "write in progress");
-    Close();
     CHECK_EQ(zlib_memory_, 0);
     CHECK_EQ(unreported_allocations_, 0);
   }
@@ -111,29 +115,14 @@ class ZCtx : public AsyncWrap, public ThreadPoolWork {
 
     pending_close_ = false;
     CHECK(init_done_ && "close before init");
-    CHECK_LE(mode_, UNZIP);
 
     AllocScope alloc_scope(this);
-    int status = Z_OK;
-    if (mode_ == DEFLATE || mode_ == GZIP || mode_ == DEFLATERAW) {
-      status = deflateEnd(&strm_);
-    } else if (mode_ == INFLATE || mode_ == GUNZIP || mode_ == INFLATERAW ||
-               mode_ == UNZIP) {
-      status = inflateEnd(&strm_);
-    }
-
-    CHECK(status == Z_OK || status == Z_DATA_ERROR);
-    mode_ = NONE;
-
-    if (dictionary_ != nullptr) {
-      delete[] dictionary_;
-      dictionary_ = nullptr;
-    }
+    CloseStream();
   }
 
 
   static void Close(const FunctionCallbackInfo<Value>& args) {
-    ZCtx* ctx;
+    CompressionStream* ctx;
     ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
     ctx->Close();
   }
@@ -144,10 +133,10 @@ class ZCtx : public AsyncWrap, public ThreadPoolWork {
   static void Write(const FunctionCallbackInfo<Value>& args) {
     CHECK_EQ(args.Length(), 7);
 
-    ZCtx* ctx;
+    CompressionStream* ctx;
     ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
     CHECK(ctx->init_done_ && "write before init");
-    CHECK(ctx->mode_ != NONE && "already finalized");
+    CHECK(ctx->IsOpen() && "already finalized");
 
     CHECK_EQ(false, ctx->write_in_progress_ && "write already in progress");
     CHECK_EQ(false, ctx->pending_close_ && "close is pending");
@@ -158,20 +147,12 @@ class ZCtx : public AsyncWrap, public ThreadPoolWork {
 
     unsigned int flush =
         args[0]->Uint32Value(ctx->env()->context()).FromMaybe(0);
-
-    if (flush != Z_NO_FLUSH &&
-        flush != Z_PARTIAL_FLUSH &&
-        flush != Z_SYNC_FLUSH &&
-        flush != Z_FULL_FLUSH &&
-        flush != Z_FINISH &&
-        flush != Z_BLOCK) {
-      CHECK(0 && "Invalid flush value");
-    }
+    CHECK(ctx->IsValidFlush(flush) && "Invalid flush value");
 
     AllocScope alloc_scope(ctx);
 
-    Bytef* in;
-    Bytef* out;
+    char* in;
+    char* out;
     size_t in_off, in_len, out_off, out_len;
     Environment* env = ctx->env();
 
@@ -188,7 +169,7 @@ class ZCtx : public AsyncWrap, public ThreadPoolWork {
       in_len = args[3]->Uint32Value(env->context()).FromMaybe(0);
 
       CHECK(Buffer::IsWithinBounds(in_off, in_len, Buffer::Length(in_buf)));
-      in = reinterpret_cast<Bytef *>(Buffer::Data(in_buf) + in_off);
+      in = Buffer::Data(in_buf) + in_off;
     }
 
     CHECK(Buffer::HasInstance(args[4]));
@@ -196,21 +177,16 @@ class ZCtx : public AsyncWrap, public ThreadPoolWork {
     out_off = args[5]->Uint32Value(env->context()).FromMaybe(0);
     out_len = args[6]->Uint32Value(env->context()).FromMaybe(0);
     CHECK(Buffer::IsWithinBounds(out_off, out_len, Buffer::Length(out_buf)));
-    out = reinterpret_cast<Bytef *>(Buffer::Data(out_buf) + out_off);
+    out = Buffer::Data(out_buf) + out_off;
 
-    ctx->strm_.avail_in = in_len;
-    ctx->strm_.next_in = in;
-    ctx->strm_.avail_out = out_len;
-    ctx->strm_.next_out = out;
-    ctx->flush_ = flush;
+    ctx->SetBuffers(in, in_len, out, out_len, flush);
 
     if (!async) {
       // sync version
       env->PrintSyncTrace();
       ctx->DoThreadPoolWork();
       if (ctx->CheckError()) {
-        ctx->write_result_[0] = ctx->strm_.avail_out;
-        ctx->write_result_[1] = ctx->strm_.avail_in;
+        ctx->UpdateWriteResult();
         ctx->write_in_progress_ = false;
         ctx->Unref();
       }
@@ -221,6 +197,175 @@ class ZCtx : public AsyncWrap, public ThreadPoolWork {
     ctx->ScheduleWork();
   }
 
+
+  // v8 land!
+  void AfterThreadPoolWork(int status) override {
+    AllocScope alloc_scope(this);
+
+    write_in_progress_ = false;
+
+    if (status == UV_ECANCELED) {
+      Close();
+      return;
+    }
+
+    CHECK_EQ(status, 0);
+
+    HandleScope handle_scope(env()->isolate());
+    Context::Scope context_scope(env()->context());
+
+    if (!CheckError())
+      return;
+
+    UpdateWriteResult();
+
+    // call the write() cb
+    Local<Function> cb = PersistentToLocal(env()->isolate(),
+                                           write_js_callback_);
+    MakeCallback(cb, 0, nullptr);
+
+    Unref();
+    if (pending_close_)
+      Close();
+  }
+
+  // TODO(addaleax): Switch to modern error system (node_errors.h).
+  void EmitError(const char* message, int err, const char* code = nullptr) {
+    // If you hit this assertion, you forgot to enter the v8::Context first.
+    CHECK_EQ(env()->context(), env()->isolate()->GetCurrentContext());
+
+    HandleScope scope(env()->isolate());
+    Local<Value> args[3] = {
+      OneByteString(env()->isolate(), message),
+      Number::New(env()->isolate(), err),
+      code != nullptr ?
+          OneByteString(env()->isolate(), code).As<Value>() :
+          Undefined(env()->isolate()).As<Value>()
+    };
+    MakeCallback(env()->onerror_string(), arraysize(args), args);
+
+    // no hope of rescue.
+    if (write_in_progress_)
+      Unref();
+    write_in_progress_ = false;
+    if (pending_close_)
+      Close();
+  }
+
+ protected:
+  // Whether the stream can still be written to.
+  virtual bool IsOpen() const = 0;
+  virtual bool IsValidFlush(unsigned int flush) const = 0;
+  // Sets up the input and output of the next DoThreadPoolWork() call.
+  virtual void SetBuffers(char* in, size_t in_len, char* out, size_t out_len,
+                          unsigned int flush) = 0;
+  // Stores the remaining output and input space in write_result_.
+  virtual void UpdateWriteResult() = 0;
+  // Reports an error that happened in DoThreadPoolWork() through
+  // EmitError(), if there was one, and returns false in that case.
+  virtual bool CheckError() = 0;
+  // Releases the library's stream state.
+  virtual void CloseStream() = 0;
+
+  void Ref() {
+    if (++refs_ == 1) {
+      ClearWeak();
+    }
+  }
+
+  void Unref() {
+    CHECK_GT(refs_, 0);
+    if (--refs_ == 0) {
+      MakeWeak();
+    }
+  }
+
+  // Allocation functions provided to zlib and brotli. We store the real size
+  // of the allocated memory chunk just before the "payload" memory we return
+  // to the library.
+  // Because the libraries run off the thread pool, we can not report memory
+  // directly to V8; rather, we first store it as "unreported" memory in a
+  // separate field and later report it back from the main thread.
+  static void* AllocForZlib(void* data, uInt items, uInt size) {
+    return AllocForBrotli(data,
+                          MultiplyWithOverflowCheck(static_cast<size_t>(items),
+                                                    static_cast<size_t>(size)));
+  }
+
+  static void* AllocForBrotli(void* data, size_t size) {
+    CompressionStream* ctx = static_cast<CompressionStream*>(data);
+    size_t real_size = size + sizeof(size_t);
+    char* memory = UncheckedMalloc(real_size);
+    if (UNLIKELY(memory == nullptr)) return nullptr;
+    *reinterpret_cast<size_t*>(memory) = real_size;
+    ctx->unreported_allocations_.fetch_add(real_size,
+                                           std::memory_order_relaxed);
+    return memory + sizeof(size_t);
+  }
+
+  static void FreeForZlib(void* data, void* pointer) {
+    if (UNLIKELY(pointer == nullptr)) return;
+    CompressionStream* ctx = static_cast<CompressionStream*>(data);
+    char* real_pointer = static_cast<char*>(pointer) - sizeof(size_t);
+    size_t real_size = *reinterpret_cast<size_t*>(real_pointer);
+    ctx->unreported_allocations_.fetch_sub(real_size,
+                                           std::memory_order_relaxed);
+    free(real_pointer);
+  }
+
+  // This is called on the main thread after zlib may have allocated something
+  // in order to report it back to V8.
+  void AdjustAmountOfExternalAllocatedMemory() {
+    ssize_t report =
+        unreported_allocations_.exchange(0, std::memory_order_relaxed);
+    if (report == 0) return;
+    CHECK_IMPLIES(report < 0, zlib_memory_ >= static_cast<size_t>(-report));
+    zlib_memory_ += report;
+    env()->isolate()->AdjustAmountOfExternalAllocatedMemory(report);
+  }
+
+  struct AllocScope {
+    explicit AllocScope(CompressionStream* ctx) : ctx(ctx) {}
+    ~AllocScope() { ctx->AdjustAmountOfExternalAllocatedMemory(); }
+    CompressionStream* ctx;
+  };
+
+  bool init_done_;
+  bool write_in_progress_;
+  bool pending_close_;
+  unsigned int refs_;
+  uint32_t* write_result_;
+  Persistent<Function> write_js_callback_;
+  std::atomic<ssize_t> unreported_allocations_{0};
+  size_t zlib_memory_ = 0;
+};
+
+
+/**
+ * Deflate/Inflate
+ */
+class ZCtx : public CompressionStream {
+ public:
+  ZCtx(Environment* env, Local<Object> wrap, node_zlib_mode mode)
+      : CompressionStream(env, wrap),
+        dictionary_(nullptr),
+        dictionary_len_(0),
+        err_(0),
+        flush_(0),
+        level_(0),
+        memLevel_(0),
+        mode_(mode),
+        strategy_(0),
+        windowBits_(0),
+        gzip_id_bytes_read_(0) {
+  }
+
+
+  ~ZCtx() override {
+    CHECK_EQ(false, write_in_progress_ && "write in progress");
+    Close();
+  }
+
   // thread pool!
   // This function may be called multiple times on the uv_work pool
   // for a single write() call, until all of the input bytes have
@@ -330,7 +475,7 @@ class ZCtx : public AsyncWrap, public ThreadPoolWork {
   }
 
 
-  bool CheckError() {
+  bool CheckError() override {
     // Acceptable error states depend on the type of zlib stream.
     switch (err_) {
     case Z_OK:
@@ -358,60 +503,11 @@ class ZCtx : public AsyncWrap, public ThreadPoolWork {
   }
 
 
-  // v8 land!
-  void AfterThreadPoolWork(int status) override {
-    AllocScope alloc_scope(this);
-
-    write_in_progress_ = false;
-
-    if (status == UV_ECANCELED) {
-      Close();
-      return;
-    }
-
-    CHECK_EQ(status, 0);
-
-    HandleScope handle_scope(env()->isolate());
-    Context::Scope context_scope(env()->context());
-
-    if (!CheckError())
-      return;
-
-    write_result_[0] = strm_.avail_out;
-    write_result_[1] = strm_.avail_in;
-
-    // call the write() cb
-    Local<Function> cb = PersistentToLocal(env()->isolate(),
-                                           write_js_callback_);
-    MakeCallback(cb, 0, nullptr);
-
-    Unref();
-    if (pending_close_)
-      Close();
-  }
-
-  // TODO(addaleax): Switch to modern error system (node_errors.h).
   void Error(const char* message) {
-    // If you hit this assertion, you forgot to enter the v8::Context first.
-    CHECK_EQ(env()->context(), env()->isolate()->GetCurrentContext());
-
     if (strm_.msg != nullptr) {
       message = strm_.msg;
     }
-
-    HandleScope scope(env()->isolate());
-    Local<Value> args[2] = {
-      OneByteString(env()->isolate(), message),
-      Number::New(env()->isolate(), err_)
-    };
-    MakeCallback(env()->onerror_string(), arraysize(args), args);
-
-    // no hope of rescue.
-    if (write_in_progress_)
-      Unref();
-    write_in_progress_ = false;
-    if (pending_close_)
-      Close();
+    EmitError(message, err_);
   }
 
   static void New(const FunctionCallbackInfo<Value>& args) {
@@ -510,6 +606,24 @@ class ZCtx : public AsyncWrap, public ThreadPoolWork {
     SetDictionary(ctx);
   }
 
+  // Called when the handle is put back into the pool of idle handles in
+  // lib/zlib.js. The stream is reset so that it can be used again without
+  // reallocating zlib's state, and the destroy() callbacks are run since
+  // the destructor is not going to run for now. Returns false if the handle
+  // cannot be reused.
+  static void Free(const FunctionCallbackInfo<Value>& args) {
+    ZCtx* ctx;
+    ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+    CHECK(!ctx->write_in_progress_);
+
+    ctx->err_ = ctx->ResetStream();
+    if (ctx->err_ != Z_OK)
+      return args.GetReturnValue().Set(false);
+    ctx->flush_ = Z_NO_FLUSH;
+    ctx->EmitDestroy();
+    args.GetReturnValue().Set(true);
+  }
+
   static bool Init(ZCtx* ctx, int level, int windowBits, int memLevel,
                    int strategy, uint32_t* write_result,
                    Local<Function> write_js_callback, char* dictionary,
@@ -630,113 +744,534 @@ class ZCtx : public AsyncWrap, public ThreadPoolWork {
   }
 
   void Reset() {
-    AllocScope alloc_scope(this);
+    err_ = ResetStream();
 
-    err_ = Z_OK;
+    if (err_ != Z_OK) {
+      Error("Failed to reset stream");
+    }
+  }
+
+  int ResetStream() {
+    AllocScope alloc_scope(this);
 
     switch (mode_) {
       case DEFLATE:
       case DEFLATERAW:
       case GZIP:
-        err_ = deflateReset(&strm_);
-        break;
+        return deflateReset(&strm_);
       case INFLATE:
       case INFLATERAW:
       case GUNZIP:
-        err_ = inflateReset(&strm_);
-        break;
+        return inflateReset(&strm_);
       default:
-        break;
-    }
-
-    if (err_ != Z_OK) {
-      Error("Failed to reset stream");
+        return Z_OK;
     }
   }
 
   size_t self_size() const override { return sizeof(*this); }
 
- private:
-  void Ref() {
-    if (++refs_ == 1) {
-      ClearWeak();
-    }
+ protected:
+  bool IsOpen() const override {
+    return mode_ != NONE;
   }
 
-  void Unref() {
-    CHECK_GT(refs_, 0);
-    if (--refs_ == 0) {
-      MakeWeak();
-    }
+  bool IsValidFlush(unsigned int flush) const override {
+    return flush == Z_NO_FLUSH ||
+           flush == Z_PARTIAL_FLUSH ||
+           flush == Z_SYNC_FLUSH ||
+           flush == Z_FULL_FLUSH ||
+           flush == Z_FINISH ||
+           flush == Z_BLOCK;
   }
 
-  // Allocation functions provided to zlib itself. We store the real size of
-  // the allocated memory chunk just before the "payload" memory we return
-  // to zlib.
-  // Because we use zlib off the thread pool, we can not report memory directly
-  // to V8; rather, we first store it as "unreported" memory in a separate
-  // field and later report it back from the main thread.
-  static void* AllocForZlib(void* data, uInt items, uInt size) {
-    ZCtx* ctx = static_cast<ZCtx*>(data);
-    size_t real_size =
-        MultiplyWithOverflowCheck(static_cast<size_t>(items),
-                                  static_cast<size_t>(size)) + sizeof(size_t);
-    char* memory = UncheckedMalloc(real_size);
-    if (UNLIKELY(memory == nullptr)) return nullptr;
-    *reinterpret_cast<size_t*>(memory) = real_size;
-    ctx->unreported_allocations_.fetch_add(real_size,
-                                           std::memory_order_relaxed);
-    return memory + sizeof(size_t);
+  void SetBuffers(char* in, size_t in_len, char* out, size_t out_len,
+                  unsigned int flush) override {
+    strm_.avail_in = in_len;
+    strm_.next_in = reinterpret_cast<Bytef*>(in);
+    strm_.avail_out = out_len;
+    strm_.next_out = reinterpret_cast<Bytef*>(out);
+    flush_ = flush;
   }
 
-  static void FreeForZlib(void* data, void* pointer) {
-    if (UNLIKELY(pointer == nullptr)) return;
-    ZCtx* ctx = static_cast<ZCtx*>(data);
-    char* real_pointer = static_cast<char*>(pointer) - sizeof(size_t);
-    size_t real_size = *reinterpret_cast<size_t*>(real_pointer);
-    ctx->unreported_allocations_.fetch_sub(real_size,
-                                           std::memory_order_relaxed);
-    free(real_pointer);
+  void UpdateWriteResult() override {
+    write_result_[0] = strm_.avail_out;
+    write_result_[1] = strm_.avail_in;
   }
 
-  // This is called on the main thread after zlib may have allocated something
-  // in order to report it back to V8.
-  void AdjustAmountOfExternalAllocatedMemory() {
-    ssize_t report =
-        unreported_allocations_.exchange(0, std::memory_order_relaxed);
-    if (report == 0) return;
-    CHECK_IMPLIES(report < 0, zlib_memory_ >= static_cast<size_t>(-report));
-    zlib_memory_ += report;
-    env()->isolate()->AdjustAmountOfExternalAllocatedMemory(report);
-  }
+  void CloseStream() override {
+    CHECK_LE(mode_, UNZIP);
 
-  struct AllocScope {
-    explicit AllocScope(ZCtx* ctx) : ctx(ctx) {}
-    ~AllocScope() { ctx->AdjustAmountOfExternalAllocatedMemory(); }
-    ZCtx* ctx;
-  };
+    int status = Z_OK;
+    if (mode_ == DEFLATE || mode_ == GZIP || mode_ == DEFLATERAW) {
+      status = deflateEnd(&strm_);
+    } else if (mode_ == INFLATE || mode_ == GUNZIP || mode_ == INFLATERAW ||
+               mode_ == UNZIP) {
+      status = inflateEnd(&strm_);
+    }
 
+    CHECK(status == Z_OK || status == Z_DATA_ERROR);
+    mode_ = NONE;
+
+    if (dictionary_ != nullptr) {
+      delete[] dictionary_;
+      dictionary_ = nullptr;
+    }
+  }
+
+ private:
   Bytef* dictionary_;
   size_t dictionary_len_;
   int err_;
   int flush_;
-  bool init_done_;
   int level_;
   int memLevel_;
   node_zlib_mode mode_;
   int strategy_;
   z_stream strm_;
   int windowBits_;
-  bool write_in_progress_;
-  bool pending_close_;
-  unsigned int refs_;
   unsigned int gzip_id_bytes_read_;
-  uint32_t* write_result_;
-  Persistent<Function> write_js_callback_;
-  std::atomic<ssize_t> unreported_allocations_{0};
-  size_t zlib_memory_ = 0;
 };
 
+#if HAVE_BROTLI
+/**
+ * Brotli compression/decompression, see lib/zlib.js. The streams are driven
+ * by the same write() calls as ZCtx, with one of the BROTLI_OPERATION_*
+ * values in place of the zlib flush flags.
+ */
+class BrotliCtx : public CompressionStream {
+ public:
+  BrotliCtx(Environment* env, Local<Object> wrap, node_zlib_mode mode)
+      : CompressionStream(env, wrap),
+        mode_(mode),
+        encoder_(nullptr),
+        decoder_(nullptr),
+        flush_(BROTLI_OPERATION_PROCESS),
+        next_in_(nullptr),
+        avail_in_(0),
+        next_out_(nullptr),
+        avail_out_(0),
+        encoder_ok_(true),
+        decoder_result_(BROTLI_DECODER_RESULT_SUCCESS),
+        decoder_error_(BROTLI_DECODER_NO_ERROR) {
+  }
+
+  ~BrotliCtx() override {
+    CHECK_EQ(false, write_in_progress_ && "write in progress");
+    Close();
+  }
+
+  static void New(const FunctionCallbackInfo<Value>& args) {
+    Environment* env = Environment::GetCurrent(args);
+    CHECK(args[0]->IsInt32());
+    node_zlib_mode mode =
+        static_cast<node_zlib_mode>(args[0].As<Int32>()->Value());
+    CHECK(mode == BROTLI_ENCODE || mode == BROTLI_DECODE);
+    new BrotliCtx(env, args.This(), mode);
+  }
+
+  // init(params, writeResult, writeCallback)
+  // params holds the value of each BROTLI_PARAM_* (or BROTLI_DECODER_PARAM_*)
+  // at its index, or 0xFFFFFFFF for parameters that keep their default.
+  static void Init(const FunctionCallbackInfo<Value>& args) {
+    CHECK(args.Length() == 3 && "init(params, writeResult, writeCallback)");
+    BrotliCtx* ctx;
+    ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+
+    CHECK(args[0]->IsUint32Array());
+    Local<Uint32Array> params = args[0].As<Uint32Array>();
+    ctx->params_.resize(params->Length());
+    params->CopyContents(ctx->params_.data(),
+                         ctx->params_.size() * sizeof(uint32_t));
+
+    CHECK(args[1]->IsUint32Array());
+    Local<Uint32Array> array = args[1].As<Uint32Array>();
+    Local<ArrayBuffer> ab = array->Buffer();
+    uint32_t* write_result = static_cast<uint32_t*>(ab->GetContents().Data());
+
+    Local<Function> write_js_callback = args[2].As<Function>();
+
+    ctx->init_done_ = true;
+    bool ret = ctx->InitStream();
+    if (ret) {
+      ctx->write_result_ = write_result;
+      ctx->write_js_callback_.Reset(ctx->env()->isolate(), write_js_callback);
+    }
+    args.GetReturnValue().Set(ret);
+  }
+
+  static void Reset(const FunctionCallbackInfo<Value>& args) {
+    BrotliCtx* ctx;
+    ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+    AllocScope alloc_scope(ctx);
+    ctx->CloseStream();
+    if (!ctx->InitStream())
+      ctx->EmitError("Failed to reset stream", -1);
+  }
+
+  // thread pool!
+  void DoThreadPoolWork() override {
+    if (mode_ == BROTLI_ENCODE) {
+      encoder_ok_ = BrotliEncoderCompressStream(
+          encoder_, static_cast<BrotliEncoderOperation>(flush_),
+          &avail_in_, &next_in_, &avail_out_, &next_out_, nullptr);
+    } else {
+      decoder_result_ = BrotliDecoderDecompressStream(
+          decoder_, &avail_in_, &next_in_, &avail_out_, &next_out_, nullptr);
+      if (decoder_result_ == BROTLI_DECODER_RESULT_ERROR)
+        decoder_error_ = BrotliDecoderGetErrorCode(decoder_);
+    }
+  }
+
+  bool CheckError() override {
+    if (mode_ == BROTLI_ENCODE) {
+      if (!encoder_ok_) {
+        EmitError("Compression failed", -1, "ERR_BROTLI_COMPRESSION_FAILED");
+        return false;
+      }
+      return true;
+    }
+
+    if (decoder_result_ == BROTLI_DECODER_RESULT_ERROR) {
+      std::string code =
+          std::string("ERR_BROTLI_") + BrotliDecoderErrorString(decoder_error_);
+      EmitError("Decompression failed", decoder_error_, code.c_str());
+      return false;
+    }
+    if (flush_ == BROTLI_OPERATION_FINISH &&
+        decoder_result_ == BROTLI_DECODER_RESULT_NEEDS_MORE_INPUT) {
+      // Like zlib, report a truncated stream once all input has been seen.
+      EmitError("unexpected end of file", Z_BUF_ERROR);
+      return false;
+    }
+    return true;
+  }
+
+  size_t self_size() const override { return sizeof(*this); }
+
+ protected:
+  bool IsOpen() const override {
+    return encoder_ != nullptr || decoder_ != nullptr;
+  }
+
+  bool IsValidFlush(unsigned int flush) const override {
+    return flush == BROTLI_OPERATION_PROCESS ||
+           flush == BROTLI_OPERATION_FLUSH ||
+           flush == BROTLI_OPERATION_FINISH;
+  }
+
+  void SetBuffers(char* in, size_t in_len, char* out, size_t out_len,
+                  unsigned int flush) override {
+    next_in_ = reinterpret_cast<const uint8_t*>(in);
+    avail_in_ = in_len;
+    next_out_ = reinterpret_cast<uint8_t*>(out);
+    avail_out_ = out_len;
+    flush_ = flush;
+  }
+
+  void UpdateWriteResult() override {
+    write_result_[0] = avail_out_;
+    write_result_[1] = avail_in_;
+  }
+
+  void CloseStream() override {
+    if (encoder_ != nullptr) {
+      BrotliEncoderDestroyInstance(encoder_);
+      encoder_ = nullptr;
+    }
+    if (decoder_ != nullptr) {
+      BrotliDecoderDestroyInstance(decoder_);
+      decoder_ = nullptr;
+    }
+  }
+
+ private:
+  static const uint32_t kUnsetParam = 0xFFFFFFFF;
+
+  // Creates the encoder or decoder and applies params_ to it.
+  bool InitStream() {
+    AllocScope alloc_scope(this);
+    void* opaque = static_cast<void*>(this);
+    bool ok = true;
+
+    if (mode_ == BROTLI_ENCODE) {
+      encoder_ = BrotliEncoderCreateInstance(AllocForBrotli, FreeForZlib,
+                                             opaque);
+      if (encoder_ == nullptr)
+        return false;
+      for (size_t i = 0; ok && i < params_.size(); i++) {
+        if (params_[i] == kUnsetParam)
+          continue;
+        ok = BrotliEncoderSetParameter(
+            encoder_, static_cast<BrotliEncoderParameter>(i), params_[i]);
+      }
+    } else {
+      decoder_ = BrotliDecoderCreateInstance(AllocForBrotli, FreeForZlib,
+                                             opaque);
+      if (decoder_ == nullptr)
+        return false;
+      for (size_t i = 0; ok && i < params_.size(); i++) {
+        if (params_[i] == kUnsetParam)
+          continue;
+        ok = BrotliDecoderSetParameter(
+            decoder_, static_cast<BrotliDecoderParameter>(i), params_[i]);
+      }
+    }
+
+    if (!ok)
+      CloseStream();
+    encoder_ok_ = true;
+    decoder_result_ = BROTLI_DECODER_RESULT_SUCCESS;
+    decoder_error_ = BROTLI_DECODER_NO_ERROR;
+    return ok;
+  }
+
+  node_zlib_mode mode_;
+  BrotliEncoderState* encoder_;
+  BrotliDecoderState* decoder_;
+  std::vector<uint32_t> params_;
+  unsigned int flush_;
+  const uint8_t* next_in_;
+  size_t avail_in_;
+  uint8_t* next_out_;
+  size_t avail_out_;
+  bool encoder_ok_;
+  BrotliDecoderResult decoder_result_;
+  BrotliDecoderErrorCode decoder_error_;
+};
+#endif  // HAVE_BROTLI
+
+
+/**
+ * Raw deflate of one block of a gzip stream that is compressed in parallel,
+ * see lib/zlib.js. Each block is compressed on its own, optionally primed
+ * with a dictionary, and ends in a sync flush (or the final deflate block
+ * for the last one) so that the output of the blocks can be concatenated.
+ */
+class DeflateBlock : public AsyncWrap, public ThreadPoolWork {
+ public:
+  DeflateBlock(Environment* env, Local<Object> wrap, int windowBits,
+               int memLevel)
+      : AsyncWrap(env, wrap, AsyncWrap::PROVIDER_ZLIB),
+        ThreadPoolWork(env),
+        windowBits_(windowBits),
+        memLevel_(memLevel) {
+    MakeWeak();
+  }
+
+  ~DeflateBlock() override {
+    CHECK_EQ(false, work_in_progress_ && "compress in progress");
+    Close();
+  }
+
+  static void New(const FunctionCallbackInfo<Value>& args) {
+    Environment* env = Environment::GetCurrent(args);
+    CHECK(args[0]->IsInt32());
+    CHECK(args[1]->IsInt32());
+    int windowBits = args[0].As<Int32>()->Value();
+    int memLevel = args[1].As<Int32>()->Value();
+    CHECK((windowBits >= Z_MIN_WINDOWBITS &&
+           windowBits <= Z_MAX_WINDOWBITS) && "invalid windowBits");
+    CHECK((memLevel >= Z_MIN_MEMLEVEL && memLevel <= Z_MAX_MEMLEVEL) &&
+      "invalid memlevel");
+    new DeflateBlock(env, args.This(), windowBits, memLevel);
+  }
+
+  // compress(input, dictionary, flush, level, strategy)
+  // The result is passed to the oncomplete(errno, output, crc) callback of
+  // the handle, which is called synchronously by compressSync(). The input
+  // and the dictionary have to be kept alive until then.
+  template <bool async>
+  static void Compress(const FunctionCallbackInfo<Value>& args) {
+    CHECK_EQ(args.Length(), 5);
+
+    DeflateBlock* block;
+    ASSIGN_OR_RETURN_UNWRAP(&block, args.Holder());
+    Environment* env = block->env();
+    CHECK_EQ(false, block->work_in_progress_ && "compress in progress");
+
+    CHECK(Buffer::HasInstance(args[0]));
+    block->in_ = reinterpret_cast<Bytef*>(Buffer::Data(args[0]));
+    block->in_len_ = Buffer::Length(args[0]);
+
+    if (Buffer::HasInstance(args[1])) {
+      block->dictionary_ = reinterpret_cast<Bytef*>(Buffer::Data(args[1]));
+      block->dictionary_len_ = Buffer::Length(args[1]);
+    } else {
+      block->dictionary_ = nullptr;
+      block->dictionary_len_ = 0;
+    }
+
+    block->flush_ = args[2]->Int32Value(env->context()).FromMaybe(0);
+    CHECK(block->flush_ == Z_SYNC_FLUSH || block->flush_ == Z_FINISH);
+
+    int level = args[3]->Int32Value(env->context()).FromMaybe(0);
+    CHECK((level >= Z_MIN_LEVEL && level <= Z_MAX_LEVEL) &&
+      "invalid compression level");
+    int strategy = args[4]->Int32Value(env->context()).FromMaybe(0);
+    CHECK((strategy == Z_FILTERED ||
+           strategy == Z_HUFFMAN_ONLY ||
+           strategy == Z_RLE ||
+           strategy == Z_FIXED ||
+           strategy == Z_DEFAULT_STRATEGY) && "invalid strategy");
+
+    // The stream is set up again when params() changed the level or the
+    // strategy, which is rare enough not to bother with deflateParams().
+    if (block->init_done_ &&
+        (level != block->level_ || strategy != block->strategy_)) {
+      block->Close();
+    }
+    block->err_ = Z_OK;
+    if (!block->init_done_) {
+      block->level_ = level;
+      block->strategy_ = strategy;
+      block->strm_.zalloc = Z_NULL;
+      block->strm_.zfree = Z_NULL;
+      block->strm_.opaque = Z_NULL;
+      block->err_ = deflateInit2(&block->strm_, level, Z_DEFLATED,
+                                 -block->windowBits_, block->memLevel_,
+                                 strategy);
+      block->init_done_ = block->err_ == Z_OK;
+    }
+
+    if (!async) {
+      env->PrintSyncTrace();
+      block->DoThreadPoolWork();
+      block->Done();
+      return;
+    }
+
+    block->work_in_progress_ = true;
+    block->ClearWeak();
+    block->ScheduleWork();
+  }
+
+  static void Close(const FunctionCallbackInfo<Value>& args) {
+    DeflateBlock* block;
+    ASSIGN_OR_RETURN_UNWRAP(&block, args.Holder());
+    if (block->work_in_progress_)
+      block->pending_close_ = true;
+    else
+      block->Close();
+  }
+
+  void DoThreadPoolWork() override {
+    crc_ = crc32(0, in_, in_len_);
+    out_len_ = 0;
+    if (err_ != Z_OK)
+      return;
+
+    err_ = deflateReset(&strm_);
+    if (err_ == Z_OK && dictionary_ != nullptr)
+      err_ = deflateSetDictionary(&strm_, dictionary_, dictionary_len_);
+    if (err_ != Z_OK)
+      return;
+
+    // deflateBound() does not account for sync flushes, so leave some room
+    // and grow the buffer if that turns out not to be enough.
+    size_t capacity = deflateBound(&strm_, in_len_) + 16;
+    strm_.next_in = in_;
+    strm_.avail_in = in_len_;
+    do {
+      char* out = static_cast<char*>(realloc(out_, capacity));
+      if (out == nullptr) {
+        err_ = Z_MEM_ERROR;
+        return;
+      }
+      out_ = out;
+      strm_.next_out = reinterpret_cast<Bytef*>(out_ + out_len_);
+      strm_.avail_out = capacity - out_len_;
+      err_ = deflate(&strm_, flush_);
+      out_len_ = capacity - strm_.avail_out;
+      capacity *= 2;
+    } while (err_ == Z_OK && strm_.avail_out == 0);
+
+    if (err_ == Z_STREAM_END || err_ == Z_BUF_ERROR)
+      err_ = Z_OK;
+  }
+
+  void AfterThreadPoolWork(int status) override {
+    work_in_progress_ = false;
+    MakeWeak();
+
+    if (status == UV_ECANCELED) {
+      Close();
+      return;
+    }
+
+    CHECK_EQ(status, 0);
+
+    HandleScope handle_scope(env()->isolate());
+    Context::Scope context_scope(env()->context());
+    Done();
+
+    if (pending_close_)
+      Close();
+  }
+
+  size_t self_size() const override { return sizeof(*this); }
+
+ private:
+  void Close() {
+    free(out_);
+    out_ = nullptr;
+    if (!init_done_)
+      return;
+    deflateEnd(&strm_);
+    init_done_ = false;
+  }
+
+  void Done() {
+    Isolate* isolate = env()->isolate();
+    Local<Value> output = Undefined(isolate);
+    if (err_ == Z_OK) {
+      // The buffer takes over the memory of out_.
+      output = Buffer::New(isolate, out_, out_len_).ToLocalChecked();
+      out_ = nullptr;
+    }
+    in_ = nullptr;
+    dictionary_ = nullptr;
+
+    Local<Value> args[] = {
+      Integer::New(isolate, err_),
+      output,
+      Integer::NewFromUnsigned(isolate, crc_)
+    };
+    MakeCallback(env()->oncomplete_string(), arraysize(args), args);
+  }
+
+  z_stream strm_;
+  const int windowBits_;
+  const int memLevel_;
+  int level_ = 0;
+  int strategy_ = 0;
+  bool init_done_ = false;
+  bool work_in_progress_ = false;
+  bool pending_close_ = false;
+  int flush_ = Z_SYNC_FLUSH;
+  int err_ = Z_OK;
+  Bytef* in_ = nullptr;
+  size_t in_len_ = 0;
+  Bytef* dictionary_ = nullptr;
+  size_t dictionary_len_ = 0;
+  char* out_ = nullptr;
+  size_t out_len_ = 0;
+  uLong crc_ = 0;
+};
+
+
+// crc32Combine(crc1, crc2, len2) returns the CRC-32 of two concatenated
+// pieces of data, given their separate checksums and the second's length.
+void Crc32Combine(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args[0]->IsUint32());
+  CHECK(args[1]->IsUint32());
+  CHECK(args[2]->IsNumber());
+  uLong crc1 = args[0].As<Uint32>()->Value();
+  uLong crc2 = args[1].As<Uint32>()->Value();
+  z_off_t len2 = static_cast<z_off_t>(args[2].As<Number>()->Value());
+  args.GetReturnValue().Set(
+      static_cast<uint32_t>(crc32_combine(crc1, crc2, len2)));
+}
+
 
 void Initialize(Local<Object> target,
                 Local<Value> unused,
@@ -747,18 +1282,46 @@ void Initialize(Local<Object> target,
 
   z->InstanceTemplate()->SetInternalFieldCount(1);
 
-  AsyncWrap::AddWrapMethods(env, z);
+  AsyncWrap::AddWrapMethods(env, z, AsyncWrap::kFlagHasReset);
   env->SetProtoMethod(z, "write", ZCtx::Write<true>);
   env->SetProtoMethod(z, "writeSync", ZCtx::Write<false>);
   env->SetProtoMethod(z, "init", ZCtx::Init);
   env->SetProtoMethod(z, "close", ZCtx::Close);
   env->SetProtoMethod(z, "params", ZCtx::Params);
   env->SetProtoMethod(z, "reset", ZCtx::Reset);
+  env->SetProtoMethod(z, "free", ZCtx::Free);
 
   Local<String> zlibString = FIXED_ONE_BYTE_STRING(env->isolate(), "Zlib");
   z->SetClassName(zlibString);
   target->Set(zlibString, z->GetFunction());
 
+  Local<FunctionTemplate> d = env->NewFunctionTemplate(DeflateBlock::New);
+  d->InstanceTemplate()->SetInternalFieldCount(1);
+  AsyncWrap::AddWrapMethods(env, d);
+  env->SetProtoMethod(d, "compress", DeflateBlock::Compress<true>);
+  env->SetProtoMethod(d, "compressSync", DeflateBlock::Compress<false>);
+  env->SetProtoMethod(d, "close", DeflateBlock::Close);
+  Local<String> deflateBlockString =
+      FIXED_ONE_BYTE_STRING(env->isolate(), "DeflateBlock");
+  d->SetClassName(deflateBlockString);
+  target->Set(deflateBlockString, d->GetFunction());
+
+  env->SetMethod(target, "crc32Combine", Crc32Combine);
+
+#if HAVE_BROTLI
+  Local<FunctionTemplate> b = env->NewFunctionTemplate(BrotliCtx::New);
+  b->InstanceTemplate()->SetInternalFieldCount(1);
+  AsyncWrap::AddWrapMethods(env, b);
+  env->SetProtoMethod(b, "write", BrotliCtx::Write<true>);
+  env->SetProtoMethod(b, "writeSync", BrotliCtx::Write<false>);
+  env->SetProtoMethod(b, "init", BrotliCtx::Init);
+  env->SetProtoMethod(b, "close", BrotliCtx::Close);
+  env->SetProtoMethod(b, "reset", BrotliCtx::Reset);
+  Local<String> brotliString = FIXED_ONE_BYTE_STRING(env->isolate(), "Brotli");
+  b->SetClassName(brotliString);
+  target->Set(brotliString, b->GetFunction());
+#endif  // HAVE_BROTLI
+
   target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "ZLIB_VERSION"),
               FIXED_ONE_BYTE_STRING(env->isolate(), ZLIB_VERSION));
 }
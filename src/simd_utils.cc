@@ -0,0 +1,431 @@
+#include "simd_utils.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define NODE_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace node {
+namespace simd {
+
+namespace {
+
+// Scalar UTF-8 validation, following Table 3-7 of the Unicode Standard.
+bool ValidateUtf8Slow(const uint8_t* src, size_t len) {
+  size_t i = 0;
+  while (i < len) {
+    const uint8_t c = src[i];
+    if (c < 0x80) {
+      i += 1;
+      continue;
+    }
+    size_t n;
+    uint8_t lo = 0x80;
+    uint8_t hi = 0xBF;
+    if (c >= 0xC2 && c <= 0xDF) {
+      n = 1;
+    } else if (c >= 0xE0 && c <= 0xEF) {
+      n = 2;
+      if (c == 0xE0) lo = 0xA0;  // Overlong.
+      if (c == 0xED) hi = 0x9F;  // Surrogate.
+    } else if (c >= 0xF0 && c <= 0xF4) {
+      n = 3;
+      if (c == 0xF0) lo = 0x90;  // Overlong.
+      if (c == 0xF4) hi = 0x8F;  // Above U+10FFFF.
+    } else {
+      return false;
+    }
+    if (len - i <= n)
+      return false;  // Truncated.
+    if (src[i + 1] < lo || src[i + 1] > hi)
+      return false;
+    for (size_t j = 2; j <= n; j += 1) {
+      if ((src[i + j] & 0xC0) != 0x80)
+        return false;
+    }
+    i += n + 1;
+  }
+  return true;
+}
+
+#if defined(NODE_SIMD_X86)
+
+Level DetectLevel() {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    return Level::kAVX2;
+  if (__builtin_cpu_supports("ssse3"))
+    return Level::kSSSE3;
+  return Level::kNone;
+}
+
+__attribute__((target("ssse3")))
+size_t AsciiPrefixLengthSSSE3(const char* src, size_t len) {
+  size_t i = 0;
+  while (i + 64 <= len) {
+    const __m128i* p = reinterpret_cast<const __m128i*>(src + i);
+    const __m128i v = _mm_or_si128(
+        _mm_or_si128(_mm_loadu_si128(p + 0), _mm_loadu_si128(p + 1)),
+        _mm_or_si128(_mm_loadu_si128(p + 2), _mm_loadu_si128(p + 3)));
+    if (_mm_movemask_epi8(v) != 0)
+      break;
+    i += 64;
+  }
+  while (i + 16 <= len) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    if (_mm_movemask_epi8(v) != 0)
+      break;
+    i += 16;
+  }
+  return i;
+}
+
+__attribute__((target("avx2")))
+size_t AsciiPrefixLengthAVX2(const char* src, size_t len) {
+  size_t i = 0;
+  while (i + 128 <= len) {
+    const __m256i* p = reinterpret_cast<const __m256i*>(src + i);
+    const __m256i v = _mm256_or_si256(
+        _mm256_or_si256(_mm256_loadu_si256(p + 0), _mm256_loadu_si256(p + 1)),
+        _mm256_or_si256(_mm256_loadu_si256(p + 2), _mm256_loadu_si256(p + 3)));
+    if (_mm256_movemask_epi8(v) != 0)
+      break;
+    i += 128;
+  }
+  return i + AsciiPrefixLengthSSSE3(src + i, len - i);
+}
+
+__attribute__((target("ssse3")))
+size_t ForceAsciiPrefixSSSE3(const char* src, char* dst, size_t len) {
+  const __m128i mask = _mm_set1_epi8(0x7F);
+  size_t i = 0;
+  while (i + 16 <= len) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     _mm_and_si128(v, mask));
+    i += 16;
+  }
+  return i;
+}
+
+__attribute__((target("avx2")))
+size_t ForceAsciiPrefixAVX2(const char* src, char* dst, size_t len) {
+  const __m256i mask = _mm256_set1_epi8(0x7F);
+  size_t i = 0;
+  while (i + 32 <= len) {
+    const __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                        _mm256_and_si256(v, mask));
+    i += 32;
+  }
+  return i + ForceAsciiPrefixSSSE3(src + i, dst + i, len - i);
+}
+
+// Splits every byte into its two nibbles and translates them with pshufb.
+__attribute__((target("ssse3")))
+size_t HexEncodePrefixSSSE3(const char* src, size_t slen, char* dst) {
+  const __m128i digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                       '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+  size_t i = 0;
+  while (i + 16 <= slen) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i hi = _mm_shuffle_epi8(
+        digits, _mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+    const __m128i lo = _mm_shuffle_epi8(digits, _mm_and_si128(v, nibble));
+    __m128i* out = reinterpret_cast<__m128i*>(dst + 2 * i);
+    _mm_storeu_si128(out + 0, _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128(out + 1, _mm_unpackhi_epi8(hi, lo));
+    i += 16;
+  }
+  return i;
+}
+
+__attribute__((target("avx2")))
+size_t HexEncodePrefixAVX2(const char* src, size_t slen, char* dst) {
+  const __m256i digits = _mm256_setr_epi8(
+      '0', '1', '2', '3', '4', '5', '6', '7',
+      '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+      '0', '1', '2', '3', '4', '5', '6', '7',
+      '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  size_t i = 0;
+  while (i + 32 <= slen) {
+    const __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    const __m256i hi = _mm256_shuffle_epi8(
+        digits, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+    const __m256i lo = _mm256_shuffle_epi8(digits, _mm256_and_si256(v, nibble));
+    // The unpack instructions work within 128-bit lanes, put the lanes
+    // back in order before storing.
+    const __m256i a = _mm256_unpacklo_epi8(hi, lo);
+    const __m256i b = _mm256_unpackhi_epi8(hi, lo);
+    __m256i* out = reinterpret_cast<__m256i*>(dst + 2 * i);
+    _mm256_storeu_si256(out + 0, _mm256_permute2x128_si256(a, b, 0x20));
+    _mm256_storeu_si256(out + 1, _mm256_permute2x128_si256(a, b, 0x31));
+    i += 32;
+  }
+  return i + HexEncodePrefixSSSE3(src + i, slen - i, dst + 2 * i);
+}
+
+// Maps hex digits to their values.  Returns false if `*v` contains any other
+// character.
+__attribute__((target("ssse3")))
+inline bool UnhexLanes128(__m128i* v) {
+  const __m128i c = *v;
+  const __m128i digit =
+      _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)),
+                    _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), c));
+  const __m128i lower = _mm_or_si128(c, _mm_set1_epi8(0x20));
+  const __m128i alpha =
+      _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                    _mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), lower));
+  if (_mm_movemask_epi8(_mm_or_si128(digit, alpha)) != 0xFFFF)
+    return false;
+  *v = _mm_or_si128(
+      _mm_and_si128(digit, _mm_sub_epi8(c, _mm_set1_epi8('0'))),
+      _mm_and_si128(alpha, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+  return true;
+}
+
+__attribute__((target("ssse3")))
+size_t HexDecodePrefixSSSE3(char* dst, size_t dstlen,
+                            const char* src, size_t srclen) {
+  // Multiply the first nibble of every pair by 16 and add the second one.
+  const __m128i weights = _mm_set1_epi16(0x0110);
+  size_t k = 0;
+  while (k + 16 <= dstlen && 2 * k + 32 <= srclen) {
+    const __m128i* p = reinterpret_cast<const __m128i*>(src + 2 * k);
+    __m128i a = _mm_loadu_si128(p + 0);
+    __m128i b = _mm_loadu_si128(p + 1);
+    if (!UnhexLanes128(&a) || !UnhexLanes128(&b))
+      break;
+    a = _mm_maddubs_epi16(a, weights);
+    b = _mm_maddubs_epi16(b, weights);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + k),
+                     _mm_packus_epi16(a, b));
+    k += 16;
+  }
+  return k;
+}
+
+// Lookup-table based validation after John Keiser and Daniel Lemire,
+// "Validating UTF-8 In Less Than One Instruction Per Byte".  Every byte is
+// classified together with the byte before it using three 16-entry tables;
+// the error bits only survive the AND if all three agree.
+const uint8_t kTooShort = 1 << 0;  // 11______ 0_______ or 11______ 11______
+const uint8_t kTooLong = 1 << 1;   // 0_______ 10______
+const uint8_t kOverlong3 = 1 << 2;  // 11100000 100_____
+const uint8_t kTooLarge = 1 << 3;  // 11110100 1001____ and above
+const uint8_t kSurrogate = 1 << 4;  // 11101101 101_____
+const uint8_t kOverlong2 = 1 << 5;  // 1100000_ 10______
+const uint8_t kTooLarge1000 = 1 << 6;  // 11110101 1000____ and above
+const uint8_t kOverlong4 = 1 << 6;  // 11110000 1000____
+const uint8_t kTwoConts = 1 << 7;  // 10______ 10______
+const uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+struct Utf8State {
+  __m128i error;
+  __m128i prev_input;
+  __m128i prev_incomplete;
+};
+
+#define TBL(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p)                  \
+  _mm_setr_epi8(static_cast<char>(a), static_cast<char>(b),                   \
+                static_cast<char>(c), static_cast<char>(d),                   \
+                static_cast<char>(e), static_cast<char>(f),                   \
+                static_cast<char>(g), static_cast<char>(h),                   \
+                static_cast<char>(i), static_cast<char>(j),                   \
+                static_cast<char>(k), static_cast<char>(l),                   \
+                static_cast<char>(m), static_cast<char>(n),                   \
+                static_cast<char>(o), static_cast<char>(p))
+
+__attribute__((target("ssse3")))
+inline void CheckUtf8Block(Utf8State* state, __m128i input) {
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+
+  // Only ASCII: nothing to check, but a sequence that started in the
+  // previous block is now definitely truncated.
+  if (_mm_movemask_epi8(input) == 0) {
+    state->error = _mm_or_si128(state->error, state->prev_incomplete);
+    return;
+  }
+
+  const __m128i prev1 = _mm_alignr_epi8(input, state->prev_input, 15);
+  const __m128i byte_1_high = _mm_shuffle_epi8(
+      TBL(kTooLong, kTooLong, kTooLong, kTooLong,
+          kTooLong, kTooLong, kTooLong, kTooLong,
+          kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+          kTooShort | kOverlong2,
+          kTooShort,
+          kTooShort | kOverlong3 | kSurrogate,
+          kTooShort | kTooLarge | kTooLarge1000 | kOverlong4),
+      _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+  const __m128i byte_1_low = _mm_shuffle_epi8(
+      TBL(kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+          kCarry | kOverlong2,
+          kCarry,
+          kCarry,
+          kCarry | kTooLarge,
+          kCarry | kTooLarge | kTooLarge1000,
+          kCarry | kTooLarge | kTooLarge1000,
+          kCarry | kTooLarge | kTooLarge1000,
+          kCarry | kTooLarge | kTooLarge1000,
+          kCarry | kTooLarge | kTooLarge1000,
+          kCarry | kTooLarge | kTooLarge1000,
+          kCarry | kTooLarge | kTooLarge1000,
+          kCarry | kTooLarge | kTooLarge1000,
+          kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+          kCarry | kTooLarge | kTooLarge1000,
+          kCarry | kTooLarge | kTooLarge1000),
+      _mm_and_si128(prev1, nibble));
+  const __m128i byte_2_high = _mm_shuffle_epi8(
+      TBL(kTooShort, kTooShort, kTooShort, kTooShort,
+          kTooShort, kTooShort, kTooShort, kTooShort,
+          kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 |
+              kOverlong4,
+          kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+          kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+          kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+          kTooShort, kTooShort, kTooShort, kTooShort),
+      _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+  const __m128i special_cases =
+      _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+  // The third and fourth bytes of a sequence must be continuations; the
+  // tables above only saw pairs of bytes.
+  const __m128i prev2 = _mm_alignr_epi8(input, state->prev_input, 14);
+  const __m128i prev3 = _mm_alignr_epi8(input, state->prev_input, 13);
+  const __m128i is_third_byte =
+      _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+  const __m128i is_fourth_byte =
+      _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+  const __m128i must23_80 =
+      _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte),
+                    _mm_set1_epi8(static_cast<char>(0x80)));
+  state->error = _mm_or_si128(state->error,
+                              _mm_xor_si128(must23_80, special_cases));
+
+  // Lead bytes in the last three positions that need more bytes than there
+  // are left in the block.
+  state->prev_incomplete = _mm_subs_epu8(input, TBL(
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1));
+  state->prev_input = input;
+}
+
+#undef TBL
+
+__attribute__((target("ssse3")))
+bool ValidateUtf8SSSE3(const char* src, size_t len) {
+  Utf8State state;
+  state.error = _mm_setzero_si128();
+  state.prev_input = _mm_setzero_si128();
+  state.prev_incomplete = _mm_setzero_si128();
+
+  size_t i = 0;
+  while (i + 16 <= len) {
+    CheckUtf8Block(&state,
+                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+    i += 16;
+  }
+  if (i < len) {
+    // Pad the tail with ASCII; a truncated sequence at the end of the input
+    // then shows up as an error.
+    char tail[16] = { 0 };
+    memcpy(tail, src + i, len - i);
+    CheckUtf8Block(&state,
+                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(tail)));
+  }
+  state.error = _mm_or_si128(state.error, state.prev_incomplete);
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(state.error,
+                                          _mm_setzero_si128())) == 0xFFFF;
+}
+
+#else  // !defined(NODE_SIMD_X86)
+
+Level DetectLevel() {
+  return Level::kNone;
+}
+
+#endif  // defined(NODE_SIMD_X86)
+
+}  // anonymous namespace
+
+Level GetLevel() {
+  static const Level level = DetectLevel();
+  return level;
+}
+
+size_t AsciiPrefixLength(const char* src, size_t len) {
+#if defined(NODE_SIMD_X86)
+  switch (GetLevel()) {
+    case Level::kAVX2:
+      return AsciiPrefixLengthAVX2(src, len);
+    case Level::kSSSE3:
+      return AsciiPrefixLengthSSSE3(src, len);
+    default:
+      break;
+  }
+#endif
+  return 0;
+}
+
+size_t ForceAsciiPrefix(const char* src, char* dst, size_t len) {
+#if defined(NODE_SIMD_X86)
+  switch (GetLevel()) {
+    case Level::kAVX2:
+      return ForceAsciiPrefixAVX2(src, dst, len);
+    case Level::kSSSE3:
+      return ForceAsciiPrefixSSSE3(src, dst, len);
+    default:
+      break;
+  }
+#endif
+  return 0;
+}
+
+size_t HexEncodePrefix(const char* src, size_t slen, char* dst) {
+#if defined(NODE_SIMD_X86)
+  switch (GetLevel()) {
+    case Level::kAVX2:
+      return HexEncodePrefixAVX2(src, slen, dst);
+    case Level::kSSSE3:
+      return HexEncodePrefixSSSE3(src, slen, dst);
+    default:
+      break;
+  }
+#endif
+  return 0;
+}
+
+size_t HexDecodePrefix(char* dst, size_t dstlen,
+                       const char* src, size_t srclen) {
+#if defined(NODE_SIMD_X86)
+  if (GetLevel() != Level::kNone)
+    return HexDecodePrefixSSSE3(dst, dstlen, src, srclen);
+#endif
+  return 0;
+}
+
+bool ValidateUtf8(const char* src, size_t len) {
+  // Most text is mostly ASCII, skip over that as fast as possible first.
+  const size_t ascii = AsciiPrefixLength(src, len);
+  src += ascii;
+  len -= ascii;
+#if defined(NODE_SIMD_X86)
+  if (len >= 16 && GetLevel() != Level::kNone)
+    return ValidateUtf8SSSE3(src, len);
+#endif
+  return ValidateUtf8Slow(reinterpret_cast<const uint8_t*>(src), len);
+}
+
+}  // namespace simd
+}  // namespace node
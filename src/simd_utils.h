@@ -0,0 +1,53 @@
+#ifndef SRC_SIMD_UTILS_H_
+#define SRC_SIMD_UTILS_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include <stddef.h>
+
+namespace node {
+namespace simd {
+
+// Vectorized string primitives.  The kernels are compiled with per-function
+// target attributes and selected at runtime based on what the CPU supports,
+// so nothing here requires special compiler flags.  On other compilers and
+// architectures GetLevel() returns kNone and the prefix functions below
+// consume nothing.
+
+enum class Level { kNone, kSSSE3, kAVX2 };
+
+Level GetLevel();
+
+// The functions below process the longest prefix of the input that they can
+// handle efficiently and return its length.  The caller is expected to deal
+// with the remainder using scalar code.
+
+// Returns the length of a prefix of `src` that contains only ASCII bytes.
+// The byte after the prefix is not necessarily non-ASCII.
+size_t AsciiPrefixLength(const char* src, size_t len);
+
+// Copies a prefix of `src` to `dst` with the high bit of every byte cleared.
+size_t ForceAsciiPrefix(const char* src, char* dst, size_t len);
+
+// Encodes a prefix of `src` as lower-case hex.  Returns the number of input
+// bytes consumed; twice as many characters are written to `dst`.
+size_t HexEncodePrefix(const char* src, size_t slen, char* dst);
+
+// Decodes hex pairs from `src` until the input, the output buffer or the
+// run of valid characters ends.  Returns the number of bytes written to
+// `dst`; twice as many characters were consumed.
+size_t HexDecodePrefix(char* dst, size_t dstlen,
+                       const char* src, size_t srclen);
+
+// Unlike the functions above this one always processes the whole input.
+// Returns true if `src` is well-formed UTF-8 in the sense of the WHATWG
+// Encoding Standard: no overlong forms, no surrogates, nothing above
+// U+10FFFF and no truncated sequence at the end.
+bool ValidateUtf8(const char* src, size_t len);
+
+}  // namespace simd
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_SIMD_UTILS_H_
@@ -1,18 +1,30 @@
 #include "stream_pipe.h"
 #include "stream_base-inl.h"
+#include "stream_wrap.h"
 #include "node_buffer.h"
 #include "node_internals.h"
 
+#ifndef _WIN32
+#include <unistd.h>  // dup(), close()
+#endif
+
 using v8::Context;
 using v8::External;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
+using v8::HandleScope;
+using v8::Int32;
+using v8::Integer;
 using v8::Local;
+using v8::Number;
 using v8::Object;
 using v8::Value;
 
 namespace node {
 
+// How much to read at once for sinks that do not ask for a specific amount.
+static const size_t kDefaultWantedData = 65536;
+
 StreamPipe::StreamPipe(StreamBase* source,
                        StreamBase* sink,
                        Local<Object> obj)
@@ -25,7 +37,9 @@ StreamPipe::StreamPipe(StreamBase* source,
   source->PushStreamListener(&readable_listener_);
   sink->PushStreamListener(&writable_listener_);
 
-  CHECK(sink->HasWantsWrite());
+  uses_wants_write_ = sink->HasWantsWrite();
+  if (!uses_wants_write_)
+    wanted_data_ = kDefaultWantedData;
 
   // Set up links between this object and the source/sink objects.
   // In particular, this makes sure that they are garbage collected as a group,
@@ -43,6 +57,7 @@ StreamPipe::StreamPipe(StreamBase* source,
 
 StreamPipe::~StreamPipe() {
   CHECK(is_closed_);
+  free(pending_data_);
 }
 
 StreamBase* StreamPipe::source() {
@@ -77,7 +92,12 @@ void StreamPipe::Unpipe() {
     Local<Object> object = pipe->object();
 
     if (object->Has(env->context(), env->onunpipe_string()).FromJust()) {
-      pipe->MakeCallback(env->onunpipe_string(), 0, nullptr).ToLocalChecked();
+      Local<Value> argv[] = {
+        Integer::New(env->isolate(), pipe->error_),
+        Number::New(env->isolate(), static_cast<double>(pipe->bytes_written_))
+      };
+      pipe->MakeCallback(env->onunpipe_string(), arraysize(argv), argv)
+          .ToLocalChecked();
     }
 
     // Set all the links established in the constructor to `null`.
@@ -105,7 +125,11 @@ void StreamPipe::Unpipe() {
 
 uv_buf_t StreamPipe::ReadableListener::OnStreamAlloc(size_t suggested_size) {
   StreamPipe* pipe = ContainerOf(&StreamPipe::readable_listener_, this);
-  size_t size = std::min(suggested_size, pipe->wanted_data_);
+  // Sources that do not stop reading right away may call this before the sink
+  // has asked for anything.
+  size_t size = suggested_size;
+  if (pipe->wanted_data_ > 0)
+    size = std::min(size, pipe->wanted_data_);
   CHECK_GT(size, 0);
   return uv_buf_init(Malloc(size), size);
 }
@@ -119,6 +143,8 @@ void StreamPipe::ReadableListener::OnStreamRead(ssize_t nread,
     // (which might end up in JS).
     free(buf.base);
     pipe->is_eof_ = true;
+    if (nread != UV_EOF && pipe->error_ == 0)
+      pipe->error_ = nread;
     stream()->ReadStop();
     CHECK_NOT_NULL(previous_listener_);
     previous_listener_->OnStreamRead(nread, uv_buf_init(nullptr, 0));
@@ -135,27 +161,79 @@ void StreamPipe::ReadableListener::OnStreamRead(ssize_t nread,
 }
 
 void StreamPipe::ProcessData(size_t nread, const uv_buf_t& buf) {
-  uv_buf_t buffer = uv_buf_init(buf.base, nread);
+  if (nread == 0) {
+    free(buf.base);
+    return;
+  }
+
+  // Sources such as TLSWrap and Http2Stream may still hand out data that they
+  // already have after ReadStop(), and sinks that use `OnStreamWantsWrite()`
+  // may ask for more before the current write has finished.
+  if (is_writing_) {
+    pending_data_ = Realloc(pending_data_, pending_length_ + nread);
+    memcpy(pending_data_ + pending_length_, buf.base, nread);
+    pending_length_ += nread;
+    free(buf.base);
+    if (is_reading_) {
+      is_reading_ = false;
+      source()->ReadStop();
+    }
+    return;
+  }
+
+  WriteData(buf.base, nread);
+}
+
+void StreamPipe::WriteData(char* data, size_t length) {
+  uv_buf_t buffer = uv_buf_init(data, length);
+  write_length_ = length;
   StreamWriteResult res = sink()->Write(&buffer, 1);
   if (!res.async) {
-    free(buf.base);
-    writable_listener_.OnStreamAfterWrite(nullptr, res.err);
+    free(data);
+    if (res.err != 0) {
+      // There is no WriteWrap that the sink's previous listener could be told
+      // about, so only stop piping.
+      if (error_ == 0)
+        error_ = res.err;
+      if (is_reading_)
+        source()->ReadStop();
+      Unpipe();
+      return;
+    }
+    writable_listener_.OnStreamAfterWrite(nullptr, 0);
   } else {
     is_writing_ = true;
     is_reading_ = false;
-    res.wrap->SetAllocatedStorage(buf.base, buf.len);
+    res.wrap->SetAllocatedStorage(data, length);
     source()->ReadStop();
   }
 }
 
 void StreamPipe::ShutdownWritable() {
-  sink()->Shutdown();
+  if (end_sink_)
+    sink()->Shutdown();
 }
 
 void StreamPipe::WritableListener::OnStreamAfterWrite(WriteWrap* w,
                                                       int status) {
   StreamPipe* pipe = ContainerOf(&StreamPipe::writable_listener_, this);
   pipe->is_writing_ = false;
+  if (status == 0) {
+    pipe->bytes_written_ += pipe->write_length_;
+  } else if (pipe->error_ == 0) {
+    pipe->error_ = status;
+  }
+
+  if (status == 0 && pipe->pending_length_ > 0) {
+    char* data = pipe->pending_data_;
+    size_t length = pipe->pending_length_;
+    pipe->pending_data_ = nullptr;
+    pipe->pending_length_ = 0;
+    AsyncScope async_scope(pipe);
+    pipe->WriteData(data, length);
+    return;
+  }
+
   if (pipe->is_eof_) {
     AsyncScope async_scope(pipe);
     pipe->ShutdownWritable();
@@ -170,6 +248,11 @@ void StreamPipe::WritableListener::OnStreamAfterWrite(WriteWrap* w,
     prev->OnStreamAfterWrite(w, status);
     return;
   }
+
+  // Without `OnStreamWantsWrite()`, the end of a write is what tells us that
+  // the sink is ready for more.
+  if (!pipe->uses_wants_write_)
+    pipe->writable_listener_.OnStreamWantsWrite(pipe->wanted_data_);
 }
 
 void StreamPipe::WritableListener::OnStreamAfterShutdown(ShutdownWrap* w,
@@ -190,6 +273,8 @@ void StreamPipe::ReadableListener::OnStreamDestroy() {
 
 void StreamPipe::WritableListener::OnStreamDestroy() {
   StreamPipe* pipe = ContainerOf(&StreamPipe::writable_listener_, this);
+  if (!pipe->is_eof_ && pipe->error_ == 0)
+    pipe->error_ = UV_ECANCELED;
   pipe->is_eof_ = true;
   pipe->Unpipe();
 }
@@ -225,9 +310,12 @@ void StreamPipe::New(const FunctionCallbackInfo<Value>& args) {
   new StreamPipe(source, sink, args.This());
 }
 
+// start([endSink]); the sink is shut down once the source has ended unless
+// `endSink` is false.
 void StreamPipe::Start(const FunctionCallbackInfo<Value>& args) {
   StreamPipe* pipe;
   ASSIGN_OR_RETURN_UNWRAP(&pipe, args.Holder());
+  pipe->end_sink_ = !args[0]->IsFalse();
   pipe->is_closed_ = false;
   if (pipe->wanted_data_ > 0)
     pipe->writable_listener_.OnStreamWantsWrite(pipe->wanted_data_);
@@ -236,9 +324,236 @@ void StreamPipe::Start(const FunctionCallbackInfo<Value>& args) {
 void StreamPipe::Unpipe(const FunctionCallbackInfo<Value>& args) {
   StreamPipe* pipe;
   ASSIGN_OR_RETURN_UNWRAP(&pipe, args.Holder());
+  if (pipe->is_closed_)
+    return;
+  if (!pipe->is_eof_ && pipe->error_ == 0)
+    pipe->error_ = UV_ECANCELED;
+  if (pipe->is_reading_)
+    pipe->source()->ReadStop();
   pipe->Unpipe();
 }
 
+#ifndef _WIN32
+// Upper bound for a single sendfile() call. A non-blocking socket only takes
+// as much as fits into its send buffer anyway, this just keeps a single
+// threadpool request from reading ahead too far on other kinds of sinks.
+static const size_t kSendfileChunkSize = 4 * 1024 * 1024;
+
+SendfilePipe::SendfilePipe(Environment* env,
+                           Local<Object> obj,
+                           LibuvStreamWrap* sink,
+                           int in_fd,
+                           int out_fd)
+    : AsyncWrap(env, obj, AsyncWrap::PROVIDER_SENDFILEPIPE),
+      stream_(sink->stream()),
+      in_fd_(in_fd),
+      out_fd_(out_fd) {
+  // The pipe object itself stays strong until the transfer has finished (see
+  // Finish()) and keeps the sink's JS object alive along with it.
+  obj->Set(env->context(), env->sink_string(), sink->object()).FromJust();
+}
+
+SendfilePipe::~SendfilePipe() {
+  CHECK(!active_);
+  CloseFds();
+}
+
+void SendfilePipe::CloseFds() {
+  if (in_fd_ != -1)
+    close(in_fd_);
+  if (out_fd_ != -1)
+    close(out_fd_);
+  in_fd_ = -1;
+  out_fd_ = -1;
+}
+
+int SendfilePipe::Flush() {
+  // A zero-length write completes once everything that was queued before it
+  // has been handed to the kernel, which makes it a cheap ordering barrier.
+  if (uv_stream_get_write_queue_size(stream_) == 0) {
+    SendChunk();
+    return 0;
+  }
+  uv_buf_t buf = uv_buf_init(nullptr, 0);
+  return uv_write(&write_req_, stream_, &buf, 1, AfterFlush);
+}
+
+void SendfilePipe::AfterFlush(uv_write_t* req, int status) {
+  SendfilePipe* pipe = ContainerOf(&SendfilePipe::write_req_, req);
+  if (status < 0)
+    return pipe->Finish(status);
+  if (pipe->stopping_)
+    return pipe->Finish(UV_ECANCELED);
+  pipe->SendChunk();
+}
+
+void SendfilePipe::SendChunk() {
+  // The stream itself is only needed for Flush(); the handle may go away
+  // while the transfer is running, the dup()ed fd keeps the socket alive.
+  stream_ = nullptr;
+
+  size_t len = kSendfileChunkSize;
+  if (remaining_ >= 0 && static_cast<uint64_t>(remaining_) < len)
+    len = static_cast<size_t>(remaining_);
+  if (len == 0)
+    return Finish(0);
+
+  int err = uv_fs_sendfile(env()->event_loop(),
+                           &fs_req_,
+                           out_fd_,
+                           in_fd_,
+                           offset_,
+                           len,
+                           AfterSendfile);
+  if (err < 0)
+    return Finish(err);
+  sendfile_pending_ = true;
+}
+
+void SendfilePipe::AfterSendfile(uv_fs_t* req) {
+  SendfilePipe* pipe = ContainerOf(&SendfilePipe::fs_req_, req);
+  const ssize_t result = req->result;
+  uv_fs_req_cleanup(req);
+  pipe->sendfile_pending_ = false;
+
+  if (result > 0) {
+    pipe->offset_ += result;
+    pipe->bytes_sent_ += result;
+    if (pipe->remaining_ >= 0)
+      pipe->remaining_ -= result;
+  }
+
+  if (pipe->stopping_)
+    return pipe->Finish(UV_ECANCELED);
+  if (result == UV_EAGAIN)
+    return pipe->WaitWritable();
+  if (result < 0)
+    return pipe->Finish(result);
+  if (result == 0)
+    return pipe->Finish(0);  // End of file.
+  pipe->SendChunk();
+}
+
+void SendfilePipe::WaitWritable() {
+  if (!poll_initialized_) {
+    int err = uv_poll_init(env()->event_loop(), &poll_, out_fd_);
+    if (err < 0)
+      return Finish(err);
+    poll_initialized_ = true;
+  }
+  int err = uv_poll_start(&poll_, UV_WRITABLE, OnWritable);
+  if (err < 0)
+    return Finish(err);
+}
+
+void SendfilePipe::OnWritable(uv_poll_t* handle, int status, int events) {
+  SendfilePipe* pipe = ContainerOf(&SendfilePipe::poll_, handle);
+  uv_poll_stop(handle);
+  if (status < 0)
+    return pipe->Finish(status);
+  pipe->SendChunk();
+}
+
+void SendfilePipe::Finish(int status) {
+  CHECK(active_);
+  active_ = false;
+
+  if (poll_initialized_) {
+    // The fds are closed once the poll handle no longer references them.
+    uv_close(reinterpret_cast<uv_handle_t*>(&poll_), OnPollClose);
+  } else {
+    CloseFds();
+    MakeWeak();
+  }
+
+  HandleScope handle_scope(env()->isolate());
+  Context::Scope context_scope(env()->context());
+  Local<Value> argv[] = {
+    Integer::New(env()->isolate(), status),
+    Number::New(env()->isolate(), static_cast<double>(bytes_sent_))
+  };
+  MakeCallback(env()->oncomplete_string(), arraysize(argv), argv);
+}
+
+void SendfilePipe::OnPollClose(uv_handle_t* handle) {
+  SendfilePipe* pipe = ContainerOf(&SendfilePipe::poll_,
+                                   reinterpret_cast<uv_poll_t*>(handle));
+  pipe->CloseFds();
+  pipe->MakeWeak();
+}
+
+void SendfilePipe::New(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args.IsConstructCall());
+  CHECK(args[0]->IsInt32());
+  CHECK(args[1]->IsObject());
+  Local<Object> sink_obj = args[1].As<Object>();
+  CHECK(env->tcp_constructor_template()->HasInstance(sink_obj) ||
+        env->pipe_constructor_template()->HasInstance(sink_obj));
+  LibuvStreamWrap* sink;
+  ASSIGN_OR_RETURN_UNWRAP(&sink, sink_obj);
+
+  uv_os_fd_t sink_fd;
+  int err = uv_fileno(reinterpret_cast<uv_handle_t*>(sink->stream()),
+                      &sink_fd);
+  int in_fd = -1;
+  int out_fd = -1;
+  if (err == 0) {
+    in_fd = dup(args[0].As<Int32>()->Value());
+    out_fd = dup(sink_fd);
+    if (in_fd == -1 || out_fd == -1)
+      err = -errno;
+  }
+
+  // Errors are reported from start().
+  SendfilePipe* pipe = new SendfilePipe(env, args.This(), sink, in_fd, out_fd);
+  pipe->init_error_ = err;
+}
+
+void SendfilePipe::Start(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  SendfilePipe* pipe;
+  ASSIGN_OR_RETURN_UNWRAP(&pipe, args.Holder());
+  CHECK(!pipe->active_);
+  CHECK(args[0]->IsNumber());
+  CHECK(args[1]->IsNumber());
+
+  int err = pipe->init_error_;
+  if (err == 0) {
+    pipe->offset_ = args[0]->IntegerValue(env->context()).FromJust();
+    pipe->remaining_ = args[1]->IntegerValue(env->context()).FromJust();
+    if (pipe->remaining_ < 0)
+      pipe->remaining_ = -1;
+    pipe->active_ = true;
+    err = pipe->Flush();
+    if (err < 0)
+      pipe->active_ = false;
+  }
+  if (err < 0) {
+    pipe->CloseFds();
+    pipe->MakeWeak();
+  }
+  args.GetReturnValue().Set(err);
+}
+
+void SendfilePipe::Stop(const FunctionCallbackInfo<Value>& args) {
+  SendfilePipe* pipe;
+  ASSIGN_OR_RETURN_UNWRAP(&pipe, args.Holder());
+  if (!pipe->active_ || pipe->stopping_)
+    return;
+  pipe->stopping_ = true;
+  if (pipe->sendfile_pending_) {
+    // Finish() runs from AfterSendfile(), whether or not this succeeds.
+    uv_cancel(reinterpret_cast<uv_req_t*>(&pipe->fs_req_));
+  } else if (pipe->poll_initialized_ &&
+             uv_is_active(reinterpret_cast<uv_handle_t*>(&pipe->poll_))) {
+    uv_poll_stop(&pipe->poll_);
+    pipe->Finish(UV_ECANCELED);
+  }
+  // Otherwise the flush is still pending and AfterFlush() takes care of it.
+}
+#endif  // _WIN32
+
 namespace {
 
 void InitializeStreamPipe(Local<Object> target,
@@ -256,6 +571,21 @@ void InitializeStreamPipe(Local<Object> target,
   pipe->SetClassName(stream_pipe_string);
   pipe->InstanceTemplate()->SetInternalFieldCount(1);
   target->Set(context, stream_pipe_string, pipe->GetFunction()).FromJust();
+
+#ifndef _WIN32
+  Local<FunctionTemplate> sendfile_pipe =
+      env->NewFunctionTemplate(SendfilePipe::New);
+  Local<String> sendfile_pipe_string =
+      FIXED_ONE_BYTE_STRING(env->isolate(), "SendfilePipe");
+  env->SetProtoMethod(sendfile_pipe, "start", SendfilePipe::Start);
+  env->SetProtoMethod(sendfile_pipe, "stop", SendfilePipe::Stop);
+  AsyncWrap::AddWrapMethods(env, sendfile_pipe);
+  sendfile_pipe->SetClassName(sendfile_pipe_string);
+  sendfile_pipe->InstanceTemplate()->SetInternalFieldCount(1);
+  target->Set(context,
+              sendfile_pipe_string,
+              sendfile_pipe->GetFunction()).FromJust();
+#endif  // _WIN32
 }
 
 }  // anonymous namespace
@@ -7,6 +7,13 @@
 
 namespace node {
 
+// Moves data from one StreamBase to another without involving JS, e.g. from a
+// FileHandle or a TLS socket into an Http2Stream or a TLS socket.
+//
+// Sinks that support `OnStreamWantsWrite()` (Http2Streams) ask for data when
+// they are ready for it. For other sinks, reading resumes once the previous
+// write has finished. Only one write is in progress at a time; data that the
+// source hands out after it was told to stop reading is held back until then.
 class StreamPipe : public AsyncWrap {
  public:
   StreamPipe(StreamBase* source, StreamBase* sink, v8::Local<v8::Object> obj);
@@ -31,14 +38,25 @@ class StreamPipe : public AsyncWrap {
   bool is_writing_ = false;
   bool is_eof_ = false;
   bool is_closed_ = true;
+  bool uses_wants_write_ = false;
+  // Whether the sink is shut down once the source has ended.
+  bool end_sink_ = true;
 
-  // Set a default value so that when we’re coming from Start(), we know
-  // that we don’t want to read just yet.
-  // This will likely need to be changed when supporting streams without
-  // `OnStreamWantsWrite()` support.
+  // For sinks that use `OnStreamWantsWrite()`, this is 0 until they ask for
+  // data, so that Start() does not read just yet.
   size_t wanted_data_ = 0;
 
+  // Data that was read while a write was in progress.
+  char* pending_data_ = nullptr;
+  size_t pending_length_ = 0;
+  size_t write_length_ = 0;
+  uint64_t bytes_written_ = 0;
+  // The first error that ended the pipe, if any.
+  int error_ = 0;
+
   void ProcessData(size_t nread, const uv_buf_t& buf);
+  // Takes ownership of `data`, which must have been allocated with Malloc().
+  void WriteData(char* data, size_t length);
 
   class ReadableListener : public StreamListener {
    public:
@@ -61,6 +79,64 @@ class StreamPipe : public AsyncWrap {
   WritableListener writable_listener_;
 };
 
+#ifndef _WIN32
+class LibuvStreamWrap;
+
+// Copies a range of a file straight into a TCP or pipe handle using
+// uv_fs_sendfile(), i.e. sendfile(2) on Linux and the BSDs, so that the data
+// never passes through JS or even userland.  The sendfile calls run on the
+// threadpool; when the socket buffer is full, the pipe waits for the socket to
+// become writable again with a uv_poll_t.
+//
+// Both file descriptors are dup()ed, so that closing either side from JS while
+// a request is in flight cannot redirect the transfer to a reused fd.
+class SendfilePipe : public AsyncWrap {
+ public:
+  SendfilePipe(Environment* env,
+               v8::Local<v8::Object> obj,
+               LibuvStreamWrap* sink,
+               int in_fd,
+               int out_fd);
+  ~SendfilePipe();
+
+  static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
+  // start(offset, length); a negative length means "until end of file".
+  static void Start(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Stop(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+  size_t self_size() const override { return sizeof(*this); }
+
+ private:
+  // Wait for data that was queued on the stream before the pipe was started.
+  int Flush();
+  void SendChunk();
+  void WaitWritable();
+  void Finish(int status);
+  void CloseFds();
+
+  static void AfterFlush(uv_write_t* req, int status);
+  static void AfterSendfile(uv_fs_t* req);
+  static void OnWritable(uv_poll_t* handle, int status, int events);
+  static void OnPollClose(uv_handle_t* handle);
+
+  uv_stream_t* stream_;
+  int in_fd_;
+  int out_fd_;
+  int64_t offset_ = 0;
+  int64_t remaining_ = -1;
+  int64_t bytes_sent_ = 0;
+  bool active_ = false;
+  bool stopping_ = false;
+  bool sendfile_pending_ = false;
+  bool poll_initialized_ = false;
+  int init_error_ = 0;
+
+  uv_write_t write_req_;
+  uv_fs_t fs_req_;
+  uv_poll_t poll_;
+};
+#endif  // _WIN32
+
 }  // namespace node
 
 #endif
@@ -25,6 +25,7 @@
 #include "node_internals.h"
 #include "node_errors.h"
 #include "node_buffer.h"
+#include "simd_utils.h"
 
 #include <limits.h>
 #include <string.h>  // memcpy
@@ -240,13 +241,31 @@ static inline unsigned unhex(uint8_t x) {
   return unhex_table[x];
 }
 
+// Only one-byte input can be fed to the vectorized decoder as-is.
+template <typename TypeName>
+static inline size_t hex_decode_vector(char* buf,
+                                       size_t len,
+                                       const TypeName* src,
+                                       const size_t srcLen) {
+  return 0;
+}
+
+static inline size_t hex_decode_vector(char* buf,
+                                       size_t len,
+                                       const char* src,
+                                       const size_t srcLen) {
+  return simd::HexDecodePrefix(buf, len, src, srcLen);
+}
+
 template <typename TypeName>
 static size_t hex_decode(char* buf,
                          size_t len,
                          const TypeName* src,
                          const size_t srcLen) {
   size_t i;
-  for (i = 0; i < len && i * 2 + 1 < srcLen; ++i) {
+  for (i = hex_decode_vector(buf, len, src, srcLen);
+       i < len && i * 2 + 1 < srcLen;
+       ++i) {
     unsigned a = unhex(src[i * 2 + 0]);
     unsigned b = unhex(src[i * 2 + 1]);
     if (!~a || !~b)
@@ -355,6 +374,15 @@ size_t StringBytes::Write(Isolate* isolate,
       if (str->IsExternalOneByte()) {
         auto ext = str->GetExternalOneByteStringResource();
         nbytes = base64_decode(buf, buflen, ext->data(), ext->length());
+      } else if (str->IsOneByte()) {
+        // Flatten to one-byte data so that the vectorized decoder can be used.
+        MaybeStackBuffer<char> value(str->Length());
+        str->WriteOneByte(isolate,
+                          reinterpret_cast<uint8_t*>(*value),
+                          0,
+                          value.length(),
+                          flags);
+        nbytes = base64_decode(buf, buflen, *value, value.length());
       } else {
         String::Value value(isolate, str);
         nbytes = base64_decode(buf, buflen, *value, value.length());
@@ -366,6 +394,14 @@ size_t StringBytes::Write(Isolate* isolate,
       if (str->IsExternalOneByte()) {
         auto ext = str->GetExternalOneByteStringResource();
         nbytes = hex_decode(buf, buflen, ext->data(), ext->length());
+      } else if (str->IsOneByte()) {
+        MaybeStackBuffer<char> value(str->Length());
+        str->WriteOneByte(isolate,
+                          reinterpret_cast<uint8_t*>(*value),
+                          0,
+                          value.length(),
+                          flags);
+        nbytes = hex_decode(buf, buflen, *value, value.length());
       } else {
         String::Value value(isolate, str);
         nbytes = hex_decode(buf, buflen, *value, value.length());
@@ -490,6 +526,10 @@ static bool contains_non_ascii_slow(const char* buf, size_t len) {
 
 
 static bool contains_non_ascii(const char* src, size_t len) {
+  const size_t ascii = simd::AsciiPrefixLength(src, len);
+  src += ascii;
+  len -= ascii;
+
   if (len < 16) {
     return contains_non_ascii_slow(src, len);
   }
@@ -539,6 +579,11 @@ static void force_ascii_slow(const char* src, char* dst, size_t len) {
 
 
 static void force_ascii(const char* src, char* dst, size_t len) {
+  const size_t done = simd::ForceAsciiPrefix(src, dst, len);
+  src += done;
+  dst += done;
+  len -= done;
+
   if (len < 16) {
     force_ascii_slow(src, dst, len);
     return;
@@ -555,7 +600,7 @@ static void force_ascii(const char* src, char* dst, size_t len) {
       force_ascii_slow(src, dst, unalign);
       src += unalign;
       dst += unalign;
-      len -= src_unalign;
+      len -= unalign;
     } else {
       force_ascii_slow(src, dst, len);
       return;
@@ -589,7 +634,8 @@ static size_t hex_encode(const char* src, size_t slen, char* dst, size_t dlen) {
       "not enough space provided for hex encode");
 
   dlen = slen * 2;
-  for (uint32_t i = 0, k = 0; k < dlen; i += 1, k += 2) {
+  const size_t done = simd::HexEncodePrefix(src, slen, dst);
+  for (size_t i = done, k = done * 2; k < dlen; i += 1, k += 2) {
     static const char hex[] = "0123456789abcdef";
     uint8_t val = static_cast<uint8_t>(src[i]);
     dst[k + 0] = hex[val >> 4];
@@ -652,6 +698,10 @@ MaybeLocal<Value> StringBytes::Encode(Isolate* isolate,
       }
 
     case UTF8:
+      // Large ASCII-only payloads can be copied into an external string
+      // as-is instead of going through V8's UTF-8 decoder.
+      if (buflen >= EXTERN_APEX && !contains_non_ascii(buf, buflen))
+        return ExternOneByteString::NewFromCopy(isolate, buf, buflen, error);
       val = String::NewFromUtf8(isolate,
                                 buf,
                                 v8::NewStringType::kNormal,
@@ -26,6 +26,7 @@
 #include "node_crypto_bio.h"  // NodeBIO
 // ClientHelloParser
 #include "node_crypto_clienthello-inl.h"
+#include "node_crypto_key_operation.h"  // KeyOperationJob
 #include "node_counters.h"
 #include "node_internals.h"
 #include "stream_base-inl.h"
@@ -86,6 +87,7 @@ TLSWrap::TLSWrap(Environment* env,
 
 
 TLSWrap::~TLSWrap() {
+  AbandonKeyOperation();
   enc_in_ = nullptr;
   enc_out_ = nullptr;
   sc_ = nullptr;
@@ -117,6 +119,8 @@ void TLSWrap::InitSSL() {
   enc_out_ = crypto::NodeBIO::New();
   crypto::NodeBIO::FromBIO(enc_in_)->AssignEnvironment(env());
   crypto::NodeBIO::FromBIO(enc_out_)->AssignEnvironment(env());
+  crypto::NodeBIO::FromBIO(enc_in_)->AssignMemoryStats(sc_->bio_memory_stats_);
+  crypto::NodeBIO::FromBIO(enc_out_)->AssignMemoryStats(sc_->bio_memory_stats_);
 
   SSL_set_bio(ssl_.get(), enc_in_, enc_out_);
 
@@ -393,33 +397,41 @@ void TLSWrap::ClearOut() {
 
   crypto::MarkPopErrorOnReturn mark_pop_error_on_return;
 
-  char out[kClearOutChunkSize];
+  if (!OffloadHandshake())
+    return;
+
+  crypto::NodeBIO* enc_in = crypto::NodeBIO::FromBIO(enc_in_);
   int read;
   for (;;) {
-    read = SSL_read(ssl_.get(), out, sizeof(out));
+    // Decrypt straight into the listener's buffer. The plaintext is never
+    // larger than the ciphertext it is decrypted from, so that bounds the size
+    // of the buffer that is needed.
+    size_t pending = SSL_pending(ssl_.get()) + enc_in->Length();
+    if (pending == 0) {
+      // There should be nothing to decrypt, but SSL_read() still needs to be
+      // called to pick up errors and the peer's close_notify below.
+      char byte;
+      read = SSL_read(ssl_.get(), &byte, 1);
+      if (read <= 0)
+        break;
+      uv_buf_t buf = EmitAlloc(1);
+      buf.base[0] = byte;
+      EmitRead(1, buf);
+    } else {
+      uv_buf_t buf = EmitAlloc(std::min<size_t>(pending, kClearOutChunkSize));
+      read = SSL_read(ssl_.get(), buf.base, buf.len);
+      // Reading zero bytes hands the buffer back to the listener.
+      EmitRead(read > 0 ? read : 0, buf);
+    }
+
+    // Caveat emptor: OnRead() calls into JS land which can result in
+    // the SSL context object being destroyed.  We have to carefully
+    // check that ssl_ != nullptr afterwards.
+    if (ssl_ == nullptr)
+      return;
 
     if (read <= 0)
       break;
-
-    char* current = out;
-    while (read > 0) {
-      int avail = read;
-
-      uv_buf_t buf = EmitAlloc(avail);
-      if (static_cast<int>(buf.len) < avail)
-        avail = buf.len;
-      memcpy(buf.base, current, avail);
-      EmitRead(avail, buf);
-
-      // Caveat emptor: OnRead() calls into JS land which can result in
-      // the SSL context object being destroyed.  We have to carefully
-      // check that ssl_ != nullptr afterwards.
-      if (ssl_ == nullptr)
-        return;
-
-      read -= avail;
-      current += avail;
-    }
   }
 
   int flags = SSL_get_shutdown(ssl_.get());
@@ -452,6 +464,77 @@ void TLSWrap::ClearOut() {
 }
 
 
+// Drives the handshake of a server whose private key operations may be
+// offloaded, see SSLWrap::PauseForKeyOperations(). This uses
+// SSL_do_handshake() rather than SSL_read(), because a paused async job must
+// be resumed with the same call and arguments that started it. Returns false
+// while a key operation is running.
+bool TLSWrap::OffloadHandshake() {
+  if (key_job_ == nullptr) {
+    // Only the first handshake is driven here, up to the end of its async
+    // part.
+    if (!is_server() ||
+        !sc_->async_private_key_ ||
+        async_key_operations_ ||
+        established_ ||
+        SSL_is_init_finished(ssl_.get())) {
+      return true;
+    }
+  } else if (!key_job_->done()) {
+    return false;
+  }
+
+  for (;;) {
+    int ret;
+    {
+      crypto::KeyOperationScope scope(env(), OnKeyOperationDone, this);
+      ret = SSL_do_handshake(ssl_.get());
+      key_job_ = scope.job();
+    }
+    if (key_job_ != nullptr)
+      return false;
+
+    // The async part of the handshake is over, SSL_read() takes it from here.
+    if (SSL_get_mode(ssl_.get()) & SSL_MODE_ASYNC) {
+      SSL_clear_mode(ssl_.get(), SSL_MODE_ASYNC);
+      return true;
+    }
+
+    if (ret <= 0 &&
+        async_key_operations_ &&
+        SSL_get_error(ssl_.get(), ret) == SSL_ERROR_WANT_X509_LOOKUP) {
+      SSL_set_mode(ssl_.get(), SSL_MODE_ASYNC);
+      continue;
+    }
+
+    return true;
+  }
+}
+
+
+void TLSWrap::OnKeyOperationDone(void* arg) {
+  TLSWrap* wrap = static_cast<TLSWrap*>(arg);
+  HandleScope handle_scope(wrap->env()->isolate());
+  Context::Scope context_scope(wrap->env()->context());
+  wrap->Cycle();
+}
+
+
+// OpenSSL only releases the async job of a paused handshake once it returns,
+// so it has to be resumed before the SSL goes away.
+void TLSWrap::AbandonKeyOperation() {
+  if (key_job_ == nullptr)
+    return;
+
+  if (!key_job_->done())
+    key_job_->Abandon();
+  key_job_ = nullptr;
+
+  crypto::MarkPopErrorOnReturn mark_pop_error_on_return;
+  SSL_do_handshake(ssl_.get());
+}
+
+
 bool TLSWrap::ClearIn() {
   // Ignore cycling data if ClientHello wasn't yet parsed
   if (!hello_parser_.IsEnded())
@@ -460,6 +543,10 @@ bool TLSWrap::ClearIn() {
   if (ssl_ == nullptr)
     return false;
 
+  // SSL_write() would resume the paused handshake.
+  if (key_job_ != nullptr)
+    return false;
+
   std::vector<uv_buf_t> buffers;
   buffers.swap(pending_cleartext_input_);
 
@@ -610,16 +697,22 @@ int TLSWrap::DoWrite(WriteWrap* w,
   crypto::MarkPopErrorOnReturn mark_pop_error_on_return;
 
   int written = 0;
-  for (i = 0; i < count; i++) {
-    written = SSL_write(ssl_.get(), bufs[i].base, bufs[i].len);
-    CHECK(written == -1 || written == static_cast<int>(bufs[i].len));
-    if (written == -1)
-      break;
+  i = 0;
+  // SSL_write() would resume the paused handshake, queue the data instead.
+  if (key_job_ == nullptr) {
+    for (; i < count; i++) {
+      written = SSL_write(ssl_.get(), bufs[i].base, bufs[i].len);
+      CHECK(written == -1 || written == static_cast<int>(bufs[i].len));
+      if (written == -1)
+        break;
+    }
   }
 
   if (i != count) {
     int err;
-    Local<Value> arg = GetSSLError(written, &err, &error_);
+    Local<Value> arg;
+    if (written == -1)
+      arg = GetSSLError(written, &err, &error_);
     if (!arg.IsEmpty()) {
       current_write_ = nullptr;
       return UV_EPROTO;
@@ -757,6 +850,7 @@ void TLSWrap::DestroySSL(const FunctionCallbackInfo<Value>& args) {
   wrap->InvokeQueued(UV_ECANCELED, "Canceled because of SSL destruction");
 
   // Destroy the SSL structure and friends
+  wrap->AbandonKeyOperation();
   wrap->SSLWrap<TLSWrap>::DestroySSL();
 
   if (wrap->stream_ != nullptr)
@@ -43,6 +43,7 @@ class WriteWrap;
 namespace crypto {
 class SecureContext;
 class NodeBIO;
+class KeyOperationJob;
 }
 
 class TLSWrap : public AsyncWrap,
@@ -104,6 +105,8 @@ class TLSWrap : public AsyncWrap,
   void EncOut();
   bool ClearIn();
   void ClearOut();
+  bool OffloadHandshake();
+  void AbandonKeyOperation();
   bool InvokeQueued(int status, const char* error_str = nullptr);
 
   inline void Cycle() {
@@ -129,6 +132,7 @@ class TLSWrap : public AsyncWrap,
   v8::Local<v8::Value> GetSSLError(int status, int* err, std::string* msg);
 
   static void OnClientHelloParseEnd(void* arg);
+  static void OnKeyOperationDone(void* arg);
   static void Wrap(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Receive(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Start(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -155,6 +159,8 @@ class TLSWrap : public AsyncWrap,
   bool shutdown_;
   std::string error_;
   int cycle_depth_;
+  // The handshake is paused while it is set, see OffloadHandshake().
+  crypto::KeyOperationJob* key_job_ = nullptr;
 
   // If true - delivered EOF to the js-land, either after `close_notify`, or
   // after the `UV_EOF` on socket.
@@ -43,8 +43,9 @@ using v8::platform::tracing::TraceConfig;
 using v8::platform::tracing::TraceWriter;
 using std::string;
 
-Agent::Agent(const std::string& log_file_pattern)
-    : log_file_pattern_(log_file_pattern), file_writer_(EmptyClientHandle()) {
+Agent::Agent(const std::string& log_file_pattern, TraceFormat format)
+    : log_file_pattern_(log_file_pattern), format_(format),
+      file_writer_(EmptyClientHandle()) {
   tracing_controller_ = new TracingController();
   tracing_controller_->Initialize(nullptr);
 }
@@ -134,7 +135,7 @@ void Agent::Enable(const std::set<std::string>& categories) {
     // Ensure background thread is running
     Start();
     std::unique_ptr<NodeTraceWriter> writer(
-        new NodeTraceWriter(log_file_pattern_, &tracing_loop_));
+        new NodeTraceWriter(log_file_pattern_, format_, &tracing_loop_));
     file_writer_ = AddClient(full_list, std::move(writer));
   } else {
     ScopedSuspendTracing suspend(tracing_controller_, this);
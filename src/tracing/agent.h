@@ -15,6 +15,15 @@ namespace tracing {
 using v8::platform::tracing::TraceConfig;
 using v8::platform::tracing::TraceObject;
 
+// The format of the files that the default file writer produces.
+enum class TraceFormat {
+  kJSON,
+  // See BinaryTraceWriter.
+  kBinary,
+  // kBinary, compressed with gzip.
+  kCompressedBinary
+};
+
 class AsyncTraceWriter {
  public:
   virtual ~AsyncTraceWriter() {}
@@ -41,7 +50,8 @@ class Agent {
   static ClientHandle EmptyClientHandle() {
     return ClientHandle(nullptr, DisconnectClient);
   }
-  explicit Agent(const std::string& log_file_pattern);
+  explicit Agent(const std::string& log_file_pattern,
+                 TraceFormat format = TraceFormat::kJSON);
   void Stop();
 
   TracingController* GetTracingController() { return tracing_controller_; }
@@ -73,6 +83,7 @@ class Agent {
   void Disconnect(int client);
 
   const std::string& log_file_pattern_;
+  TraceFormat format_;
   uv_thread_t thread_;
   uv_loop_t tracing_loop_;
   bool started_ = false;
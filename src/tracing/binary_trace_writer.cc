@@ -0,0 +1,147 @@
+#include "tracing/binary_trace_writer.h"
+
+#include <string.h>
+
+#include "tracing/trace_event.h"
+#include "util.h"
+
+namespace node {
+namespace tracing {
+
+BinaryTraceWriter::BinaryTraceWriter(std::ostream& stream) : stream_(stream) {
+  WriteBytes("NTRC", 4);
+  WriteByte(kVersion);
+}
+
+void BinaryTraceWriter::WriteVarint(uint64_t value) {
+  while (value >= 0x80) {
+    WriteByte(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  WriteByte(static_cast<uint8_t>(value));
+}
+
+void BinaryTraceWriter::WriteSignedVarint(int64_t value) {
+  WriteVarint((static_cast<uint64_t>(value) << 1) ^
+              static_cast<uint64_t>(value >> 63));
+}
+
+void BinaryTraceWriter::WriteBytes(const char* data, size_t length) {
+  stream_.write(data, length);
+}
+
+uint64_t BinaryTraceWriter::InternString(const char* str) {
+  if (str == nullptr)
+    return 0;
+  auto it = strings_.find(str);
+  if (it != strings_.end())
+    return it->second;
+
+  size_t length = strlen(str);
+  WriteByte(kStringRecord);
+  WriteVarint(length);
+  WriteBytes(str, length);
+  uint64_t index = strings_.size() + 1;
+  strings_.emplace(str, index);
+  return index;
+}
+
+void BinaryTraceWriter::AppendTraceEvent(TraceObject* trace_event) {
+  // Strings have to be defined before the event record that uses them, and
+  // must not be forgotten while the event is being written.
+  if (strings_.size() + kMaxStringsPerEvent > kMaxStrings) {
+    WriteByte(kResetStringsRecord);
+    strings_.clear();
+  }
+  const char* category =
+      v8::platform::tracing::TracingController::GetCategoryGroupName(
+          trace_event->category_enabled_flag());
+  uint64_t category_index = InternString(category);
+  uint64_t name_index = InternString(trace_event->name());
+  bool has_id = (trace_event->flags() & TRACE_EVENT_FLAG_HAS_ID) != 0;
+  uint64_t scope_index = has_id ? InternString(trace_event->scope()) : 0;
+
+  const int num_args = trace_event->num_args();
+  const char** arg_names = trace_event->arg_names();
+  const uint8_t* arg_types = trace_event->arg_types();
+  uint64_t arg_name_indices[v8::platform::tracing::kTraceMaxNumArgs];
+  uint64_t arg_string_indices[v8::platform::tracing::kTraceMaxNumArgs];
+  TraceObject::ArgValue* arg_values = trace_event->arg_values();
+  for (int i = 0; i < num_args; ++i) {
+    arg_name_indices[i] = InternString(arg_names[i]);
+    if (arg_types[i] == TRACE_VALUE_TYPE_STRING)
+      arg_string_indices[i] = InternString(arg_values[i].as_string);
+  }
+
+  WriteByte(kEventRecord);
+  WriteSignedVarint(trace_event->pid());
+  WriteSignedVarint(trace_event->tid());
+  WriteByte(static_cast<uint8_t>(trace_event->phase()));
+  WriteVarint(category_index);
+  WriteVarint(name_index);
+  WriteSignedVarint(trace_event->ts() - last_ts_);
+  WriteSignedVarint(trace_event->tts() - last_tts_);
+  last_ts_ = trace_event->ts();
+  last_tts_ = trace_event->tts();
+  WriteVarint(trace_event->duration());
+  WriteVarint(trace_event->cpu_duration());
+  WriteByte(has_id ? 1 : 0);
+  if (has_id) {
+    WriteVarint(scope_index);
+    WriteVarint(trace_event->id());
+  }
+
+  WriteVarint(num_args);
+  std::unique_ptr<v8::ConvertableToTraceFormat>* arg_convertables =
+      trace_event->arg_convertables();
+  for (int i = 0; i < num_args; ++i) {
+    WriteVarint(arg_name_indices[i]);
+    WriteByte(arg_types[i]);
+    const TraceObject::ArgValue& value = arg_values[i];
+    switch (arg_types[i]) {
+      case TRACE_VALUE_TYPE_BOOL:
+        WriteByte(value.as_bool ? 1 : 0);
+        break;
+      case TRACE_VALUE_TYPE_UINT:
+        WriteVarint(value.as_uint);
+        break;
+      case TRACE_VALUE_TYPE_INT:
+        WriteSignedVarint(value.as_int);
+        break;
+      case TRACE_VALUE_TYPE_DOUBLE: {
+        uint64_t bits;
+        memcpy(&bits, &value.as_double, sizeof(bits));
+        for (int shift = 0; shift < 64; shift += 8)
+          WriteByte(static_cast<uint8_t>(bits >> shift));
+        break;
+      }
+      case TRACE_VALUE_TYPE_POINTER:
+        WriteVarint(reinterpret_cast<uintptr_t>(value.as_pointer));
+        break;
+      case TRACE_VALUE_TYPE_STRING:
+        WriteVarint(arg_string_indices[i]);
+        break;
+      case TRACE_VALUE_TYPE_COPY_STRING: {
+        // Copied strings are usually unique, so they are not interned.
+        const char* str =
+            value.as_string != nullptr ? value.as_string : "nullptr";
+        size_t length = strlen(str);
+        WriteVarint(length);
+        WriteBytes(str, length);
+        break;
+      }
+      case TRACE_VALUE_TYPE_CONVERTABLE: {
+        std::string json;
+        arg_convertables[i]->AppendAsTraceFormat(&json);
+        WriteVarint(json.size());
+        WriteBytes(json.data(), json.size());
+        break;
+      }
+      default:
+        UNREACHABLE();
+    }
+  }
+}
+
+}  // namespace tracing
+}  // namespace node
@@ -0,0 +1,78 @@
+#ifndef SRC_TRACING_BINARY_TRACE_WRITER_H_
+#define SRC_TRACING_BINARY_TRACE_WRITER_H_
+
+#include "libplatform/v8-tracing.h"
+
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+namespace node {
+namespace tracing {
+
+using v8::platform::tracing::TraceObject;
+using v8::platform::tracing::TraceWriter;
+
+// Serializes trace events in a compact binary format, as an alternative to
+// V8's JSONTraceWriter. Like the JSON writer, an instance covers exactly one
+// file: the constructor writes the file header to `stream`.
+//
+// The format is a header followed by a sequence of records. All integers
+// are LEB128 varints; signed integers are zigzag encoded first. Strings that
+// repeat between events (category groups, names, argument names, scopes) are
+// written once and then referred to by their index. Timestamps are stored as
+// the difference to the timestamps of the previous event.
+//
+//   header:  "NTRC" kVersion
+//   record:  kStringRecord length bytes        (defines the next string index)
+//          | kResetStringsRecord               (forgets all defined strings)
+//          | kEventRecord event
+//   event:   pid tid phase(1 byte) category name ts tts dur tdur
+//            has_id(1 byte) [scope id] num_args arg*
+//   arg:     name type(1 byte) value
+//
+// String indices start at 1; index 0 refers to a missing string. `type` is
+// one of the TRACE_VALUE_TYPE_* constants. Values of type DOUBLE are 8 bytes
+// of little endian IEEE 754 data, BOOL values are a single byte, STRING
+// values are string indices, and COPY_STRING and CONVERTABLE values are
+// written inline as length and bytes. The latter holds the JSON text of the
+// value. tools/trace-events/binary-to-json.js converts this format back into
+// the JSON format that V8's writer produces.
+class BinaryTraceWriter : public TraceWriter {
+ public:
+  explicit BinaryTraceWriter(std::ostream& stream);
+
+  void AppendTraceEvent(TraceObject* trace_event) override;
+  void Flush() override {}
+
+  static const uint8_t kVersion = 1;
+  static const uint8_t kStringRecord = 1;
+  static const uint8_t kEventRecord = 2;
+  static const uint8_t kResetStringsRecord = 3;
+
+ private:
+  // Forget all strings once this many are defined, so that a long running
+  // process that traces many distinct strings does not grow without bound.
+  static const size_t kMaxStrings = 1 << 16;
+  // Category, name and scope, plus the name and value of each argument.
+  static const size_t kMaxStringsPerEvent =
+      3 + 2 * v8::platform::tracing::kTraceMaxNumArgs;
+
+  void WriteByte(uint8_t value) { stream_.put(static_cast<char>(value)); }
+  void WriteVarint(uint64_t value);
+  void WriteSignedVarint(int64_t value);
+  void WriteBytes(const char* data, size_t length);
+  // Returns the index of `str`, defining it first if necessary.
+  uint64_t InternString(const char* str);
+
+  std::ostream& stream_;
+  std::unordered_map<std::string, uint64_t> strings_;
+  int64_t last_ts_ = 0;
+  int64_t last_tts_ = 0;
+};
+
+}  // namespace tracing
+}  // namespace node
+
+#endif  // SRC_TRACING_BINARY_TRACE_WRITER_H_
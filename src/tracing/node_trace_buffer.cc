@@ -1,35 +1,87 @@
 #include "tracing/node_trace_buffer.h"
 
+#include <algorithm>
+
 namespace node {
 namespace tracing {
 
+namespace {
+
+// Generations are unique across all buffers, so a thread's cached chunk can
+// never be mistaken for one in a buffer that was created later.
+std::atomic<uint64_t> next_generation{1};
+
+// The chunk that the current thread is filling.
+struct ThreadChunk {
+  uint64_t generation;
+  size_t chunk_index;
+};
+
+thread_local ThreadChunk thread_chunk = { 0, 0 };
+
+}  // anonymous namespace
+
 InternalTraceBuffer::InternalTraceBuffer(size_t max_chunks, uint32_t id,
                                          Agent* agent)
-    : flushing_(false), max_chunks_(max_chunks),
-      agent_(agent), id_(id) {
-  chunks_.resize(max_chunks);
+    : max_chunks_(max_chunks), agent_(agent),
+      slots_(new Slot[max_chunks]), generation_(next_generation++), id_(id) {
+}
+
+InternalTraceBuffer::ScopedAccess::ScopedAccess(InternalTraceBuffer* buffer)
+    : buffer_(buffer) {
+  // Paired with Flush(), which sets flushing_ before it waits for
+  // accessors_ to drop to zero.
+  buffer_->accessors_++;
+  allowed_ = !buffer_->flushing_.load();
+}
+
+InternalTraceBuffer::ScopedAccess::~ScopedAccess() {
+  if (--buffer_->accessors_ == 0 && buffer_->flushing_.load()) {
+    Mutex::ScopedLock drain_lock(buffer_->drain_mutex_);
+    buffer_->drain_cond_.Signal(drain_lock);
+  }
+}
+
+TraceBufferChunk* InternalTraceBuffer::ClaimChunk(size_t* chunk_index) {
+  size_t index = next_chunk_++;
+  if (index >= max_chunks_)
+    return nullptr;
+  // The slot belongs to this thread until the next flush.
+  Slot& slot = slots_[index];
+  uint32_t seq = current_chunk_seq_++;
+  if (slot.chunk) {
+    slot.chunk->Reset(seq);
+  } else {
+    slot.chunk.reset(new TraceBufferChunk(seq));
+  }
+  slot.seq.store(seq, std::memory_order_release);
+  thread_chunk.generation = generation_.load();
+  thread_chunk.chunk_index = index;
+  *chunk_index = index;
+  return slot.chunk.get();
 }
 
 TraceObject* InternalTraceBuffer::AddTraceEvent(uint64_t* handle) {
-  Mutex::ScopedLock scoped_lock(mutex_);
-  // Create new chunk if last chunk is full or there is no chunk.
-  if (total_chunks_ == 0 || chunks_[total_chunks_ - 1]->IsFull()) {
-    auto& chunk = chunks_[total_chunks_++];
-    if (chunk) {
-      chunk->Reset(current_chunk_seq_++);
-    } else {
-      chunk.reset(new TraceBufferChunk(current_chunk_seq_++));
-    }
+  ScopedAccess access(this);
+  if (!access.allowed())
+    return nullptr;
+  size_t chunk_index = thread_chunk.chunk_index;
+  TraceBufferChunk* chunk = nullptr;
+  if (thread_chunk.generation == generation_.load() &&
+      !slots_[chunk_index].chunk->IsFull()) {
+    chunk = slots_[chunk_index].chunk.get();
+  } else {
+    chunk = ClaimChunk(&chunk_index);
+    if (chunk == nullptr)
+      return nullptr;
   }
-  auto& chunk = chunks_[total_chunks_ - 1];
   size_t event_index;
   TraceObject* trace_object = chunk->AddTraceEvent(&event_index);
-  *handle = MakeHandle(total_chunks_ - 1, chunk->seq(), event_index);
+  *handle = MakeHandle(chunk_index, chunk->seq(), event_index);
   return trace_object;
 }
 
 TraceObject* InternalTraceBuffer::GetEventByHandle(uint64_t handle) {
-  Mutex::ScopedLock scoped_lock(mutex_);
   if (handle == 0) {
     // A handle value of zero never has a trace event associated with it.
     return nullptr;
@@ -37,34 +89,47 @@ TraceObject* InternalTraceBuffer::GetEventByHandle(uint64_t handle) {
   size_t chunk_index, event_index;
   uint32_t buffer_id, chunk_seq;
   ExtractHandle(handle, &buffer_id, &chunk_index, &chunk_seq, &event_index);
-  if (buffer_id != id_ || chunk_index >= total_chunks_) {
-    // Either the chunk belongs to the other buffer, or is outside the current
-    // range of chunks loaded in memory (the latter being true suggests that
-    // the chunk has already been flushed and is no longer in memory.)
+  if (buffer_id != id_ || chunk_index >= max_chunks_) {
     return nullptr;
   }
-  auto& chunk = chunks_[chunk_index];
-  if (chunk->seq() != chunk_seq) {
-    // Chunk is no longer in memory.
+  ScopedAccess access(this);
+  if (!access.allowed())
+    return nullptr;
+  Slot& slot = slots_[chunk_index];
+  if (slot.seq.load(std::memory_order_acquire) != chunk_seq) {
+    // The chunk has been flushed, and possibly reused since. Handles are
+    // looked up by the thread that created them, which also owns the chunk
+    // while it is current, so the chunk cannot be reset concurrently.
     return nullptr;
   }
-  return chunk->GetEventAt(event_index);
+  return slot.chunk->GetEventAt(event_index);
 }
 
 void InternalTraceBuffer::Flush(bool blocking) {
   {
-    Mutex::ScopedLock scoped_lock(mutex_);
-    if (total_chunks_ > 0) {
+    Mutex::ScopedLock scoped_lock(flush_mutex_);
+    {
+      // Threads that got past the check in ScopedAccess before flushing_
+      // was set only need to finish claiming a single event. Filling it in
+      // happens outside of ScopedAccess, see AddTraceEvent() in the header.
+      Mutex::ScopedLock drain_lock(drain_mutex_);
       flushing_ = true;
-      for (size_t i = 0; i < total_chunks_; ++i) {
-        auto& chunk = chunks_[i];
-        for (size_t j = 0; j < chunk->size(); ++j) {
-          agent_->AppendTraceEvent(chunk->GetEventAt(j));
-        }
+      while (accessors_.load() != 0)
+        drain_cond_.Wait(drain_lock);
+    }
+    size_t total_chunks = std::min(next_chunk_.load(), max_chunks_);
+    for (size_t i = 0; i < total_chunks; ++i) {
+      Slot& slot = slots_[i];
+      // Invalidate outstanding handles, since the chunk will be reused.
+      slot.seq.store(0);
+      auto& chunk = slot.chunk;
+      for (size_t j = 0; j < chunk->size(); ++j) {
+        agent_->AppendTraceEvent(chunk->GetEventAt(j));
       }
-      total_chunks_ = 0;
-      flushing_ = false;
     }
+    generation_ = next_generation++;
+    next_chunk_ = 0;
+    flushing_ = false;
   }
   agent_->Flush(blocking);
 }
@@ -112,19 +177,31 @@ NodeTraceBuffer::~NodeTraceBuffer() {
 }
 
 TraceObject* NodeTraceBuffer::AddTraceEvent(uint64_t* handle) {
-  // If the buffer is full, attempt to perform a flush.
-  if (!TryLoadAvailableBuffer()) {
+  InternalTraceBuffer* buf = current_buf_.load();
+  TraceObject* trace_object = buf->AddTraceEvent(handle);
+  if (trace_object != nullptr)
+    return trace_object;
+
+  // The buffer is full or being flushed. Trigger a flush on a separate
+  // thread, and switch over to the other buffer if it can take the event.
+  uv_async_send(&flush_signal_);
+  InternalTraceBuffer* other_buf = buf == &buffer1_ ? &buffer2_ : &buffer1_;
+  trace_object = other_buf->AddTraceEvent(handle);
+  if (trace_object == nullptr) {
     // Assign a value of zero as the trace event handle.
     // This is equivalent to calling InternalTraceBuffer::MakeHandle(0, 0, 0),
     // and will cause GetEventByHandle to return NULL if passed as an argument.
     *handle = 0;
     return nullptr;
   }
-  return current_buf_.load()->AddTraceEvent(handle);
+  current_buf_.compare_exchange_strong(buf, other_buf);
+  return trace_object;
 }
 
 TraceObject* NodeTraceBuffer::GetEventByHandle(uint64_t handle) {
-  return current_buf_.load()->GetEventByHandle(handle);
+  // The lowest bit of the handle is the id of the buffer it belongs to.
+  InternalTraceBuffer* buf = (handle & 0x1) == 0 ? &buffer1_ : &buffer2_;
+  return buf->GetEventByHandle(handle);
 }
 
 bool NodeTraceBuffer::Flush() {
@@ -133,24 +210,6 @@ bool NodeTraceBuffer::Flush() {
   return true;
 }
 
-// Attempts to set current_buf_ such that it references a buffer that can
-// write at least one trace event. If both buffers are unavailable this
-// method returns false; otherwise it returns true.
-bool NodeTraceBuffer::TryLoadAvailableBuffer() {
-  InternalTraceBuffer* prev_buf = current_buf_.load();
-  if (prev_buf->IsFull()) {
-    uv_async_send(&flush_signal_);  // trigger flush on a separate thread
-    InternalTraceBuffer* other_buf = prev_buf == &buffer1_ ?
-      &buffer2_ : &buffer1_;
-    if (!other_buf->IsFull()) {
-      current_buf_.store(other_buf);
-    } else {
-      return false;
-    }
-  }
-  return true;
-}
-
 // static
 void NodeTraceBuffer::NonBlockingFlushSignalCb(uv_async_t* signal) {
   NodeTraceBuffer* buffer = reinterpret_cast<NodeTraceBuffer*>(signal->data);
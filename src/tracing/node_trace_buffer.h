@@ -6,6 +6,7 @@
 #include "libplatform/v8-tracing.h"
 
 #include <atomic>
+#include <memory>
 
 namespace node {
 namespace tracing {
@@ -17,34 +18,74 @@ using v8::platform::tracing::TraceObject;
 // forward declaration
 class NodeTraceBuffer;
 
+// Events are stored in chunks of TraceBufferChunk::kChunkSize. Each thread
+// claims a whole chunk at a time and then fills it without synchronizing
+// with other threads, so tracing from the main thread, worker threads and
+// V8 platform threads does not contend on a lock for every event.
 class InternalTraceBuffer {
  public:
   InternalTraceBuffer(size_t max_chunks, uint32_t id, Agent* agent);
 
+  // Returns nullptr if no chunk is available, i.e. when the buffer is full
+  // or being flushed. The caller fills in the returned object after this has
+  // returned, and Flush() does not wait for that. A flush that runs in
+  // between writes out the event as it was before; this was no different
+  // when the buffer was protected by a mutex.
   TraceObject* AddTraceEvent(uint64_t* handle);
   TraceObject* GetEventByHandle(uint64_t handle);
   void Flush(bool blocking);
+  // True once every chunk has been claimed. Threads may still be appending
+  // to the chunks they hold until the buffer is flushed.
   bool IsFull() const {
-    return total_chunks_ == max_chunks_ && chunks_[total_chunks_ - 1]->IsFull();
+    return next_chunk_.load() >= max_chunks_;
   }
   bool IsFlushing() const {
-    return flushing_;
+    return flushing_.load();
   }
 
  private:
+  struct Slot {
+    std::unique_ptr<TraceBufferChunk> chunk;
+    // Published after the chunk has been (re)initialized, so that
+    // GetEventByHandle() can tell whether a handle still refers to it.
+    std::atomic<uint32_t> seq{0};
+  };
+
+  // Keeps Flush() waiting while a thread is inside AddTraceEvent() or
+  // GetEventByHandle().
+  class ScopedAccess {
+   public:
+    explicit ScopedAccess(InternalTraceBuffer* buffer);
+    ~ScopedAccess();
+    bool allowed() const { return allowed_; }
+
+   private:
+    InternalTraceBuffer* buffer_;
+    bool allowed_;
+  };
+
+  TraceBufferChunk* ClaimChunk(size_t* chunk_index);
   uint64_t MakeHandle(size_t chunk_index, uint32_t chunk_seq,
                       size_t event_index) const;
   void ExtractHandle(uint64_t handle, uint32_t* buffer_id, size_t* chunk_index,
                      uint32_t* chunk_seq, size_t* event_index) const;
   size_t Capacity() const { return max_chunks_ * TraceBufferChunk::kChunkSize; }
 
-  Mutex mutex_;
-  bool flushing_;
+  // Serializes flushes. Never taken when adding events.
+  Mutex flush_mutex_;
+  // Used by Flush() to wait for threads that are still accessing chunks.
+  Mutex drain_mutex_;
+  ConditionVariable drain_cond_;
+  std::atomic<bool> flushing_{false};
+  std::atomic<size_t> accessors_{0};
   size_t max_chunks_;
   Agent* agent_;
-  std::vector<std::unique_ptr<TraceBufferChunk>> chunks_;
-  size_t total_chunks_ = 0;
-  uint32_t current_chunk_seq_ = 1;
+  std::unique_ptr<Slot[]> slots_;
+  std::atomic<size_t> next_chunk_{0};
+  std::atomic<uint32_t> current_chunk_seq_{1};
+  // Changes on every flush. Threads remember the generation in which they
+  // claimed their current chunk, which is only theirs while it matches.
+  std::atomic<uint64_t> generation_;
   uint32_t id_;
 };
 
@@ -60,7 +101,6 @@ class NodeTraceBuffer : public TraceBuffer {
   static const size_t kBufferChunks = 1024;
 
  private:
-  bool TryLoadAvailableBuffer();
   static void NonBlockingFlushSignalCb(uv_async_t* signal);
   static void ExitSignalCb(uv_async_t* signal);
 
@@ -3,14 +3,18 @@
 #include <string.h>
 #include <fcntl.h>
 
+#include "tracing/binary_trace_writer.h"
 #include "util.h"
+#include "zlib.h"
 
 namespace node {
 namespace tracing {
 
 NodeTraceWriter::NodeTraceWriter(const std::string& log_file_pattern,
+                                 TraceFormat format,
                                  uv_loop_t* tracing_loop)
-    : tracing_loop_(tracing_loop), log_file_pattern_(log_file_pattern) {
+    : tracing_loop_(tracing_loop), log_file_pattern_(log_file_pattern),
+      format_(format) {
   flush_signal_.data = this;
   int err = uv_async_init(tracing_loop_, &flush_signal_, FlushSignalCb);
   CHECK_EQ(err, 0);
@@ -29,8 +33,8 @@ void NodeTraceWriter::WriteSuffix() {
     Mutex::ScopedLock scoped_lock(stream_mutex_);
     if (total_traces_ > 0) {
       total_traces_ = 0;  // so we don't write it again in FlushPrivate
-      // Appends "]}" to stream_.
-      delete json_trace_writer_;
+      // Appends "]}" to stream_ for JSON files.
+      delete trace_writer_;
       should_flush = true;
     }
   }
@@ -86,16 +90,41 @@ void NodeTraceWriter::AppendTraceEvent(TraceObject* trace_event) {
   // If this is the first trace event, open a new file for streaming.
   if (total_traces_ == 0) {
     OpenNewFileForStreaming();
-    // Constructing a new JSONTraceWriter object appends "{\"traceEvents\":["
-    // to stream_.
-    // In other words, the constructor initializes the serialization stream
-    // to a state where we can start writing trace events to it.
-    // Repeatedly constructing and destroying json_trace_writer_ allows
-    // us to use V8's JSON writer instead of implementing our own.
-    json_trace_writer_ = TraceWriter::CreateJSONTraceWriter(stream_);
+    trace_writer_ = CreateTraceWriter();
   }
   ++total_traces_;
-  json_trace_writer_->AppendTraceEvent(trace_event);
+  trace_writer_->AppendTraceEvent(trace_event);
+}
+
+TraceWriter* NodeTraceWriter::CreateTraceWriter() {
+  if (format_ != TraceFormat::kJSON)
+    return new BinaryTraceWriter(stream_);
+  // Constructing a new JSONTraceWriter object appends "{\"traceEvents\":["
+  // to stream_.
+  // In other words, the constructor initializes the serialization stream
+  // to a state where we can start writing trace events to it.
+  // Repeatedly constructing and destroying trace_writer_ allows
+  // us to use V8's JSON writer instead of implementing our own.
+  return TraceWriter::CreateJSONTraceWriter(stream_);
+}
+
+void NodeTraceWriter::Compress(std::string* str) {
+  z_stream strm;
+  memset(&strm, 0, sizeof(strm));
+  // 16 + MAX_WBITS selects the gzip wrapper.
+  int err = deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                         16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+  CHECK_EQ(err, Z_OK);
+  std::string out(deflateBound(&strm, str->size()), '\0');
+  strm.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(str->data()));
+  strm.avail_in = str->size();
+  strm.next_out = reinterpret_cast<Bytef*>(&out[0]);
+  strm.avail_out = out.size();
+  err = deflate(&strm, Z_FINISH);
+  CHECK_EQ(err, Z_STREAM_END);
+  out.resize(strm.total_out);
+  deflateEnd(&strm);
+  str->swap(out);
 }
 
 void NodeTraceWriter::FlushPrivate() {
@@ -106,14 +135,20 @@ void NodeTraceWriter::FlushPrivate() {
     if (total_traces_ >= kTracesPerFile) {
       total_traces_ = 0;
       // Destroying the member JSONTraceWriter object appends "]}" to
-      // stream_ - in other words, ending a JSON file.
-      delete json_trace_writer_;
+      // stream_ - in other words, ending a JSON file. Binary files need no
+      // ending.
+      delete trace_writer_;
     }
     // str() makes a copy of the contents of the stream.
     str = stream_.str();
     stream_.str("");
     stream_.clear();
   }
+  // Each flush becomes a separate gzip member. Concatenated members form a
+  // valid gzip file, and keeping them independent means that everything up
+  // to the last flush can be decompressed even if the process crashes.
+  if (format_ == TraceFormat::kCompressedBinary && !str.empty())
+    Compress(&str);
   {
     Mutex::ScopedLock request_scoped_lock(request_mutex_);
     highest_request_id = num_write_requests_;
@@ -128,7 +163,7 @@ void NodeTraceWriter::FlushSignalCb(uv_async_t* signal) {
 
 void NodeTraceWriter::Flush(bool blocking) {
   Mutex::ScopedLock scoped_lock(request_mutex_);
-  if (!json_trace_writer_) {
+  if (!trace_writer_) {
     return;
   }
   int request_id = ++num_write_requests_;
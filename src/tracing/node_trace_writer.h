@@ -17,8 +17,9 @@ using v8::platform::tracing::TraceWriter;
 
 class NodeTraceWriter : public AsyncTraceWriter {
  public:
-  explicit NodeTraceWriter(const std::string& log_file_pattern,
-                           uv_loop_t* tracing_loop);
+  NodeTraceWriter(const std::string& log_file_pattern,
+                  TraceFormat format,
+                  uv_loop_t* tracing_loop);
   ~NodeTraceWriter();
 
   void AppendTraceEvent(TraceObject* trace_event) override;
@@ -38,6 +39,11 @@ class NodeTraceWriter : public AsyncTraceWriter {
   void OpenNewFileForStreaming();
   void WriteToFile(std::string&& str, int highest_request_id);
   void WriteSuffix();
+  // Creates the writer that serializes events into stream_, which also
+  // writes the header of the file.
+  TraceWriter* CreateTraceWriter();
+  // Compresses `str` in place, as a complete gzip member.
+  static void Compress(std::string* str);
   static void FlushSignalCb(uv_async_t* signal);
   void FlushPrivate();
   static void ExitSignalCb(uv_async_t* signal);
@@ -64,8 +70,9 @@ class NodeTraceWriter : public AsyncTraceWriter {
   int total_traces_ = 0;
   int file_num_ = 0;
   const std::string& log_file_pattern_;
+  TraceFormat format_;
   std::ostringstream stream_;
-  TraceWriter* json_trace_writer_ = nullptr;
+  TraceWriter* trace_writer_ = nullptr;
   bool exited_ = false;
 };
 
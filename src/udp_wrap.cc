@@ -37,6 +37,7 @@ using v8::EscapableHandleScope;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
 using v8::HandleScope;
+using v8::Isolate;
 using v8::Integer;
 using v8::Local;
 using v8::Object;
@@ -74,16 +75,32 @@ inline bool SendWrap::have_callback() const {
 }
 
 
-UDPWrap::UDPWrap(Environment* env, Local<Object> object)
+// Size of one recvmmsg() slot, the largest possible datagram.
+static const size_t kMaxDatagramSize = 64 * 1024;
+
+
+UDPWrap::UDPWrap(Environment* env,
+                 Local<Object> object,
+                 uint32_t recv_batch_size)
     : HandleWrap(env,
                  object,
                  reinterpret_cast<uv_handle_t*>(&handle_),
                  AsyncWrap::PROVIDER_UDPWRAP) {
-  int r = uv_udp_init(env->event_loop(), &handle_);
+  unsigned int flags = AF_UNSPEC;
+  if (recv_batch_size > 1) {
+    flags |= UV_UDP_RECVMMSG;
+    recv_slab_size_ = recv_batch_size * kMaxDatagramSize;
+  }
+  int r = uv_udp_init_ex(env->event_loop(), &handle_, flags);
   CHECK_EQ(r, 0);  // can't fail anyway
 }
 
 
+UDPWrap::~UDPWrap() {
+  free(recv_slab_);
+}
+
+
 void UDPWrap::Initialize(Local<Object> target,
                          Local<Value> unused,
                          Local<Context> context) {
@@ -152,7 +169,10 @@ void UDPWrap::Initialize(Local<Object> target,
 void UDPWrap::New(const FunctionCallbackInfo<Value>& args) {
   CHECK(args.IsConstructCall());
   Environment* env = Environment::GetCurrent(args);
-  new UDPWrap(env, args.This());
+  uint32_t recv_batch_size = 1;
+  if (args[0]->IsUint32())
+    recv_batch_size = args[0].As<Uint32>()->Value();
+  new UDPWrap(env, args.This(), recv_batch_size);
 }
 
 
@@ -446,6 +466,14 @@ void UDPWrap::OnSend(uv_udp_send_t* req, int status) {
 void UDPWrap::OnAlloc(uv_handle_t* handle,
                       size_t suggested_size,
                       uv_buf_t* buf) {
+  UDPWrap* wrap = static_cast<UDPWrap*>(handle->data);
+  if (wrap->recv_slab_size_ != 0) {
+    if (wrap->recv_slab_ == nullptr)
+      wrap->recv_slab_ = node::Malloc(wrap->recv_slab_size_);
+    *buf = uv_buf_init(wrap->recv_slab_, wrap->recv_slab_size_);
+    return;
+  }
+
   buf->base = node::Malloc(suggested_size);
   buf->len = suggested_size;
 }
@@ -456,13 +484,37 @@ void UDPWrap::OnRecv(uv_udp_t* handle,
                      const uv_buf_t* buf,
                      const struct sockaddr* addr,
                      unsigned int flags) {
+  UDPWrap* wrap = static_cast<UDPWrap*>(handle->data);
+  const bool from_slab =
+      buf->base != nullptr && buf->base == wrap->recv_slab_;
+
+  if (flags & UV_UDP_MMSG_CHUNK) {
+    // Collect the datagrams of one recvmmsg() call and hand them to JS
+    // together once libuv signals the end of the batch.
+    BatchedMessage message;
+    message.base = buf->base;
+    message.length = nread;
+    message.has_addr = addr != nullptr;
+    if (addr != nullptr) {
+      memcpy(&message.addr,
+             addr,
+             addr->sa_family == AF_INET6 ? sizeof(sockaddr_in6) :
+                                           sizeof(sockaddr_in));
+    }
+    wrap->recv_batch_.push_back(message);
+    return;
+  }
+
   if (nread == 0 && addr == nullptr) {
-    if (buf->base != nullptr)
+    if (from_slab) {
+      if (!wrap->recv_batch_.empty())
+        wrap->EmitMessageBatch();
+    } else if (buf->base != nullptr) {
       free(buf->base);
+    }
     return;
   }
 
-  UDPWrap* wrap = static_cast<UDPWrap*>(handle->data);
   Environment* env = wrap->env();
 
   HandleScope handle_scope(env->isolate());
@@ -477,19 +529,65 @@ void UDPWrap::OnRecv(uv_udp_t* handle,
   };
 
   if (nread < 0) {
-    if (buf->base != nullptr)
+    if (buf->base != nullptr && !from_slab)
       free(buf->base);
     wrap->MakeCallback(env->onmessage_string(), arraysize(argv), argv);
     return;
   }
 
-  char* base = node::UncheckedRealloc(buf->base, nread);
-  argv[2] = Buffer::New(env, base, nread).ToLocalChecked();
+  if (from_slab) {
+    argv[2] = Buffer::Copy(env, buf->base, nread).ToLocalChecked();
+  } else {
+    char* base = node::UncheckedRealloc(buf->base, nread);
+    argv[2] = Buffer::New(env, base, nread).ToLocalChecked();
+  }
   argv[3] = AddressToJS(env, addr);
   wrap->MakeCallback(env->onmessage_string(), arraysize(argv), argv);
 }
 
 
+// Copies the batched datagrams back to back into a single Buffer and makes
+// one call into JS. The size of each datagram is passed in its rinfo object.
+void UDPWrap::EmitMessageBatch() {
+  Environment* env = this->env();
+  Isolate* isolate = env->isolate();
+
+  HandleScope handle_scope(isolate);
+  Context::Scope context_scope(env->context());
+
+  size_t total = 0;
+  for (const BatchedMessage& message : recv_batch_)
+    total += message.length;
+
+  Local<Object> buffer = Buffer::New(env, total).ToLocalChecked();
+  char* data = Buffer::Data(buffer);
+  Local<Array> infos = Array::New(isolate, recv_batch_.size());
+
+  for (size_t i = 0; i < recv_batch_.size(); i++) {
+    const BatchedMessage& message = recv_batch_[i];
+    memcpy(data, message.base, message.length);
+    data += message.length;
+
+    Local<Object> info = message.has_addr ?
+        AddressToJS(env, reinterpret_cast<const sockaddr*>(&message.addr)) :
+        Object::New(isolate);
+    info->Set(env->context(),
+              env->size_string(),
+              Integer::NewFromUnsigned(isolate, message.length)).FromJust();
+    infos->Set(env->context(), i, info).FromJust();
+  }
+  recv_batch_.clear();
+
+  Local<Value> argv[] = {
+    Integer::NewFromUnsigned(isolate, infos->Length()),
+    object(),
+    buffer,
+    infos
+  };
+  MakeCallback(env->onmessagebatch_string(), arraysize(argv), argv);
+}
+
+
 Local<Object> UDPWrap::Instantiate(Environment* env,
                                    AsyncWrap* parent,
                                    UDPWrap::SocketType type) {
@@ -30,6 +30,8 @@
 #include "uv.h"
 #include "v8.h"
 
+#include <vector>
+
 namespace node {
 
 class UDPWrap: public HandleWrap {
@@ -66,6 +68,8 @@ class UDPWrap: public HandleWrap {
 
   size_t self_size() const override { return sizeof(*this); }
 
+  ~UDPWrap() override;
+
  private:
   typedef uv_udp_t HandleType;
 
@@ -73,7 +77,19 @@ class UDPWrap: public HandleWrap {
             int (*F)(const typename T::HandleType*, sockaddr*, int*)>
   friend void GetSockOrPeerName(const v8::FunctionCallbackInfo<v8::Value>&);
 
-  UDPWrap(Environment* env, v8::Local<v8::Object> object);
+  // A datagram read by recvmmsg() that has not been handed to JS yet.
+  struct BatchedMessage {
+    char* base;
+    size_t length;
+    bool has_addr;
+    sockaddr_storage addr;
+  };
+
+  UDPWrap(Environment* env,
+          v8::Local<v8::Object> object,
+          uint32_t recv_batch_size);
+
+  void EmitMessageBatch();
 
   static void DoBind(const v8::FunctionCallbackInfo<v8::Value>& args,
                      int family);
@@ -93,6 +109,11 @@ class UDPWrap: public HandleWrap {
                      unsigned int flags);
 
   uv_udp_t handle_;
+
+  // Receive buffer shared by all recvmmsg() calls when batching is enabled.
+  char* recv_slab_ = nullptr;
+  size_t recv_slab_size_ = 0;
+  std::vector<BatchedMessage> recv_batch_;
 };
 
 }  // namespace node
@@ -3,6 +3,9 @@
 #include <stddef.h>
 #include <string.h>
 
+#include <algorithm>
+#include <string>
+
 #include "gtest/gtest.h"
 
 using node::base64_encode;
@@ -125,3 +128,52 @@ TEST(Base64Test, Decode) {
        "dCBjdXBpZGF0YXQgbm9uIHByb2lkZW50LCBzdW50IGluIGN1bHBhIHF1aSBvZmZpY2lh\n"
        "IGRlc2VydW50IG1vbGxpdCBhbmltIGlkIGVzdCBsYWJvcnVtLg", text);
 }
+
+// Long enough to exercise the vectorized code paths, including the switch back
+// and forth between them and the scalar code around whitespace and padding.
+TEST(Base64Test, LongRoundTrip) {
+  for (size_t len = 0; len < 300; len += 1) {
+    std::string input(len, '\0');
+    for (size_t i = 0; i < len; i += 1)
+      input[i] = static_cast<char>(i * 7 + len);
+
+    const size_t encoded_len = base64_encoded_size(len);
+    std::string encoded(encoded_len, '\0');
+    EXPECT_EQ(encoded_len,
+              base64_encode(input.data(), len, &encoded[0], encoded_len));
+
+    std::string decoded(len, '\0');
+    EXPECT_EQ(len, base64_decode(&decoded[0], len,
+                                 encoded.data(), encoded.size()));
+    EXPECT_EQ(input, decoded);
+
+    // Wrap lines MIME-style.
+    std::string wrapped;
+    for (size_t i = 0; i < encoded.size(); i += 76)
+      wrapped += encoded.substr(i, 76) + "\r\n";
+    std::fill(decoded.begin(), decoded.end(), '\0');
+    EXPECT_EQ(len, base64_decode(&decoded[0], len,
+                                 wrapped.data(), wrapped.size()));
+    EXPECT_EQ(input, decoded);
+
+    // The URL-safe alphabet decodes to the same bytes.
+    std::string url_safe = encoded;
+    std::replace(url_safe.begin(), url_safe.end(), '+', '-');
+    std::replace(url_safe.begin(), url_safe.end(), '/', '_');
+    std::fill(decoded.begin(), decoded.end(), '\0');
+    EXPECT_EQ(len, base64_decode(&decoded[0], len,
+                                 url_safe.data(), url_safe.size()));
+    EXPECT_EQ(input, decoded);
+  }
+}
+
+TEST(Base64Test, DecodeDoesNotWritePastResult) {
+  // Decoding stops at the first '=', the bytes after that must be untouched.
+  const std::string encoded =
+      std::string(64, 'A') + "==" + std::string(64, 'A');
+  std::string decoded(96, 'x');
+  EXPECT_EQ(48u, base64_decode(&decoded[0], decoded.size(),
+                               encoded.data(), encoded.size()));
+  EXPECT_EQ(std::string(48, '\0'), decoded.substr(0, 48));
+  EXPECT_EQ(std::string(48, 'x'), decoded.substr(48));
+}
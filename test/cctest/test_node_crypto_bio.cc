@@ -0,0 +1,71 @@
+#include "node_crypto_bio.h"
+
+#include <string.h>
+
+#include "gtest/gtest.h"
+
+using node::crypto::NodeBIO;
+
+namespace {
+
+// Fills the buffer that PeekWritable() hands out, the way a socket read that
+// fills it completely does, and returns its length.
+size_t FillWritable(NodeBIO* bio) {
+  size_t size = 0;
+  char* data = bio->PeekWritable(&size);
+  memset(data, 'x', size);
+  bio->Commit(size);
+  return size;
+}
+
+void Drain(NodeBIO* bio) {
+  char out[4096];
+  while (bio->Length() > 0)
+    bio->Read(out, sizeof(out));
+}
+
+}  // anonymous namespace
+
+TEST(NodeBIOTest, GrowsUnderLoad) {
+  NodeBIO bio;
+  size_t size = FillWritable(&bio);
+  EXPECT_EQ(size, 1024u);
+  for (int i = 0; i < 8; i++) {
+    FillWritable(&bio);
+    Drain(&bio);
+  }
+  EXPECT_EQ(FillWritable(&bio), 16384u);
+  Drain(&bio);
+}
+
+TEST(NodeBIOTest, EmptyReadsDoNotShrink) {
+  NodeBIO bio;
+  for (int i = 0; i < 8; i++) {
+    FillWritable(&bio);
+    Drain(&bio);
+  }
+
+  // A read that returns EAGAIN commits nothing to the buffer it was given.
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(FillWritable(&bio), 16384u);
+    Drain(&bio);
+    size_t size = 0;
+    bio.PeekWritable(&size);
+    bio.Commit(0);
+  }
+}
+
+TEST(NodeBIOTest, ShrinksAfterSmallBursts) {
+  NodeBIO bio;
+  for (int i = 0; i < 8; i++) {
+    FillWritable(&bio);
+    Drain(&bio);
+  }
+
+  for (int i = 0; i < 8; i++) {
+    bio.Write("x", 1);
+    Drain(&bio);
+  }
+  EXPECT_EQ(FillWritable(&bio), 1024u);
+  Drain(&bio);
+}
@@ -0,0 +1,257 @@
+#include "tracing/node_trace_buffer.h"
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "node_mutex.h"
+#include "uv.h"
+
+using node::ConditionVariable;
+using node::Mutex;
+using node::tracing::Agent;
+using node::tracing::AsyncTraceWriter;
+using node::tracing::InternalTraceBuffer;
+using node::tracing::NodeTraceBuffer;
+using v8::platform::tracing::TraceBufferChunk;
+using v8::platform::tracing::TraceObject;
+
+namespace {
+
+const uint8_t kCategoryEnabled = 1;
+
+// Collects the ids of the events that the buffers flush.
+class RecordingWriter : public AsyncTraceWriter {
+ public:
+  void AppendTraceEvent(TraceObject* trace_event) override {
+    Mutex::ScopedLock scoped_lock(mutex_);
+    ids_.push_back(trace_event->id());
+  }
+
+  void Flush(bool blocking) override {}
+
+  std::vector<uint64_t> ids() {
+    Mutex::ScopedLock scoped_lock(mutex_);
+    return ids_;
+  }
+
+ private:
+  Mutex mutex_;
+  std::vector<uint64_t> ids_;
+};
+
+// The Agent hands flushed events to its clients. It starts a tracing thread
+// that is never stopped, so all tests share a single one.
+Agent* GetAgent() {
+  static const std::string* log_file_pattern = new std::string();
+  static Agent* agent = new Agent(*log_file_pattern);
+  return agent;
+}
+
+class NodeTraceBufferTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    writer_ = new RecordingWriter();
+    client_ = GetAgent()->AddClient(std::set<std::string>(),
+                                    std::unique_ptr<AsyncTraceWriter>(writer_));
+  }
+
+  void TearDown() override {
+    client_.reset();
+  }
+
+  RecordingWriter* writer_;
+  Agent::ClientHandle client_ = Agent::EmptyClientHandle();
+};
+
+void InitializeEvent(TraceObject* trace_object, uint64_t id) {
+  trace_object->Initialize('X', &kCategoryEnabled, "test", nullptr, id, 0, 0,
+                           nullptr, nullptr, nullptr, nullptr, 0, 0, 0);
+}
+
+const int kAppendThreads = 4;
+const uint64_t kEventsPerThread = 50000;
+
+struct AppendTest {
+  InternalTraceBuffer* buffer;
+  // Appending threads hold this for reading while they add and fill in an
+  // event, the flushing thread holds it for writing. Only needed when the
+  // contents of the events are checked, see AddTraceEvent().
+  uv_rwlock_t* initialize_lock;
+  Mutex mutex;
+  // Signaled as the appending threads make progress, so that flushes are
+  // interleaved with appends instead of keeping the buffer busy all the time.
+  ConditionVariable cond;
+  uint64_t progress = 0;
+  int running = kAppendThreads;
+  uint64_t added = 0;
+};
+
+struct AppendThread {
+  AppendTest* test;
+  uint64_t first_id;
+  uv_thread_t thread;
+};
+
+void Append(void* arg) {
+  AppendThread* self = static_cast<AppendThread*>(arg);
+  AppendTest* test = self->test;
+  uint64_t added = 0;
+  for (uint64_t i = 0; i < kEventsPerThread; i++) {
+    if (test->initialize_lock != nullptr)
+      uv_rwlock_rdlock(test->initialize_lock);
+    uint64_t handle;
+    TraceObject* trace_object = test->buffer->AddTraceEvent(&handle);
+    if (trace_object != nullptr) {
+      InitializeEvent(trace_object, self->first_id + i);
+      added++;
+    }
+    if (test->initialize_lock != nullptr)
+      uv_rwlock_rdunlock(test->initialize_lock);
+    if (i % 256 == 0) {
+      Mutex::ScopedLock scoped_lock(test->mutex);
+      test->progress++;
+      test->cond.Signal(scoped_lock);
+    }
+  }
+  Mutex::ScopedLock scoped_lock(test->mutex);
+  test->added += added;
+  test->running--;
+  test->cond.Signal(scoped_lock);
+}
+
+// Appends from several threads while the current thread flushes, and returns
+// the number of events that were added. Events that do not fit while the
+// buffer is full are dropped.
+uint64_t AppendWhileFlushing(InternalTraceBuffer* buffer,
+                             uv_rwlock_t* initialize_lock) {
+  AppendTest test;
+  test.buffer = buffer;
+  test.initialize_lock = initialize_lock;
+  AppendThread threads[kAppendThreads];
+  for (int i = 0; i < kAppendThreads; i++) {
+    threads[i].test = &test;
+    threads[i].first_id = 1 + i * kEventsPerThread;
+    EXPECT_EQ(0, uv_thread_create(&threads[i].thread, Append, &threads[i]));
+  }
+
+  uint64_t progress = 0;
+  for (;;) {
+    {
+      Mutex::ScopedLock scoped_lock(test.mutex);
+      while (test.running != 0 && test.progress == progress)
+        test.cond.Wait(scoped_lock);
+      if (test.running == 0)
+        break;
+      progress = test.progress;
+    }
+    if (initialize_lock != nullptr)
+      uv_rwlock_wrlock(initialize_lock);
+    buffer->Flush(true);
+    if (initialize_lock != nullptr)
+      uv_rwlock_wrunlock(initialize_lock);
+  }
+
+  for (int i = 0; i < kAppendThreads; i++)
+    EXPECT_EQ(0, uv_thread_join(&threads[i].thread));
+  buffer->Flush(true);
+  return test.added;
+}
+
+}  // anonymous namespace
+
+TEST_F(NodeTraceBufferTest, ConcurrentFlushDeliversEveryEventOnce) {
+  InternalTraceBuffer buffer(16, 0, GetAgent());
+  uint64_t added = AppendWhileFlushing(&buffer, nullptr);
+  EXPECT_GT(added, 0u);
+  EXPECT_EQ(writer_->ids().size(), added);
+}
+
+TEST_F(NodeTraceBufferTest, ConcurrentFlushDeliversEventContents) {
+  InternalTraceBuffer buffer(16, 0, GetAgent());
+  uv_rwlock_t initialize_lock;
+  ASSERT_EQ(0, uv_rwlock_init(&initialize_lock));
+  uint64_t added = AppendWhileFlushing(&buffer, &initialize_lock);
+  uv_rwlock_destroy(&initialize_lock);
+
+  std::vector<uint64_t> ids = writer_->ids();
+  std::set<uint64_t> unique_ids(ids.begin(), ids.end());
+  EXPECT_EQ(ids.size(), added);
+  EXPECT_EQ(unique_ids.size(), added);
+  EXPECT_EQ(unique_ids.count(0), 0u);
+}
+
+TEST_F(NodeTraceBufferTest, FlushInvalidatesHandles) {
+  InternalTraceBuffer buffer(4, 0, GetAgent());
+  uint64_t handle;
+  TraceObject* trace_object = buffer.AddTraceEvent(&handle);
+  ASSERT_NE(trace_object, nullptr);
+  InitializeEvent(trace_object, 1);
+  EXPECT_EQ(buffer.GetEventByHandle(handle), trace_object);
+
+  buffer.Flush(true);
+  EXPECT_EQ(buffer.GetEventByHandle(handle), nullptr);
+
+  // The chunk is reused, old handles still do not refer to it.
+  uint64_t new_handle;
+  TraceObject* new_trace_object = buffer.AddTraceEvent(&new_handle);
+  ASSERT_NE(new_trace_object, nullptr);
+  EXPECT_NE(new_handle, handle);
+  EXPECT_EQ(buffer.GetEventByHandle(handle), nullptr);
+  EXPECT_EQ(buffer.GetEventByHandle(new_handle), new_trace_object);
+  EXPECT_EQ(buffer.GetEventByHandle(0), nullptr);
+}
+
+namespace {
+
+void RunLoop(void* arg) {
+  uv_run(static_cast<uv_loop_t*>(arg), UV_RUN_DEFAULT);
+}
+
+}  // anonymous namespace
+
+TEST_F(NodeTraceBufferTest, FallsBackToOtherBuffer) {
+  // The loop only runs once the buffer is destroyed, so that the flushes
+  // that a full buffer requests do not happen in the middle of the test.
+  uv_loop_t loop;
+  ASSERT_EQ(0, uv_loop_init(&loop));
+  std::unique_ptr<NodeTraceBuffer> buffer(
+      new NodeTraceBuffer(1, GetAgent(), &loop));
+
+  uint64_t handle;
+  for (size_t i = 0; i < TraceBufferChunk::kChunkSize; i++) {
+    TraceObject* trace_object = buffer->AddTraceEvent(&handle);
+    ASSERT_NE(trace_object, nullptr);
+    InitializeEvent(trace_object, 1 + i);
+    EXPECT_EQ(handle & 0x1, 0u);
+  }
+
+  // The first buffer is full.
+  TraceObject* trace_object = buffer->AddTraceEvent(&handle);
+  ASSERT_NE(trace_object, nullptr);
+  InitializeEvent(trace_object, 1 + TraceBufferChunk::kChunkSize);
+  EXPECT_EQ(handle & 0x1, 1u);
+  EXPECT_EQ(buffer->GetEventByHandle(handle), trace_object);
+  for (size_t i = 1; i < TraceBufferChunk::kChunkSize; i++) {
+    trace_object = buffer->AddTraceEvent(&handle);
+    ASSERT_NE(trace_object, nullptr);
+    InitializeEvent(trace_object, 1 + TraceBufferChunk::kChunkSize + i);
+    EXPECT_EQ(handle & 0x1, 1u);
+  }
+
+  // Both buffers are full.
+  EXPECT_EQ(buffer->AddTraceEvent(&handle), nullptr);
+  EXPECT_EQ(handle, 0u);
+
+  EXPECT_TRUE(buffer->Flush());
+  EXPECT_EQ(writer_->ids().size(), 2 * TraceBufferChunk::kChunkSize);
+  EXPECT_NE(buffer->AddTraceEvent(&handle), nullptr);
+
+  uv_thread_t thread;
+  ASSERT_EQ(0, uv_thread_create(&thread, RunLoop, &loop));
+  buffer.reset();
+  ASSERT_EQ(0, uv_thread_join(&thread));
+  EXPECT_EQ(0, uv_loop_close(&loop));
+}
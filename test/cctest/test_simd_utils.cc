@@ -0,0 +1,118 @@
+#include "simd_utils.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+using node::simd::AsciiPrefixLength;
+using node::simd::ForceAsciiPrefix;
+using node::simd::HexDecodePrefix;
+using node::simd::HexEncodePrefix;
+using node::simd::ValidateUtf8;
+
+namespace {
+
+bool IsValid(const std::string& s) {
+  return ValidateUtf8(s.data(), s.size());
+}
+
+}  // anonymous namespace
+
+TEST(SimdUtilsTest, ValidateUtf8) {
+  EXPECT_TRUE(IsValid(""));
+  EXPECT_TRUE(IsValid("hello"));
+  EXPECT_TRUE(IsValid("\xc2\x80"));
+  EXPECT_TRUE(IsValid("\xef\xbf\xbf"));
+  EXPECT_TRUE(IsValid("\xf0\x90\x80\x80"));
+  EXPECT_TRUE(IsValid("\xf4\x8f\xbf\xbf"));
+
+  EXPECT_FALSE(IsValid("\x80"));
+  EXPECT_FALSE(IsValid("\xc0\x80"));  // Overlong.
+  EXPECT_FALSE(IsValid("\xe0\x9f\xbf"));  // Overlong.
+  EXPECT_FALSE(IsValid("\xf0\x8f\xbf\xbf"));  // Overlong.
+  EXPECT_FALSE(IsValid("\xed\xa0\x80"));  // Surrogate.
+  EXPECT_FALSE(IsValid("\xf4\x90\x80\x80"));  // Above U+10FFFF.
+  EXPECT_FALSE(IsValid("\xf5\x80\x80\x80"));
+  EXPECT_FALSE(IsValid("\xff"));
+  EXPECT_FALSE(IsValid("\xe2\x82"));  // Truncated.
+
+  // Move every case across block boundaries of the vectorized code.
+  const char* const valid[] = {
+    "\xc2\x80", "\xe2\x82\xac", "\xf0\x9f\x98\x80"
+  };
+  const char* const invalid[] = {
+    "\xc0\x80", "\xed\xa0\x80", "\xf4\x90\x80\x80", "\xe2\x82", "\x80\x80"
+  };
+  for (size_t pad = 0; pad < 70; pad += 1) {
+    const std::string prefix(pad, 'a');
+    for (const char* s : valid) {
+      EXPECT_TRUE(IsValid(prefix + s));
+      EXPECT_TRUE(IsValid(prefix + s + std::string(40, 'b')));
+      EXPECT_TRUE(IsValid(prefix + s + s + s + s + s + s + s + s));
+    }
+    for (const char* s : invalid) {
+      EXPECT_FALSE(IsValid(prefix + s));
+      EXPECT_FALSE(IsValid(prefix + s + std::string(40, 'b')));
+      EXPECT_FALSE(IsValid(prefix + "\xe2\x82\xac" + s + "\xe2\x82\xac"));
+    }
+  }
+}
+
+TEST(SimdUtilsTest, Ascii) {
+  for (size_t len = 0; len < 300; len += 7) {
+    for (size_t pos = 0; pos < len; pos += 5) {
+      std::string s(len, 'x');
+      s[pos] = '\xe9';
+      EXPECT_LE(AsciiPrefixLength(s.data(), s.size()), pos);
+
+      std::string out(len, '#');
+      const size_t n = ForceAsciiPrefix(s.data(), &out[0], s.size());
+      EXPECT_LE(n, len);
+      for (size_t i = 0; i < n; i += 1)
+        EXPECT_EQ(s[i] & 0x7f, out[i]);
+      EXPECT_EQ(std::string(len - n, '#'), out.substr(n));
+    }
+    const std::string s(len, 'x');
+    EXPECT_LE(AsciiPrefixLength(s.data(), s.size()), len);
+  }
+}
+
+TEST(SimdUtilsTest, Hex) {
+  static const char digits[] = "0123456789abcdef";
+  for (size_t len = 0; len < 300; len += 1) {
+    std::string input(len, '\0');
+    std::string hex;
+    for (size_t i = 0; i < len; i += 1) {
+      input[i] = static_cast<char>(i * 13 + len);
+      hex += digits[static_cast<uint8_t>(input[i]) >> 4];
+      hex += digits[static_cast<uint8_t>(input[i]) & 15];
+    }
+
+    std::string encoded(2 * len, '#');
+    const size_t consumed = HexEncodePrefix(input.data(), len, &encoded[0]);
+    EXPECT_LE(consumed, len);
+    EXPECT_EQ(hex.substr(0, 2 * consumed), encoded.substr(0, 2 * consumed));
+    EXPECT_EQ(std::string(2 * (len - consumed), '#'),
+              encoded.substr(2 * consumed));
+
+    std::string upper = hex;
+    for (char& c : upper)
+      c = toupper(c);
+    std::string decoded(len, '#');
+    size_t written = HexDecodePrefix(&decoded[0], len,
+                                     upper.data(), upper.size());
+    EXPECT_LE(written, len);
+    EXPECT_EQ(input.substr(0, written), decoded.substr(0, written));
+    EXPECT_EQ(std::string(len - written, '#'), decoded.substr(written));
+
+    // Decoding stops before an invalid character.
+    if (len > 0) {
+      upper[len] = 'g';
+      written = HexDecodePrefix(&decoded[0], len, upper.data(), upper.size());
+      EXPECT_LE(2 * written, len);
+    }
+  }
+}
@@ -14,9 +14,12 @@ runBenchmark('crypto',
              [
                'algo=sha256',
                'api=stream',
+               'batch=1',
                'cipher=',
+               'concurrency=1',
                'keylen=1024',
                'len=1',
+               'mode=async',
                'n=1',
                'out=buffer',
                'type=buf',
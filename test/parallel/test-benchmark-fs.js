@@ -16,5 +16,6 @@ runBenchmark('fs', [
   'statType=fstat',
   'statSyncType=fstatSync',
   'encodingType=buf',
-  'filesize=1024'
+  'filesize=1024',
+  'iterations=1'
 ], { NODE_TMPDIR: tmpdir.path, NODEJS_BENCHMARK_ZERO_ALLOWED: 1 });
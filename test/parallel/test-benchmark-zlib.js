@@ -11,6 +11,7 @@ runBenchmark('zlib',
                'options=true',
                'type=Deflate',
                'inputLen=1024',
+               'level=1',
                'duration=0.001'
              ],
              {
@@ -29,6 +29,7 @@ expect('--v8-pool-size=10', 'B\n');
 expect('--trace-event-categories node', 'B\n');
 // eslint-disable-next-line no-template-curly-in-string
 expect('--trace-event-file-pattern {pid}-${rotation}.trace_events', 'B\n');
+expect('--trace-event-format=json', 'B\n');
 
 if (!common.isWindows) {
   expect('--perf-basic-prof', 'B\n');
@@ -0,0 +1,149 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const crypto = require('crypto');
+
+const key = Buffer.alloc(32, 'k');
+const iv = Buffer.alloc(12, 'i');
+const plaintext = Buffer.alloc(100 * 1024);
+for (let i = 0; i < plaintext.length; i++)
+  plaintext[i] = i % 251;
+
+function encrypt(data) {
+  const cipher = crypto.createCipheriv('aes-256-gcm', key, iv);
+  const ciphertext = Buffer.concat([cipher.update(data), cipher.final()]);
+  return { ciphertext, authTag: cipher.getAuthTag() };
+}
+
+const expected = encrypt(plaintext);
+
+// Synchronously, into a separate buffer and in place.
+{
+  const cipher = crypto.createCipheriv('aes-256-gcm', key, iv);
+  const output = Buffer.alloc(plaintext.length + 16);
+  const small = plaintext.slice(0, 1000);
+  assert.strictEqual(cipher.updateInto(small, output), small.length);
+  const rest = Buffer.from(plaintext.slice(small.length));
+  assert.strictEqual(cipher.updateInto(rest, rest), rest.length);
+  assert.strictEqual(cipher.final().length, 0);
+  assert.deepStrictEqual(Buffer.concat([output.slice(0, small.length), rest]),
+                         expected.ciphertext);
+  assert.deepStrictEqual(cipher.getAuthTag(), expected.authTag);
+}
+
+// Asynchronously, in place, and at an offset in the output.
+{
+  const cipher = crypto.createCipheriv('aes-256-gcm', key, iv);
+  const data = Buffer.from(plaintext);
+  cipher.updateInto(data, data, common.mustCall((err, bytesWritten) => {
+    assert.ifError(err);
+    assert.strictEqual(bytesWritten, data.length);
+    cipher.final();
+    assert.deepStrictEqual(data, expected.ciphertext);
+    assert.deepStrictEqual(cipher.getAuthTag(), expected.authTag);
+
+    const decipher = crypto.createDecipheriv('aes-256-gcm', key, iv);
+    decipher.setAuthTag(expected.authTag);
+    const output = Buffer.alloc(data.length + 10);
+    decipher.updateInto(data, output, 10, common.mustCall((err, n) => {
+      assert.ifError(err);
+      assert.strictEqual(n, data.length);
+      decipher.final();
+      assert.deepStrictEqual(output.slice(10), plaintext);
+    }));
+  }));
+
+  // The cipher cannot be used while data is being processed.
+  common.expectsError(() => cipher.update(plaintext), {
+    code: 'ERR_CRYPTO_INVALID_STATE',
+    type: Error
+  });
+  common.expectsError(() => cipher.final(), {
+    code: 'ERR_CRYPTO_INVALID_STATE',
+    type: Error
+  });
+  common.expectsError(() => cipher.setAutoPadding(false), {
+    code: 'ERR_CRYPTO_INVALID_STATE',
+    type: Error
+  });
+  common.expectsError(() => cipher.setAAD(Buffer.alloc(16)), {
+    code: 'ERR_CRYPTO_INVALID_STATE',
+    type: Error
+  });
+  common.expectsError(() => cipher.setAuthTag(expected.authTag), {
+    code: 'ERR_CRYPTO_INVALID_STATE',
+    type: Error
+  });
+}
+
+// Small inputs are processed synchronously, but the callback is still
+// called asynchronously.
+{
+  const cipher = crypto.createCipheriv('aes-256-gcm', key, iv);
+  const output = Buffer.alloc(100);
+  let sync = true;
+  cipher.updateInto(plaintext.slice(0, 100), output,
+                    common.mustCall((err, bytesWritten) => {
+                      assert.ifError(err);
+                      assert.strictEqual(sync, false);
+                      assert.strictEqual(bytesWritten, 100);
+                      assert.deepStrictEqual(
+                        output, expected.ciphertext.slice(0, 100));
+                    }));
+  sync = false;
+}
+
+// Block ciphers may hold back data until the next call, or write up to one
+// block more than their input.
+{
+  const cipher = crypto.createCipheriv('aes-128-cbc', key.slice(0, 16),
+                                       Buffer.alloc(16));
+  const output = Buffer.alloc(64);
+  assert.strictEqual(cipher.updateInto(Buffer.alloc(10), output), 0);
+  assert.strictEqual(cipher.updateInto(Buffer.alloc(10), output), 16);
+  common.expectsError(() => cipher.updateInto(Buffer.alloc(10), output, 60), {
+    code: 'ERR_BUFFER_OUT_OF_BOUNDS',
+    type: RangeError
+  });
+}
+
+// Streams created with `{ async: true }` produce the same output.
+{
+  const cipher = crypto.createCipheriv('aes-256-gcm', key, iv, { async: true });
+  const chunks = [];
+  cipher.on('data', (chunk) => chunks.push(chunk));
+  cipher.on('end', common.mustCall(() => {
+    assert.deepStrictEqual(Buffer.concat(chunks), expected.ciphertext);
+    assert.deepStrictEqual(cipher.getAuthTag(), expected.authTag);
+  }));
+  cipher.write(plaintext.slice(0, 10));
+  cipher.write(plaintext.slice(10, 50 * 1024));
+  cipher.end(plaintext.slice(50 * 1024));
+}
+
+{
+  const cipher = crypto.createCipheriv('aes-256-gcm', key, iv);
+  for (const data of ['string', 1, null]) {
+    common.expectsError(() => cipher.updateInto(data, Buffer.alloc(10)), {
+      code: 'ERR_INVALID_ARG_TYPE',
+      type: TypeError
+    });
+  }
+  common.expectsError(() => cipher.updateInto(Buffer.alloc(1), 'x'), {
+    code: 'ERR_INVALID_ARG_TYPE',
+    type: TypeError
+  });
+  common.expectsError(() => cipher.updateInto(Buffer.alloc(1),
+                                              Buffer.alloc(1), 2), {
+    code: 'ERR_OUT_OF_RANGE',
+    type: RangeError
+  });
+  common.expectsError(() => cipher.updateInto(Buffer.alloc(1),
+                                              Buffer.alloc(1), 0, 'cb'), {
+    code: 'ERR_INVALID_CALLBACK',
+    type: TypeError
+  });
+}
@@ -0,0 +1,96 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const crypto = require('crypto');
+
+function expected(algorithm, data, encoding) {
+  return crypto.createHash(algorithm).update(data).digest(encoding);
+}
+
+// One-shot hashing of a single input.
+for (const data of ['', 'abc', Buffer.from('abc'), new Uint8Array(100)]) {
+  const digest = expected('sha256', data);
+  assert.deepStrictEqual(crypto.hashSync('sha256', data), digest);
+  assert.strictEqual(crypto.hashSync('sha256', data, 'hex'),
+                     digest.toString('hex'));
+  crypto.hash('sha256', data, common.mustCall((err, result) => {
+    assert.ifError(err);
+    assert.deepStrictEqual(result, digest);
+  }));
+}
+
+// A batch of inputs results in an array of digests, in the same order.
+{
+  const inputs = [];
+  for (let i = 0; i < 100; i++)
+    inputs.push(i % 2 ? `input ${i}` : Buffer.alloc(i, i));
+  const digests = inputs.map((input) => expected('sha1', input, 'hex'));
+  assert.deepStrictEqual(crypto.hashSync('sha1', inputs, 'hex'), digests);
+  crypto.hash('sha1', inputs, 'hex', common.mustCall((err, result) => {
+    assert.ifError(err);
+    assert.deepStrictEqual(result, digests);
+  }));
+  crypto.hash('md5', [], common.mustCall((err, result) => {
+    assert.ifError(err);
+    assert.deepStrictEqual(result, []);
+  }));
+}
+
+// Hashes created with `{ async: true }` produce the same digests as regular
+// ones, whether or not the chunks are large enough to be offloaded.
+{
+  const chunks = [Buffer.alloc(10, 'a'), Buffer.alloc(64 * 1024, 'b'),
+                  'c', Buffer.alloc(20 * 1024, 'd')];
+  const hash = crypto.createHash('sha512');
+  chunks.forEach((chunk) => hash.update(chunk));
+  const digest = hash.digest();
+
+  const asyncHash = crypto.createHash('sha512', { async: true });
+  asyncHash.on('data', common.mustCall((result) => {
+    assert.deepStrictEqual(result, digest);
+  }));
+  chunks.forEach((chunk) => asyncHash.write(chunk));
+  asyncHash.end();
+
+  // The hash cannot be used synchronously while a chunk is being hashed.
+  common.expectsError(() => asyncHash.update('x'), {
+    code: 'ERR_CRYPTO_INVALID_STATE',
+    type: Error
+  });
+}
+
+common.expectsError(() => crypto.hashSync('nope', 'abc'), {
+  code: 'ERR_CRYPTO_INVALID_DIGEST',
+  type: TypeError,
+  message: 'Invalid digest: nope'
+});
+
+common.expectsError(() => crypto.hash('nope', 'abc', common.mustNotCall()), {
+  code: 'ERR_CRYPTO_INVALID_DIGEST',
+  type: TypeError
+});
+
+common.expectsError(() => crypto.hash('sha1', 'abc'), {
+  code: 'ERR_INVALID_CALLBACK',
+  type: TypeError
+});
+
+common.expectsError(() => crypto.hashSync('sha1', 'abc', 'utf16le'), {
+  code: 'ERR_CRYPTO_HASH_DIGEST_NO_UTF16',
+  type: Error
+});
+
+for (const data of [1, null, {}, ['a', 1]]) {
+  common.expectsError(() => crypto.hashSync('sha1', data), {
+    code: 'ERR_INVALID_ARG_TYPE',
+    type: TypeError
+  });
+}
+
+common.expectsError(() => crypto.hashSync(1, 'abc'), {
+  code: 'ERR_INVALID_ARG_TYPE',
+  type: TypeError
+});
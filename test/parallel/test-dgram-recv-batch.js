@@ -0,0 +1,56 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const dgram = require('dgram');
+
+const N = 50;
+
+for (const recvBatchSize of [0, 21, 1.5]) {
+  common.expectsError(() => {
+    dgram.createSocket({ type: 'udp4', recvBatchSize });
+  }, {
+    code: 'ERR_OUT_OF_RANGE',
+    type: RangeError
+  });
+}
+
+common.expectsError(() => {
+  dgram.createSocket({ type: 'udp4', recvBatchSize: '8' });
+}, {
+  code: 'ERR_INVALID_ARG_TYPE',
+  type: TypeError
+});
+
+const receiver = dgram.createSocket({ type: 'udp4', recvBatchSize: 8 });
+const sender = dgram.createSocket('udp4');
+const seen = new Set();
+
+receiver.on('message', common.mustCall((msg, rinfo) => {
+  // Datagrams have different sizes so that a wrong offset into the batch
+  // buffer would be noticed.
+  const n = +msg.toString();
+  assert.strictEqual(msg.length, String(n).length);
+  assert.strictEqual(rinfo.size, msg.length);
+  assert.strictEqual(rinfo.address, '127.0.0.1');
+  assert.strictEqual(rinfo.port, sender.address().port);
+  assert.strictEqual(rinfo.family, 'IPv4');
+  seen.add(n);
+
+  if (seen.size === N) {
+    receiver.close();
+    sender.close();
+  }
+}, N));
+
+receiver.bind(0, '127.0.0.1', common.mustCall(() => {
+  sender.bind(0, '127.0.0.1', common.mustCall(() => {
+    const port = receiver.address().port;
+    for (let i = 1; i <= N; i++)
+      sender.send(String(i * 997), port, '127.0.0.1');
+  }));
+}));
+
+process.on('exit', () => {
+  for (let i = 1; i <= N; i++)
+    assert(seen.has(i * 997));
+});
@@ -29,3 +29,14 @@ assert.strictEqual(flist1.free('test5'), false);
 assert.strictEqual(flist1.alloc(), 'test3');
 assert.strictEqual(flist1.alloc(), 'test2');
 assert.strictEqual(flist1.alloc(), 'test1');
+
+assert.strictEqual(flist1.created, 1);
+assert.strictEqual(flist1.reused, 3);
+assert.strictEqual(flist1.discarded, 2);
+
+// Lowering the maximum hands back the objects that no longer fit
+assert(flist1.free('test6'));
+assert(flist1.free('test7'));
+assert.deepStrictEqual(flist1.setMax(1), ['test7']);
+assert.deepStrictEqual(flist1.setMax(3), []);
+assert.deepStrictEqual(flist1.list, ['test6']);
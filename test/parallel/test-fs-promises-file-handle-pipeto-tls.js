@@ -0,0 +1,122 @@
+'use strict';
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+// FileHandle.pipeTo() on a TLS socket writes the file to it natively, in order
+// with what is written to the socket from JS before and after, and fails
+// cleanly when the peer resets the connection.
+
+const fixtures = require('../common/fixtures');
+const fs = require('fs');
+const path = require('path');
+const tls = require('tls');
+const { open } = fs.promises;
+const tmpdir = require('../common/tmpdir');
+const assert = require('assert');
+
+tmpdir.refresh();
+common.crashOnUnhandledRejection();
+
+const filePath = path.join(tmpdir.path, 'tmp-pipe-to-tls.bin');
+const data = Buffer.alloc(4 * 1024 * 1024);
+for (let i = 0; i < data.length; i += 1)
+  data[i] = i % 251;
+fs.writeFileSync(filePath, data);
+
+const options = {
+  key: fixtures.readKey('agent1-key.pem'),
+  cert: fixtures.readKey('agent1-cert.pem')
+};
+
+function transfer(pipeOptions, prefix, suffix) {
+  let bytesSent;
+  const sent = new Promise((resolve, reject) => {
+    const server = tls.createServer(options, async (socket) => {
+      server.close();
+      const filehandle = await open(filePath, 'r');
+      try {
+        socket.write(prefix);
+        bytesSent = await filehandle.pipeTo(socket, pipeOptions);
+        socket.end(suffix);
+        resolve();
+      } catch (err) {
+        reject(err);
+      } finally {
+        await filehandle.close();
+      }
+    });
+    server.listen(0, () => received(server.address().port));
+  });
+  let received;
+  const contents = new Promise((resolve) => {
+    received = (port) => {
+      const chunks = [];
+      const client = tls.connect({ port, rejectUnauthorized: false });
+      client.on('data', (chunk) => chunks.push(chunk));
+      client.on('end', () => resolve(Buffer.concat(chunks)));
+    };
+  });
+  return Promise.all([sent, contents])
+    .then(([, data]) => ({ bytesSent, data }));
+}
+
+const resetCodes = [
+  'EPIPE',
+  'ECONNRESET',
+  'ECANCELED',
+  'ERR_SOCKET_CLOSED',
+  'ERR_STREAM_DESTROYED'
+];
+
+function reset() {
+  return new Promise((resolve, reject) => {
+    const server = tls.createServer(options, async (socket) => {
+      server.close();
+      socket.on('error', () => {});
+      const filehandle = await open(filePath, 'r');
+      try {
+        // Keep sending until the reset shows, the kernel may take a whole
+        // transfer before that.
+        await assert.rejects(async () => {
+          for (;;)
+            await filehandle.pipeTo(socket);
+        }, (err) => resetCodes.includes(err.code));
+        resolve();
+      } catch (err) {
+        reject(err);
+      } finally {
+        await filehandle.close();
+      }
+    });
+    server.listen(0, () => {
+      const client = tls.connect({
+        port: server.address().port,
+        rejectUnauthorized: false
+      });
+      // Closing with unread data makes the kernel send a RST.
+      client.once('data', () => client.destroy());
+    });
+  });
+}
+
+async function validate() {
+  const prefix = Buffer.from('prefix');
+  const suffix = Buffer.from('suffix');
+
+  let result = await transfer(undefined, prefix, suffix);
+  assert.strictEqual(result.bytesSent, data.length);
+  assert.deepStrictEqual(result.data, Buffer.concat([prefix, data, suffix]));
+
+  result = await transfer({ offset: 1000, length: 1234567 }, prefix, suffix);
+  assert.strictEqual(result.bytesSent, 1234567);
+  assert.deepStrictEqual(result.data,
+                         Buffer.concat([prefix,
+                                        data.slice(1000, 1000 + 1234567),
+                                        suffix]));
+
+  await reset();
+}
+
+validate().then(common.mustCall());
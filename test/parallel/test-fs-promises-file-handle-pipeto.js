@@ -0,0 +1,123 @@
+'use strict';
+
+const common = require('../common');
+
+// The following tests validate base functionality for the fs.promises
+// FileHandle.pipeTo method, both on sockets (which use sendfile() where
+// available) and on other writable streams.
+
+const fs = require('fs');
+const net = require('net');
+const path = require('path');
+const { Writable } = require('stream');
+const { open } = fs.promises;
+const tmpdir = require('../common/tmpdir');
+const assert = require('assert');
+
+tmpdir.refresh();
+common.crashOnUnhandledRejection();
+
+const filePath = path.join(tmpdir.path, 'tmp-pipe-to.bin');
+// Large enough to fill up the socket buffer a couple of times.
+const data = Buffer.alloc(4 * 1024 * 1024);
+for (let i = 0; i < data.length; i += 1)
+  data[i] = i % 251;
+fs.writeFileSync(filePath, data);
+
+// Sends the requested part of the file over a TCP connection, surrounded by
+// `prefix` and `suffix`. Resolves with the number of bytes pipeTo() reported
+// and everything the client received.
+function transfer(options, prefix, suffix) {
+  let bytesSent;
+  const sent = new Promise((resolve, reject) => {
+    const server = net.createServer(async (socket) => {
+      server.close();
+      const filehandle = await open(filePath, 'r');
+      try {
+        socket.write(prefix);
+        bytesSent = await filehandle.pipeTo(socket, options);
+        socket.end(suffix);
+        resolve();
+      } catch (err) {
+        reject(err);
+      } finally {
+        await filehandle.close();
+      }
+    });
+    server.listen(0, () => received(server.address().port));
+  });
+  let received;
+  const contents = new Promise((resolve) => {
+    received = (port) => {
+      const chunks = [];
+      const client = net.connect(port);
+      client.on('data', (chunk) => chunks.push(chunk));
+      client.on('end', () => resolve(Buffer.concat(chunks)));
+    };
+  });
+  return Promise.all([sent, contents])
+    .then(([, data]) => ({ bytesSent, data }));
+}
+
+async function validateSocket() {
+  const prefix = Buffer.from('prefix');
+  const suffix = Buffer.from('suffix');
+
+  let result = await transfer(undefined, prefix, suffix);
+  assert.strictEqual(result.bytesSent, data.length);
+  assert.deepStrictEqual(result.data, Buffer.concat([prefix, data, suffix]));
+
+  result = await transfer({ offset: 1000, length: 1234567 }, prefix, suffix);
+  assert.strictEqual(result.bytesSent, 1234567);
+  assert.deepStrictEqual(result.data,
+                         Buffer.concat([prefix,
+                                        data.slice(1000, 1000 + 1234567),
+                                        suffix]));
+
+  // Reading past the end of the file stops at the end of the file.
+  result = await transfer({ offset: data.length - 10, length: 100 },
+                          prefix, suffix);
+  assert.strictEqual(result.bytesSent, 10);
+  assert.deepStrictEqual(result.data,
+                         Buffer.concat([prefix,
+                                        data.slice(data.length - 10),
+                                        suffix]));
+}
+
+async function validateWritable() {
+  const filehandle = await open(filePath, 'r');
+  const chunks = [];
+  const writable = new Writable({
+    write(chunk, encoding, callback) {
+      chunks.push(chunk);
+      setImmediate(callback);
+    }
+  });
+  const bytesSent = await filehandle.pipeTo(writable, { offset: 7 });
+  assert.strictEqual(bytesSent, data.length - 7);
+  assert.deepStrictEqual(Buffer.concat(chunks), data.slice(7));
+  assert.strictEqual(await filehandle.pipeTo(writable, { length: 0 }), 0);
+  await filehandle.close();
+}
+
+async function validateArguments() {
+  const filehandle = await open(filePath, 'r');
+  await assert.rejects(filehandle.pipeTo({}), {
+    code: 'ERR_INVALID_ARG_TYPE'
+  });
+  await assert.rejects(filehandle.pipeTo(new Writable(), 'foo'), {
+    code: 'ERR_INVALID_ARG_TYPE'
+  });
+  await assert.rejects(filehandle.pipeTo(new Writable(), { offset: -1 }), {
+    code: 'ERR_OUT_OF_RANGE'
+  });
+  await assert.rejects(filehandle.pipeTo(new Writable(), { length: 1.5 }), {
+    code: 'ERR_OUT_OF_RANGE'
+  });
+  await filehandle.close();
+}
+
+validateSocket()
+  .then(validateWritable)
+  .then(validateArguments)
+  .then(common.mustCall());
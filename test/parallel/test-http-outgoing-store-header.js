@@ -0,0 +1,73 @@
+'use strict';
+// Flags: --expose-internals
+
+// Verify the head that OutgoingMessage#_storeHeader() produces, both when it
+// is serialized natively and when it falls back to JS because some of the
+// values contain characters outside of latin1.
+
+require('../common');
+const assert = require('assert');
+const { outHeadersKey } = require('internal/http');
+const { OutgoingMessage } = require('http');
+
+function storeHeader(headers) {
+  const msg = new OutgoingMessage();
+  msg._hasBody = false;
+  msg.shouldKeepAlive = false;
+  msg._storeHeader('HTTP/1.1 200 OK\r\n', headers);
+  return msg._header;
+}
+
+assert.strictEqual(storeHeader(null),
+                   'HTTP/1.1 200 OK\r\nConnection: close\r\n\r\n');
+
+assert.strictEqual(
+  storeHeader({ 'Content-Type': 'text/plain', 'X-Count': 42 }),
+  'HTTP/1.1 200 OK\r\n' +
+  'Content-Type: text/plain\r\n' +
+  'X-Count: 42\r\n' +
+  'Connection: close\r\n\r\n');
+
+assert.strictEqual(
+  storeHeader([['Set-Cookie', 'a=1'], ['Set-Cookie', 'b=2'],
+               ['Connection', 'keep-alive']]),
+  'HTTP/1.1 200 OK\r\n' +
+  'Set-Cookie: a=1\r\n' +
+  'Set-Cookie: b=2\r\n' +
+  'Connection: keep-alive\r\n\r\n');
+
+// Values are stringified the same way concatenation would.
+assert.strictEqual(
+  storeHeader({ 'X-Obj': { toString() { return 'str'; } } }),
+  'HTTP/1.1 200 OK\r\nX-Obj: str\r\nConnection: close\r\n\r\n');
+
+assert.strictEqual(
+  storeHeader([['X-Text', 'café']]),
+  'HTTP/1.1 200 OK\r\nX-Text: café\r\nConnection: close\r\n\r\n');
+
+// When validation is skipped, CR and LF plus any whitespace that follows
+// them are still removed from values on both paths, and characters outside
+// of latin1 are preserved in the JS string.
+{
+  const msg = new OutgoingMessage();
+  msg._hasBody = false;
+  msg.shouldKeepAlive = false;
+  msg.setHeader('X-Value', 'a');
+  const headers = msg[outHeadersKey];
+  headers['x-value'][1] = 'a\r\n  b\nc';
+  headers['x-other'] = ['X-Other', '€\r\n\td'];
+  msg._storeHeader('HTTP/1.1 200 OK\r\n', headers);
+  assert.strictEqual(msg._header,
+                     'HTTP/1.1 200 OK\r\n' +
+                     'X-Value: abc\r\n' +
+                     'X-Other: €d\r\n' +
+                     'Connection: close\r\n\r\n');
+
+  headers['x-other'][1] = 'e\r\n\td';
+  msg._storeHeader('HTTP/1.1 200 OK\r\n', headers);
+  assert.strictEqual(msg._header,
+                     'HTTP/1.1 200 OK\r\n' +
+                     'X-Value: abc\r\n' +
+                     'X-Other: ed\r\n' +
+                     'Connection: close\r\n\r\n');
+}
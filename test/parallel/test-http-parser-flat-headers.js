@@ -0,0 +1,92 @@
+'use strict';
+const { mustCall } = require('../common');
+const assert = require('assert');
+
+// Tests for HTTPParser#setFlatHeaders(), which delivers the header names and
+// values as a single Buffer plus a Uint32Array of end offsets.
+
+const { HTTPParser } = process.binding('http_parser');
+const { REQUEST } = HTTPParser;
+
+const kOnHeaders = HTTPParser.kOnHeaders | 0;
+const kOnHeadersComplete = HTTPParser.kOnHeadersComplete | 0;
+const kOnMessageComplete = HTTPParser.kOnMessageComplete | 0;
+
+function unflatten(buf, offsets) {
+  assert(Buffer.isBuffer(buf));
+  assert(offsets instanceof Uint32Array);
+  assert.strictEqual(offsets.length % 2, 0);
+  const headers = [];
+  let start = 0;
+  for (const end of offsets) {
+    headers.push(buf.latin1Slice(start, end));
+    start = end;
+  }
+  assert.strictEqual(start, buf.length);
+  return headers;
+}
+
+function buildHeaders(count) {
+  const headers = [];
+  for (let i = 0; i < count; i++)
+    headers.push(`X-Header-${i}`, `value ${i}`);
+  // Empty values must not confuse the offsets.
+  headers.push('X-Empty', '');
+  return headers;
+}
+
+function buildRequest(headers) {
+  let request = 'GET /flat HTTP/1.1\r\n';
+  for (let i = 0; i < headers.length; i += 2)
+    request += `${headers[i]}: ${headers[i + 1]}\r\n`;
+  return Buffer.from(`${request}\r\n`);
+}
+
+// All headers are delivered together with the headers-complete callback.
+{
+  const headers = buildHeaders(5);
+  const request = buildRequest(headers);
+  const parser = new HTTPParser(REQUEST);
+  parser.setFlatHeaders(true);
+  parser[kOnHeadersComplete] = mustCall((versionMajor, versionMinor, buf,
+                                         method, url, statusCode,
+                                         statusMessage, upgrade,
+                                         shouldKeepAlive, offsets) => {
+    assert.strictEqual(url, '/flat');
+    assert.deepStrictEqual(unflatten(buf, offsets), headers);
+  });
+  parser[kOnMessageComplete] = mustCall();
+  parser.execute(request, 0, request.length);
+
+  // reinitialize() turns flat headers off again.
+  parser.reinitialize(REQUEST);
+  parser[kOnHeadersComplete] = mustCall((versionMajor, versionMinor, arr,
+                                         method, url, statusCode,
+                                         statusMessage, upgrade,
+                                         shouldKeepAlive, offsets) => {
+    assert.deepStrictEqual(arr, headers);
+    assert.strictEqual(offsets, undefined);
+  });
+  parser.execute(request, 0, request.length);
+}
+
+// Too many headers to fit into a single batch, and fragmented input.
+{
+  const headers = buildHeaders(100);
+  const request = buildRequest(headers);
+  const parser = new HTTPParser(REQUEST);
+  parser.setFlatHeaders(true);
+  let received = [];
+  parser[kOnHeaders] = mustCall((buf, url, offsets) => {
+    received = received.concat(unflatten(buf, offsets));
+  }, 4);
+  parser[kOnHeadersComplete] = mustCall((versionMajor, versionMinor, buf) => {
+    assert.strictEqual(buf, undefined);
+  });
+  parser[kOnMessageComplete] = mustCall();
+  for (let i = 0; i < request.length; i += 97) {
+    const chunk = request.slice(i, i + 97);
+    parser.execute(chunk, 0, chunk.length);
+  }
+  assert.deepStrictEqual(received, headers);
+}
@@ -0,0 +1,75 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const async_hooks = require('async_hooks');
+const http = require('http');
+
+// On the server, a keep-alive connection uses a single parser for all of its
+// requests and returns it to the pool when it closes. Client requests take a
+// parser from the pool for every response.
+
+const destroyed = new Map();
+async_hooks.createHook({
+  init(id, type) {
+    if (type === 'HTTPPARSER')
+      destroyed.set(id, 0);
+  },
+  destroy(id) {
+    if (destroyed.has(id))
+      destroyed.set(id, destroyed.get(id) + 1);
+  }
+}).enable();
+
+process.on('exit', () => {
+  // Evicting parsers from the pool must not run destroy() twice.
+  for (const count of destroyed.values())
+    assert(count <= 1);
+});
+
+const before = http.getParserPoolStats();
+assert.strictEqual(before.max, 1000);
+
+const server = http.createServer(common.mustCall((req, res) => {
+  res.end('ok');
+}, 3));
+
+server.listen(0, common.mustCall(() => {
+  const agent = new http.Agent({ keepAlive: true, maxSockets: 1 });
+  let pending = 3;
+  for (let i = 0; i < 3; i++) {
+    http.get({ port: server.address().port, agent }, common.mustCall((res) => {
+      res.resume();
+      res.on('end', common.mustCall(() => {
+        if (--pending === 0) {
+          agent.destroy();
+          server.close(common.mustCall(onClose));
+        }
+      }));
+    }));
+  }
+}));
+
+function onClose() {
+  setImmediate(common.mustCall(() => {
+    const after = http.getParserPoolStats();
+    // One for the server connection and one for each response.
+    assert.strictEqual(after.created + after.reused -
+                       before.created - before.reused, 4);
+    assert.strictEqual(after.created - before.created, 2);
+    assert.strictEqual(after.size, 2);
+
+    http.setParserPoolSize(1);
+    assert.strictEqual(http.getParserPoolStats().size, 1);
+    assert.strictEqual(http.getParserPoolStats().max, 1);
+    http.setParserPoolSize(1000);
+  }));
+}
+
+common.expectsError(() => http.setParserPoolSize(-1), {
+  code: 'ERR_OUT_OF_RANGE',
+  type: RangeError
+});
+common.expectsError(() => http.setParserPoolSize('1'), {
+  code: 'ERR_INVALID_ARG_TYPE',
+  type: TypeError
+});
@@ -561,6 +561,37 @@ function expectBody(expected) {
   parser.execute(req2, 0, req2.length);
 }
 
+//
+// Well-known header names keep their original spelling.
+//
+{
+  const request = Buffer.from(
+    'GET / HTTP/1.1\r\n' +
+    'Host: example.com\r\n' +
+    'host: example.com\r\n' +
+    'HOST: example.com\r\n' +
+    'content-TYPE: text/plain\r\n' +
+    'X-Unknown: 1\r\n' +
+    '\r\n'
+  );
+
+  const onHeadersComplete = (versionMajor, versionMinor, headers) => {
+    assert.deepStrictEqual(headers, [
+      'Host', 'example.com',
+      'host', 'example.com',
+      'HOST', 'example.com',
+      'content-TYPE', 'text/plain',
+      'X-Unknown', '1'
+    ]);
+  };
+
+  const parser = newParser(REQUEST);
+  parser[kOnHeadersComplete] = mustCall(onHeadersComplete, 2);
+  parser.execute(request, 0, request.length);
+  parser.reinitialize(REQUEST);
+  parser.execute(request, 0, request.length);
+}
+
 // Test parser 'this' safety
 // https://github.com/joyent/node/issues/6690
 assert.throws(function() {
@@ -0,0 +1,42 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+const assert = require('assert');
+const http2 = require('http2');
+
+// With a small maxWriteBatchSize, the session writes DATA frames of many
+// concurrent streams in several batches. All of the data must still arrive
+// intact and in order.
+
+const kStreams = 10;
+const contents = [];
+for (let i = 0; i < kStreams; i++)
+  contents.push(Buffer.alloc(40000 + i, i));
+
+const server = http2.createServer({ maxWriteBatchSize: 1000 });
+server.on('stream', common.mustCall((stream, headers) => {
+  const content = contents[+headers[':path'].slice(1)];
+  stream.respond({ ':status': 200 });
+  stream.write(content.slice(0, 20000));
+  stream.end(content.slice(20000));
+}, kStreams));
+
+server.listen(0, common.mustCall(() => {
+  const client = http2.connect(`http://localhost:${server.address().port}`,
+                               { maxWriteBatchSize: 1 });
+  let pending = kStreams;
+  for (let i = 0; i < kStreams; i++) {
+    const req = client.request({ ':path': `/${i}` });
+    const chunks = [];
+    req.on('data', (chunk) => chunks.push(chunk));
+    req.on('end', common.mustCall(() => {
+      assert.deepStrictEqual(Buffer.concat(chunks), contents[i]);
+      if (--pending === 0) {
+        client.close();
+        server.close();
+      }
+    }));
+    req.end();
+  }
+}));
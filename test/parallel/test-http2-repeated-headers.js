@@ -0,0 +1,58 @@
+'use strict';
+
+// Headers that are sent repeatedly on a session, or that appear in the HPACK
+// static table, are referenced instead of copied when frames are queued.
+// Verify that they still arrive intact.
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+const assert = require('assert');
+const http2 = require('http2');
+
+const kRequests = 100;
+
+const server = http2.createServer();
+server.on('stream', common.mustCall((stream, headers) => {
+  const n = headers['x-n'];
+  assert.strictEqual(headers['accept-encoding'], 'gzip, deflate');
+  assert.strictEqual(headers['x-static'], 'same for every request');
+  stream.respond({
+    ':status': 200,
+    'content-type': 'text/plain',
+    'cache-control': 'no-cache',
+    'x-unique': `value-${n}`,
+    'x-long': 'x'.repeat(1024)
+  });
+  stream.end(n);
+}, kRequests));
+
+server.listen(0, common.mustCall(() => {
+  const client = http2.connect(`http://localhost:${server.address().port}`);
+  let remaining = kRequests;
+  for (let i = 0; i < kRequests; i++) {
+    const req = client.request({
+      'accept-encoding': 'gzip, deflate',
+      'x-static': 'same for every request',
+      'x-n': `${i}`
+    });
+    req.on('response', common.mustCall((headers) => {
+      assert.strictEqual(headers[':status'], 200);
+      assert.strictEqual(headers['content-type'], 'text/plain');
+      assert.strictEqual(headers['cache-control'], 'no-cache');
+      assert.strictEqual(headers['x-unique'], `value-${i}`);
+      assert.strictEqual(headers['x-long'], 'x'.repeat(1024));
+    }));
+    let data = '';
+    req.setEncoding('utf8');
+    req.on('data', (chunk) => data += chunk);
+    req.on('end', common.mustCall(() => {
+      assert.strictEqual(data, `${i}`);
+      if (--remaining === 0) {
+        client.close();
+        server.close();
+      }
+    }));
+    req.end();
+  }
+}));
@@ -0,0 +1,56 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const net = require('net');
+
+const { performance } = require('perf_hooks');
+
+const keys = [
+  'loopCount',
+  'wakeups',
+  'events',
+  'eventsPerWakeup',
+  'ctlCalls',
+  'idleTime',
+  'activeTime'
+];
+
+{
+  const metrics = performance.eventLoopMetrics();
+  assert.deepStrictEqual(Object.keys(metrics), keys);
+  for (const key of keys)
+    assert.strictEqual(typeof metrics[key], 'number');
+  // The event loop has not started yet.
+  assert.strictEqual(metrics.activeTime, 0);
+}
+
+const server = net.createServer(common.mustCall((socket) => {
+  socket.end('hello');
+}));
+
+server.listen(0, common.mustCall(() => {
+  const client = net.connect(server.address().port);
+  client.resume();
+  client.on('end', common.mustCall(() => {
+    server.close();
+    setTimeout(common.mustCall(check), 50);
+  }));
+}));
+
+function check() {
+  const metrics = performance.eventLoopMetrics();
+  for (const key of keys)
+    assert(metrics[key] >= 0, `${key} is negative`);
+
+  if (!common.isLinux)
+    return;
+
+  assert(metrics.loopCount > 0);
+  assert(metrics.wakeups > 0);
+  assert(metrics.events >= metrics.wakeups);
+  assert(metrics.eventsPerWakeup >= 1);
+  assert(metrics.ctlCalls > 0);
+  assert(metrics.idleTime > 0);
+  assert(metrics.activeTime > 0);
+}
@@ -0,0 +1,67 @@
+'use strict';
+
+// Flags: --expose-internals
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+// A StreamPipe proxies from one TLS socket to another without the data
+// passing through JS.
+
+const assert = require('assert');
+const fixtures = require('../common/fixtures');
+const tls = require('tls');
+const { StreamPipe } = require('internal/test/binding');
+
+const options = {
+  key: fixtures.readKey('agent1-key.pem'),
+  cert: fixtures.readKey('agent1-cert.pem')
+};
+const payload = Buffer.alloc(2 * 1024 * 1024);
+for (let i = 0; i < payload.length; i += 1)
+  payload[i] = i % 251;
+
+const backend = tls.createServer(options, common.mustCall((socket) => {
+  socket.once('data', common.mustCall((chunk) => {
+    assert.strictEqual(chunk.toString(), 'go');
+    socket.end(payload);
+  }));
+}));
+
+const proxy = tls.createServer(options, common.mustCall((socket) => {
+  const upstream = tls.connect({
+    port: backend.address().port,
+    rejectUnauthorized: false
+  }, common.mustCall(() => {
+    const pipe = new StreamPipe(upstream._handle._externalStream,
+                                socket._handle._externalStream);
+    pipe.onunpipe = common.mustCall((err, bytesSent) => {
+      assert.strictEqual(err, 0);
+      assert.strictEqual(bytesSent, payload.length);
+      socket.end();
+    });
+    // Leave ending the sink to JS, which keeps track of its state.
+    pipe.start(false);
+    upstream.write('go');
+  }));
+  upstream.on('data', common.mustNotCall());
+  upstream.on('end', common.mustCall());
+}));
+
+backend.listen(0, common.mustCall(() => {
+  proxy.listen(0, common.mustCall(() => {
+    const chunks = [];
+    const client = tls.connect({
+      port: proxy.address().port,
+      rejectUnauthorized: false
+    });
+    client.on('data', (chunk) => chunks.push(chunk));
+    client.on('end', common.mustCall(() => {
+      assert.deepStrictEqual(Buffer.concat(chunks), payload);
+      client.end();
+      backend.close();
+      proxy.close();
+    }));
+  }));
+}));
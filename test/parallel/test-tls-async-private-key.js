@@ -0,0 +1,71 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+// Handshakes whose private key operations run on the threadpool complete and
+// carry data, for RSA and EC keys, with many of them running at the same time
+// and with contexts that are picked by the SNICallback.
+
+const assert = require('assert');
+const fixtures = require('../common/fixtures');
+const tls = require('tls');
+
+const rsa = {
+  key: fixtures.readKey('agent1-key.pem'),
+  cert: fixtures.readKey('agent1-cert.pem')
+};
+const ec = {
+  key: fixtures.readKey('ec-key.pem'),
+  cert: fixtures.readKey('ec-cert.pem')
+};
+const connections = 10;
+
+function test(options, clientOptions, callback) {
+  const server = tls.createServer(Object.assign({
+    asyncPrivateKey: true
+  }, options), common.mustCall((socket) => {
+    socket.pipe(socket);
+  }, connections));
+
+  server.listen(0, common.mustCall(() => {
+    let pending = connections;
+    for (let i = 0; i < connections; i++) {
+      const message = `message ${i}`;
+      const client = tls.connect(Object.assign({
+        port: server.address().port,
+        rejectUnauthorized: false
+      }, clientOptions), common.mustCall(() => {
+        assert.strictEqual(client.isSessionReused(), false);
+        client.end(message);
+      }));
+      let received = '';
+      client.setEncoding('utf8');
+      client.on('data', (chunk) => received += chunk);
+      client.on('end', common.mustCall(() => {
+        assert.strictEqual(received, message);
+        if (--pending === 0) {
+          server.close();
+          callback();
+        }
+      }));
+    }
+  }));
+}
+
+test(rsa, {}, common.mustCall(() => {
+  test(ec, { ciphers: 'ECDHE-ECDSA-AES128-GCM-SHA256' }, common.mustCall(() => {
+    const context = tls.createSecureContext(Object.assign({
+      asyncPrivateKey: true
+    }, ec));
+    test(Object.assign({
+      SNICallback: common.mustCall((servername, callback) => {
+        assert.strictEqual(servername, 'ec.example.com');
+        callback(null, context);
+      }, connections)
+    }, rsa), {
+      servername: 'ec.example.com',
+      ciphers: 'ECDHE-ECDSA-AES128-GCM-SHA256'
+    }, common.mustCall());
+  }));
+}));
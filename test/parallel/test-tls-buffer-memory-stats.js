@@ -0,0 +1,80 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+// Connections give the buffers for their encrypted data back once they are
+// idle, and data of any size still gets through.
+
+const assert = require('assert');
+const fixtures = require('../common/fixtures');
+const tls = require('tls');
+
+const options = {
+  key: fixtures.readKey('agent1-key.pem'),
+  cert: fixtures.readKey('agent1-cert.pem')
+};
+const connections = 10;
+const payloads = ['ping', Buffer.alloc(1024 * 1024, 'x').toString()];
+
+const server = tls.createServer(options, common.mustCall((socket) => {
+  socket.pipe(socket);
+}, connections));
+
+{
+  const stats = server.getBufferMemoryStats();
+  assert.deepStrictEqual(Object.keys(stats),
+                         ['used', 'peak', 'buffers', 'pooled']);
+  assert.strictEqual(stats.used, 0);
+  assert.strictEqual(stats.peak, 0);
+  assert.strictEqual(stats.buffers, 0);
+}
+
+server.listen(0, common.mustCall(() => {
+  const clients = [];
+  let pending = connections;
+  for (let i = 0; i < connections; i++) {
+    const client = tls.connect({
+      port: server.address().port,
+      rejectUnauthorized: false
+    }, common.mustCall(() => {
+      clients.push(client);
+      if (--pending === 0)
+        send(0);
+    }));
+    client.setEncoding('utf8');
+  }
+
+  function send(index) {
+    const payload = payloads[index];
+    let pending = clients.length;
+    for (const client of clients) {
+      let received = '';
+      client.on('data', function onData(chunk) {
+        received += chunk;
+        if (received.length < payload.length)
+          return;
+        client.removeListener('data', onData);
+        assert.strictEqual(received, payload);
+        if (--pending === 0)
+          setImmediate(idle, index);
+      });
+      client.write(payload);
+    }
+  }
+
+  function idle(index) {
+    const stats = server.getBufferMemoryStats();
+    assert.strictEqual(stats.used, 0);
+    assert.strictEqual(stats.buffers, 0);
+    assert(stats.peak > 0);
+    assert(stats.pooled > 0);
+
+    if (index + 1 < payloads.length)
+      return send(index + 1);
+
+    for (const client of clients)
+      client.end();
+    server.close();
+  }
+}));
@@ -0,0 +1,46 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+// Records are decrypted straight into the buffers of the stream's reader.
+// Check that records of all sizes, including ones that are larger than the
+// buffers and ones that arrive in pieces, are passed on intact.
+
+const assert = require('assert');
+const fixtures = require('../common/fixtures');
+const tls = require('tls');
+
+const sizes = [1, 100, 16383, 16384, 16385, 65536, 300000];
+const chunks = sizes.map((size, i) => {
+  const chunk = Buffer.allocUnsafe(size);
+  for (let j = 0; j < size; j++)
+    chunk[j] = (i + j) % 256;
+  return chunk;
+});
+const expected = Buffer.concat(chunks);
+
+const server = tls.createServer({
+  key: fixtures.readKey('agent1-key.pem'),
+  cert: fixtures.readKey('agent1-cert.pem')
+}, common.mustCall((socket) => {
+  for (const chunk of chunks)
+    socket.write(chunk);
+  socket.end();
+}));
+
+server.listen(0, common.mustCall(() => {
+  const client = tls.connect({
+    port: server.address().port,
+    rejectUnauthorized: false
+  });
+  const received = [];
+  client.on('data', (chunk) => {
+    assert(chunk.length <= 16384);
+    received.push(chunk);
+  });
+  client.on('end', common.mustCall(() => {
+    assert.deepStrictEqual(Buffer.concat(received), expected);
+    server.close();
+  }));
+}));
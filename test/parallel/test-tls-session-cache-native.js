@@ -0,0 +1,83 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+// Servers that use the same native session cache can resume each other's
+// sessions, without 'newSession' and 'resumeSession' listeners.
+
+const assert = require('assert');
+const fixtures = require('../common/fixtures');
+const tls = require('tls');
+const { SSL_OP_NO_TICKET } = require('crypto').constants;
+
+function createServer(sessionCache) {
+  return tls.createServer({
+    key: fixtures.readKey('agent1-key.pem'),
+    cert: fixtures.readKey('agent1-cert.pem'),
+    // Without tickets, resumption relies on the session cache.
+    secureOptions: SSL_OP_NO_TICKET,
+    sessionCache
+  }, (socket) => socket.end()).listen(0);
+}
+
+function connect(server, session, callback) {
+  const client = tls.connect({
+    port: server.address().port,
+    rejectUnauthorized: false,
+    session
+  }, common.mustCall(() => {
+    callback(client.isSessionReused(), client.getSession());
+    client.end();
+  }));
+}
+
+const first = createServer({ name: 'test-shared', size: 10, shards: 2 });
+const second = createServer({ name: 'test-shared' });
+const other = createServer({ name: 'test-other' });
+
+first.on('listening', common.mustCall(() => {
+  connect(first, undefined, common.mustCall((reused, session) => {
+    assert.strictEqual(reused, false);
+    assert.strictEqual(first.getSessionCacheStats().stores, 1);
+
+    connect(second, session, common.mustCall((reused) => {
+      assert.strictEqual(reused, true);
+      const stats = second.getSessionCacheStats();
+      assert.strictEqual(stats.hits, 1);
+      assert.strictEqual(stats.size, 1);
+
+      connect(other, session, common.mustCall((reused) => {
+        assert.strictEqual(reused, false);
+        assert.strictEqual(other.getSessionCacheStats().misses, 1);
+        first.close();
+        second.close();
+        other.close();
+      }));
+    }));
+  }));
+}));
+
+{
+  const server = tls.createServer({});
+  assert.strictEqual(server.getSessionCacheStats(), undefined);
+}
+
+assert.deepStrictEqual(
+  tls.createServer({ sessionCache: true }).getSessionCacheStats(),
+  tls.createServer({ sessionCache: { name: 'default' } })
+    .getSessionCacheStats());
+
+common.expectsError(
+  () => tls.createSecureContext({ sessionCache: { name: 1 } }), {
+    code: 'ERR_INVALID_ARG_TYPE',
+    type: TypeError
+  });
+
+for (const option of ['size', 'shards', 'timeout']) {
+  common.expectsError(
+    () => tls.createSecureContext({ sessionCache: { [option]: -1 } }), {
+      code: 'ERR_OUT_OF_RANGE',
+      type: RangeError
+    });
+}
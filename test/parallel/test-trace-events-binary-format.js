@@ -0,0 +1,61 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const cp = require('child_process');
+const fs = require('fs');
+const path = require('path');
+const { convert } = require('../../tools/trace-events/binary-to-json');
+
+if (!common.isMainThread)
+  common.skip('process.chdir is not available in Workers');
+
+const CODE =
+  'setTimeout(() => { for (var i = 0; i < 100000; i++) { "test" + i } }, 1)';
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+process.chdir(tmpdir.path);
+
+function checkTraces(traces, pid) {
+  assert(traces.length > 0);
+  assert(traces.some((trace) => {
+    return trace.pid === pid &&
+           trace.cat === 'v8' &&
+           trace.name === 'V8.ScriptCompiler';
+  }));
+  assert(traces.some((trace) => {
+    return trace.pid === pid &&
+           trace.cat === 'node,node.async_hooks' &&
+           trace.name === 'Timeout';
+  }));
+}
+
+for (const format of ['binary', 'binary-gzip']) {
+  const file = path.join(tmpdir.path, `${format}.log`);
+  const proc = cp.spawn(process.execPath, [
+    '--trace-events-enabled',
+    `--trace-event-format=${format}`,
+    '--trace-event-file-pattern', file,
+    '-e', CODE
+  ]);
+
+  proc.once('exit', common.mustCall(() => {
+    assert(common.fileExists(file));
+    const data = fs.readFileSync(file);
+    if (format === 'binary-gzip') {
+      // gzip magic number
+      assert.strictEqual(data[0], 0x1f);
+      assert.strictEqual(data[1], 0x8b);
+    } else {
+      assert.strictEqual(data.toString('latin1', 0, 4), 'NTRC');
+    }
+    checkTraces(convert(data).traceEvents, proc.pid);
+  }));
+}
+
+{
+  const proc = cp.spawnSync(process.execPath,
+                            ['--trace-event-format=xml', '-e', '']);
+  assert.strictEqual(proc.status, 9);
+  assert(/invalid value for --trace-event-format=xml/.test(proc.stderr));
+}
@@ -0,0 +1,97 @@
+'use strict';
+
+// Test compressing and decompressing with the Brotli streams.
+
+const common = require('../common');
+const assert = require('assert');
+const zlib = require('zlib');
+
+if (zlib.BrotliCompress === undefined)
+  common.skip('node compiled without brotli');
+
+const {
+  BROTLI_OPERATION_FLUSH,
+  BROTLI_PARAM_QUALITY,
+  BROTLI_PARAM_SIZE_HINT
+} = zlib.constants;
+
+const lines = [];
+for (let i = 0; i < 2000; i++)
+  lines.push(`${i}: ${i % 5 === 0 ? Math.random() : 'some repeated text'}\n`);
+const input = Buffer.from(lines.join(''));
+
+{
+  const compressed = zlib.brotliCompressSync(input);
+  assert(compressed.length < input.length);
+  assert.deepStrictEqual(zlib.brotliDecompressSync(compressed), input);
+
+  zlib.brotliDecompress(compressed, common.mustCall((err, result) => {
+    assert.ifError(err);
+    assert.deepStrictEqual(result, input);
+  }));
+}
+
+// Parameters are passed on to the encoder.
+{
+  const compressed = zlib.brotliCompressSync(input, {
+    params: {
+      [BROTLI_PARAM_QUALITY]: 1,
+      [BROTLI_PARAM_SIZE_HINT]: input.length
+    }
+  });
+  assert.deepStrictEqual(zlib.brotliDecompressSync(compressed), input);
+}
+
+// Small output chunks, which need several writes per input chunk.
+zlib.brotliCompress(input, { chunkSize: 64 }, common.mustCall((err, res) => {
+  assert.ifError(err);
+  zlib.brotliDecompress(res, { chunkSize: 64 }, common.mustCall((err, out) => {
+    assert.ifError(err);
+    assert.deepStrictEqual(out, input);
+  }));
+}));
+
+// Everything written before a flush can be decompressed once it is done.
+{
+  const compress = zlib.createBrotliCompress();
+  const output = [];
+  compress.on('data', (chunk) => output.push(chunk));
+  compress.write(input.slice(0, 10000));
+  compress.flush(common.mustCall(() => {
+    const partial = zlib.brotliDecompressSync(Buffer.concat(output), {
+      finishFlush: BROTLI_OPERATION_FLUSH
+    });
+    assert.deepStrictEqual(partial, input.slice(0, 10000));
+    compress.end(input.slice(10000));
+  }));
+  compress.on('end', common.mustCall(() => {
+    assert.deepStrictEqual(zlib.brotliDecompressSync(Buffer.concat(output)),
+                           input);
+  }));
+}
+
+// Truncated and invalid input.
+{
+  const compressed = zlib.brotliCompressSync(input);
+  zlib.brotliDecompress(compressed.slice(0, -4), common.mustCall((err) => {
+    assert.strictEqual(err.message, 'unexpected end of file');
+    assert.strictEqual(err.code, 'Z_BUF_ERROR');
+  }));
+
+  assert.throws(() => zlib.brotliDecompressSync(Buffer.from('not brotli')), {
+    message: 'Decompression failed',
+    code: /^ERR_BROTLI_/
+  });
+}
+
+common.expectsError(() => zlib.createBrotliCompress({ params: { 1000: 1 } }), {
+  code: 'ERR_BROTLI_INVALID_PARAM',
+  type: RangeError
+});
+
+common.expectsError(() => zlib.createBrotliCompress({
+  params: { [BROTLI_PARAM_QUALITY]: 'high' }
+}), {
+  code: 'ERR_INVALID_ARG_TYPE',
+  type: TypeError
+});
@@ -0,0 +1,116 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const async_hooks = require('async_hooks');
+const zlib = require('zlib');
+
+// Closed zlib objects hand their internal state to the next object that is
+// created with the same parameters.
+
+const input = Buffer.from('hello world '.repeat(1000));
+
+const destroyed = new Map();
+async_hooks.createHook({
+  init(id, type) {
+    if (type === 'ZLIB')
+      destroyed.set(id, 0);
+  },
+  destroy(id) {
+    if (destroyed.has(id))
+      destroyed.set(id, destroyed.get(id) + 1);
+  }
+}).enable();
+
+process.on('exit', () => {
+  // Evicting handles from the pool must not run destroy() twice.
+  for (const count of destroyed.values())
+    assert(count <= 1);
+});
+
+function stats() {
+  return zlib.getContextPoolStats();
+}
+
+{
+  const before = stats();
+  assert.strictEqual(before.max, 8);
+
+  const compressed = zlib.gzipSync(input);
+  const afterFirst = stats();
+  assert.strictEqual(afterFirst.size, before.size + 1);
+
+  // The reused state produces the same output as a fresh one.
+  assert.deepStrictEqual(zlib.gzipSync(input), compressed);
+  const afterSecond = stats();
+  assert.strictEqual(afterSecond.reused, afterFirst.reused + 1);
+  assert.strictEqual(afterSecond.created, afterFirst.created);
+  assert.strictEqual(afterSecond.size, afterFirst.size);
+
+  assert.deepStrictEqual(zlib.gunzipSync(compressed), input);
+  assert.deepStrictEqual(zlib.gunzipSync(compressed), input);
+
+  // Different parameters do not share a state.
+  const created = stats().created;
+  zlib.gzipSync(input, { level: 1 });
+  assert.strictEqual(stats().created, created + 1);
+}
+
+{
+  // Objects that cannot be reused are not counted.
+  const before = stats();
+  const dictionary = Buffer.from('hello world');
+  zlib.deflateSync(input, { dictionary });
+  zlib.unzipSync(zlib.gzipSync(input));
+  const after = stats();
+  assert.strictEqual(after.created, before.created);
+  assert.strictEqual(after.discarded, before.discarded);
+}
+
+{
+  // Objects whose parameters changed are not put back.
+  const deflate = zlib.createDeflate({ level: 2 });
+  deflate.params(3, zlib.constants.Z_DEFAULT_STRATEGY, common.mustCall(() => {
+    const before = stats();
+    deflate.close();
+    assert.strictEqual(stats().discarded, before.discarded + 1);
+    assert.strictEqual(stats().size, before.size);
+  }));
+}
+
+{
+  assert.throws(() => zlib.setContextPoolSize(-1), {
+    code: 'ERR_OUT_OF_RANGE'
+  });
+  assert.throws(() => zlib.setContextPoolSize('1'), {
+    code: 'ERR_INVALID_ARG_TYPE'
+  });
+}
+
+// Streams are reused once they end, and work the same way afterwards.
+function roundTrip(callback) {
+  const gzip = zlib.createGzip();
+  const gunzip = zlib.createGunzip();
+  const chunks = [];
+  gzip.pipe(gunzip);
+  gunzip.on('data', (chunk) => chunks.push(chunk));
+  gunzip.on('end', common.mustCall(() => {
+    assert.deepStrictEqual(Buffer.concat(chunks), input);
+    // Let 'end' listeners, which close the streams, run first.
+    setImmediate(callback);
+  }));
+  gzip.end(input);
+}
+
+roundTrip(common.mustCall(() => {
+  const before = stats();
+  roundTrip(common.mustCall(() => {
+    const after = stats();
+    assert.strictEqual(after.reused, before.reused + 2);
+
+    zlib.setContextPoolSize(0);
+    assert.strictEqual(stats().size, 0);
+    assert.strictEqual(stats().max, 0);
+    zlib.gzipSync(input);
+    assert.strictEqual(stats().size, 0);
+  }));
+}));
@@ -0,0 +1,113 @@
+'use strict';
+
+// Test gzip streams that compress blocks of their input in parallel.
+
+const common = require('../common');
+const assert = require('assert');
+const zlib = require('zlib');
+
+const lines = [];
+for (let i = 0; i < 3000; i++)
+  lines.push(`${i}: ${i % 7 === 0 ? Math.random() : 'some repeated text'}\n`);
+const input = Buffer.from(lines.join(''));
+const blockSize = 4096;
+assert(input.length > 10 * blockSize);
+
+// The output is a regular gzip stream, and independent of the order in which
+// the blocks finish.
+const expected = zlib.gzipSync(input, { parallel: 4, blockSize });
+assert.deepStrictEqual(zlib.gunzipSync(expected), input);
+
+zlib.gzip(input, { parallel: 4, blockSize }, common.mustCall((err, result) => {
+  assert.ifError(err);
+  assert.deepStrictEqual(result, expected);
+}));
+
+// An input that consists of whole blocks.
+{
+  const exact = input.slice(0, 8 * blockSize);
+  const result = zlib.gzipSync(exact, { parallel: 2, blockSize });
+  assert.deepStrictEqual(zlib.gunzipSync(result), exact);
+}
+
+// Empty input.
+zlib.gzip('', { parallel: 2 }, common.mustCall((err, result) => {
+  assert.ifError(err);
+  assert.strictEqual(zlib.gunzipSync(result).length, 0);
+}));
+
+// Many small writes with flushes in between. Everything written before a
+// flush can be decompressed once the flush is done.
+{
+  const gzip = zlib.createGzip({ parallel: 3, blockSize });
+  const output = [];
+  gzip.on('data', (chunk) => output.push(chunk));
+  let offset = 0;
+
+  function write() {
+    while (offset < input.length) {
+      const chunk = input.slice(offset, offset + 1000);
+      offset += chunk.length;
+      const ret = gzip.write(chunk);
+      if (offset % 20000 === 0) {
+        gzip.flush(common.mustCall(() => {
+          const partial = zlib.gunzipSync(Buffer.concat(output), {
+            finishFlush: zlib.constants.Z_SYNC_FLUSH
+          });
+          assert.deepStrictEqual(partial, input.slice(0, offset));
+          write();
+        }));
+        return;
+      }
+      if (!ret) {
+        gzip.once('drain', write);
+        return;
+      }
+    }
+    gzip.end();
+  }
+
+  gzip.on('end', common.mustCall(() => {
+    assert.deepStrictEqual(zlib.gunzipSync(Buffer.concat(output)), input);
+    assert.strictEqual(gzip.bytesWritten, input.length);
+  }));
+  write();
+}
+
+// Changing the parameters applies to the following blocks.
+{
+  const gzip = zlib.createGzip({ parallel: 2, blockSize });
+  const output = [];
+  gzip.on('data', (chunk) => output.push(chunk));
+  gzip.write(input.slice(0, 5000));
+  gzip.params(1, zlib.constants.Z_DEFAULT_STRATEGY, common.mustCall(() => {
+    gzip.end(input.slice(5000, 20000));
+  }));
+  gzip.on('end', common.mustCall(() => {
+    assert.deepStrictEqual(zlib.gunzipSync(Buffer.concat(output)),
+                           input.slice(0, 20000));
+  }));
+
+  common.expectsError(() => gzip.reset(), {
+    code: 'ERR_METHOD_NOT_IMPLEMENTED',
+    type: Error
+  });
+}
+
+// Destroying the stream while blocks are being compressed.
+{
+  const gzip = zlib.createGzip({ parallel: 4, blockSize });
+  gzip.on('data', common.mustNotCall());
+  gzip.write(input);
+  gzip.close();
+}
+
+common.expectsError(() => zlib.createGzip({ parallel: -1 }), {
+  code: 'ERR_OUT_OF_RANGE',
+  type: RangeError
+});
+
+common.expectsError(() => zlib.createGzip({ parallel: 2, blockSize: 1 }), {
+  code: 'ERR_OUT_OF_RANGE',
+  type: RangeError
+});
@@ -43,6 +43,7 @@ common.crashOnUnhandledRejection();
     delete providers.HTTP2SETTINGS;
     // TODO(addaleax): Test for these
     delete providers.STREAMPIPE;
+    delete providers.SENDFILEPIPE;
     delete providers.MESSAGEPORT;
     delete providers.WORKER;
     if (!common.isMainThread)
@@ -123,6 +124,16 @@ if (common.hasCrypto) { // eslint-disable-line node-core/crypto-check
     testInitialized(this, 'AsyncWrap');
   }));
 
+  crypto.hash('sha256', 'data', common.mustCall(function() {
+    testInitialized(this, 'AsyncWrap');
+  }));
+
+  const data = Buffer.alloc(64 * 1024);
+  crypto.createCipheriv('aes-128-ctr', Buffer.alloc(16), Buffer.alloc(16))
+    .updateInto(data, data, common.mustCall(function() {
+      testInitialized(this, 'AsyncWrap');
+    }));
+
   if (typeof process.binding('crypto').scrypt === 'function') {
     crypto.scrypt('password', 'salt', 8, common.mustCall(function() {
       testInitialized(this, 'AsyncWrap');
@@ -16,10 +16,12 @@ const runBenchmark = require('../common/benchmark');
 
 runBenchmark('tls',
              [
+               'async=1',
                'concurrency=1',
                'dur=0.1',
                'n=1',
                'size=2',
+               'storm=0',
                'securing=SecurePair',
                'type=asc'
              ],
@@ -0,0 +1,203 @@
+'use strict';
+
+// Converts trace event files written with --trace-event-format=binary or
+// --trace-event-format=binary-gzip into the JSON format that can be loaded
+// into chrome://tracing. The binary format is described in
+// src/tracing/binary_trace_writer.h.
+//
+// Usage: node binary-to-json.js input [output]
+
+const fs = require('fs');
+const zlib = require('zlib');
+
+const kMagic = 'NTRC';
+const kVersion = 1;
+
+const kStringRecord = 1;
+const kEventRecord = 2;
+const kResetStringsRecord = 3;
+
+const TRACE_VALUE_TYPE_BOOL = 1;
+const TRACE_VALUE_TYPE_UINT = 2;
+const TRACE_VALUE_TYPE_INT = 3;
+const TRACE_VALUE_TYPE_DOUBLE = 4;
+const TRACE_VALUE_TYPE_POINTER = 5;
+const TRACE_VALUE_TYPE_STRING = 6;
+const TRACE_VALUE_TYPE_COPY_STRING = 7;
+const TRACE_VALUE_TYPE_CONVERTABLE = 8;
+
+class Reader {
+  constructor(data) {
+    this.data = data;
+    this.offset = 0;
+  }
+
+  done() {
+    return this.offset >= this.data.length;
+  }
+
+  byte() {
+    if (this.offset >= this.data.length)
+      throw new Error('Unexpected end of trace data');
+    return this.data[this.offset++];
+  }
+
+  bigVarint() {
+    let value = 0n;
+    let shift = 0n;
+    let byte;
+    do {
+      byte = this.byte();
+      value |= BigInt(byte & 0x7f) << shift;
+      shift += 7n;
+    } while (byte & 0x80);
+    return value;
+  }
+
+  bigSignedVarint() {
+    const value = this.bigVarint();
+    return (value & 1n) ? -((value + 1n) >> 1n) : value >> 1n;
+  }
+
+  varint() {
+    return Number(this.bigVarint());
+  }
+
+  signedVarint() {
+    return Number(this.bigSignedVarint());
+  }
+
+  double() {
+    const value = this.data.readDoubleLE(this.offset);
+    this.offset += 8;
+    return value;
+  }
+
+  string() {
+    const length = this.varint();
+    const end = this.offset + length;
+    if (end > this.data.length)
+      throw new Error('Unexpected end of trace data');
+    const value = this.data.toString('utf8', this.offset, end);
+    this.offset = end;
+    return value;
+  }
+}
+
+// Mirrors the way V8's JSONTraceWriter prints doubles that JSON cannot
+// represent.
+function doubleValue(value) {
+  if (Number.isFinite(value))
+    return value;
+  if (Number.isNaN(value))
+    return 'NaN';
+  return value < 0 ? '-Infinity' : 'Infinity';
+}
+
+function readArgValue(reader, type, lookup) {
+  switch (type) {
+    case TRACE_VALUE_TYPE_BOOL:
+      return reader.byte() !== 0;
+    case TRACE_VALUE_TYPE_UINT:
+      return reader.varint();
+    case TRACE_VALUE_TYPE_INT:
+      return reader.signedVarint();
+    case TRACE_VALUE_TYPE_DOUBLE:
+      return doubleValue(reader.double());
+    case TRACE_VALUE_TYPE_POINTER:
+      return `0x${reader.bigVarint().toString(16)}`;
+    case TRACE_VALUE_TYPE_STRING: {
+      const value = lookup(reader.varint());
+      return value === undefined ? 'nullptr' : value;
+    }
+    case TRACE_VALUE_TYPE_COPY_STRING:
+      return reader.string();
+    case TRACE_VALUE_TYPE_CONVERTABLE:
+      return JSON.parse(reader.string());
+    default:
+      throw new Error(`Unknown argument type ${type}`);
+  }
+}
+
+// Returns an object in the format of V8's JSON trace files, i.e. with the
+// events in its `traceEvents` property.
+function convert(data) {
+  // Compressed files consist of one or more gzip members.
+  if (data.length >= 2 && data[0] === 0x1f && data[1] === 0x8b)
+    data = zlib.gunzipSync(data);
+
+  const reader = new Reader(data);
+  if (data.toString('latin1', 0, kMagic.length) !== kMagic)
+    throw new Error('Not a binary trace file');
+  reader.offset = kMagic.length;
+  const version = reader.byte();
+  if (version !== kVersion)
+    throw new Error(`Unsupported binary trace version ${version}`);
+
+  let strings = [];
+  function lookup(index) {
+    return index === 0 ? undefined : strings[index - 1];
+  }
+  const traceEvents = [];
+  let ts = 0;
+  let tts = 0;
+
+  while (!reader.done()) {
+    const record = reader.byte();
+    if (record === kStringRecord) {
+      strings.push(reader.string());
+      continue;
+    }
+    if (record === kResetStringsRecord) {
+      strings = [];
+      continue;
+    }
+    if (record !== kEventRecord)
+      throw new Error(`Unknown record type ${record}`);
+
+    const event = {
+      pid: reader.signedVarint(),
+      tid: reader.signedVarint(),
+      ph: String.fromCharCode(reader.byte()),
+      cat: lookup(reader.varint()),
+      name: lookup(reader.varint())
+    };
+    ts += reader.signedVarint();
+    tts += reader.signedVarint();
+    event.ts = ts;
+    event.tts = tts;
+    event.dur = reader.varint();
+    event.tdur = reader.varint();
+    if (reader.byte() !== 0) {
+      const scope = lookup(reader.varint());
+      if (scope !== undefined)
+        event.scope = scope;
+      event.id = `0x${reader.bigVarint().toString(16)}`;
+    }
+    event.args = {};
+    const numArgs = reader.varint();
+    for (let i = 0; i < numArgs; i++) {
+      const name = lookup(reader.varint());
+      const type = reader.byte();
+      event.args[name] = readArgValue(reader, type, lookup);
+    }
+    traceEvents.push(event);
+  }
+
+  return { traceEvents };
+}
+
+module.exports = { convert };
+
+if (require.main === module) {
+  const [input, output] = process.argv.slice(2);
+  if (input === undefined) {
+    console.error('Usage: node binary-to-json.js input [output]');
+    process.exit(1);
+  }
+  const json = JSON.stringify(convert(fs.readFileSync(input)));
+  if (output === undefined)
+    process.stdout.write(json);
+  else
+    fs.writeFileSync(output, json);
+}